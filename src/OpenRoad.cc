@@ -444,13 +444,8 @@ void OpenRoad::readDb(const char* filename)
         ORD, 47, "You can't load a new db file as the db is already populated");
   }
 
-  std::ifstream stream;
-  stream.exceptions(std::ifstream::failbit | std::ifstream::badbit
-                    | std::ios::eofbit);
-  stream.open(filename, std::ios::binary);
-
   try {
-    db_->read(stream);
+    db_->read(filename);
   } catch (const std::ios_base::failure& f) {
     logger_->error(ORD, 54, "odb file {} is invalid: {}", filename, f.what());
   }
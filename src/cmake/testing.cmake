@@ -1,4 +1,13 @@
+# An optional fourth argument sets the pass criteria: compare_logfile (the
+# default) diffs the log against <test>.ok, pass_fail checks that the last
+# line of the log starts with pass.
 function(or_integration_test tool_name test_name regression_binary)
+  if (ARGC GREATER 3)
+    set(test_type ${ARGV3})
+  else()
+    set(test_type compare_logfile)
+  endif()
+
   add_test (
     NAME ${tool_name}.${test_name}
     COMMAND ${BASH_PROGRAM} ${regression_binary} ${test_name}
@@ -6,7 +15,7 @@ function(or_integration_test tool_name test_name regression_binary)
   )
 
   string(CONCAT ENV
-      "TEST_TYPE=compare_logfile;"
+      "TEST_TYPE=${test_type};"
       "CTEST_TESTNAME=${test_name};"
       "DIFF_LOCATION=${CMAKE_CURRENT_LIST_DIR}/results/${test_name}.diff"
   )
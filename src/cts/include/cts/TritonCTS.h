@@ -43,6 +43,7 @@
 #include <vector>
 
 #include "odb/db.h"
+#include "utl/NameAllocator.h"
 
 namespace utl {
 class Logger;
@@ -230,6 +231,7 @@ class TritonCTS
   unsigned numClkNets_ = 0;
   unsigned numFixedNets_ = 0;
   unsigned dummyLoadIndex_ = 0;
+  utl::NameAllocator dummyLoadNames_;
 
   // root buffer and sink bufer candidates
   std::vector<std::string> rootBuffers_;
@@ -133,6 +133,8 @@ class CtsOptions
     metricFile_ = metricFile;
   }
   std::string getMetricsFile() const { return metricFile_; }
+  void setCharCacheDir(const std::string& dir) { charCacheDir_ = dir; }
+  std::string getCharCacheDir() const { return charCacheDir_; }
   void setNumClockRoots(unsigned roots) { clockRoots_ = roots; }
   int getNumClockRoots() const { return clockRoots_; }
   void setNumClockSubnets(int nets) { clockSubnets_ = nets; }
@@ -253,6 +255,7 @@ class CtsOptions
   std::string sinkBuffer_ = "";
   std::string treeBuffer_ = "";
   std::string metricFile_ = "";
+  std::string charCacheDir_ = "";
   int dbUnits_ = -1;
   unsigned wireSegmentUnit_ = 0;
   bool plotSolution_ = false;
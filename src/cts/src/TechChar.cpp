@@ -35,11 +35,17 @@
 
 #include "TechChar.h"
 
+#include <unistd.h>
+
 #include <algorithm>
+#include <cstdio>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
+#include <limits>
 #include <ostream>
 #include <sstream>
+#include <system_error>
 
 #include "db_sta/dbSta.hh"
 #include "rsz/Resizer.hh"
@@ -537,14 +543,6 @@ void TechChar::initCharacterization()
     logger_->error(
         CTS, 541, "Could not find buffer output port for {}.", bufMasterName);
   }
-  // Creates the new characterization block. (Wiresegments are created here
-  // instead of the main block)
-  const char* characterizationBlockName = "CharacterizationBlock";
-  if (auto char_block = block->findChild(characterizationBlockName)) {
-    odb::dbBlock::destroy(char_block);
-  }
-  charBlock_ = odb::dbBlock::create(block, characterizationBlockName);
-
   // Defines the different wirelengths to test and the characterization unit.
   const unsigned wirelengthIterations = options_->getCharWirelengthIterations();
   unsigned maxWirelength = (charBuf_->getHeight() * 10)
@@ -1064,6 +1062,9 @@ void TechChar::createStaInstance()
   // characterization. Creates the new instance based on the charcterization
   // block.
   openStaChar_ = openSta_->makeBlockSta(charBlock_);
+  // The topologies of a wirelength are independent cones of one graph, so
+  // the levelized timing update processes them in parallel.
+  openStaChar_->setThreadCount(openSta_->threadCount());
   // Gets the corner and other analysis attributes from the new instance.
   charCorner_ = openStaChar_->cmdCorner();
   sta::PathAPIndex path_ap_index
@@ -1545,6 +1546,36 @@ void TechChar::create()
 {
   // Setup of the attributes required to run the characterization.
   initCharacterization();
+  const std::string cacheDir = options_->getCharCacheDir();
+  const std::string cacheKey = cacheDir.empty() ? "" : getCacheKey();
+  const std::string cacheFile
+      = cacheDir.empty() ? "" : cacheDir + "/cts_char_" + cacheKey + ".txt";
+  std::vector<ResultData> convertedSolutions;
+  if (cacheFile.empty()
+      || !readCache(cacheFile, cacheKey, convertedSolutions)) {
+    convertedSolutions = characterize();
+    if (!cacheFile.empty()) {
+      writeCache(cacheFile, cacheKey, convertedSolutions);
+    }
+  }
+  compileLut(convertedSolutions);
+  if (logger_->debugCheck(CTS, "characterization", 3)) {
+    printCharacterization();
+    printSolution();
+  }
+}
+
+std::vector<TechChar::ResultData> TechChar::characterize()
+{
+  // Creates the new characterization block. (Wiresegments are created here
+  // instead of the main block)
+  odb::dbBlock* block = db_->getChip()->getBlock();
+  const char* characterizationBlockName = "CharacterizationBlock";
+  if (auto char_block = block->findChild(characterizationBlockName)) {
+    odb::dbBlock::destroy(char_block);
+  }
+  charBlock_ = odb::dbBlock::create(block, characterizationBlockName);
+
   long unsigned int topologiesCreated = 0;
   for (unsigned setupWirelength : wirelengthsToTest_) {
     // Creates the topologies for the current wirelength.
@@ -1678,15 +1709,178 @@ void TechChar::create()
     logger_->info(
         CTS, 39, "Number of created patterns = {}.", topologiesCreated);
   }
+  odb::dbBlock::destroy(charBlock_);
+  charBlock_ = nullptr;
   // Post-processing of the results.
-  const std::vector<ResultData> convertedSolutions
-      = characterizationPostProcess();
-  compileLut(convertedSolutions);
-  if (logger_->debugCheck(CTS, "characterization", 3)) {
-    printCharacterization();
-    printSolution();
+  return characterizationPostProcess();
+}
+
+// The cache key is a hash of everything the characterization depends on:
+// the analysis corner and its buffer liberty files, the clock wire RC and the
+// values to test.  It names the cache file and is stored in it.
+std::string TechChar::getCacheKey() const
+{
+  // FNV-1a, so the name is stable across builds and runs.
+  auto hashBytes = [](uint64_t hash, const char* data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+      hash = (hash ^ static_cast<unsigned char>(data[i])) * 1099511628211ULL;
+    }
+    return hash;
+  };
+  constexpr uint64_t hashBasis = 14695981039346656037ULL;
+
+  std::ostringstream key;
+  key << std::setprecision(std::numeric_limits<double>::max_digits10);
+  key << "cts_char_v2 " << resPerDBU_ << " " << capPerDBU_ << " "
+      << options_->getWireSegmentUnit() << " " << options_->getMaxCharSlew()
+      << " " << charSlewStepSize_ << " " << charCapStepSize_ << " "
+      << lengthUnit_ << " " << charBuf_->getName();
+  for (float value : wirelengthsToTest_) {
+    key << " w" << value;
+  }
+  for (float value : loadsToTest_) {
+    key << " l" << value;
+  }
+  for (float value : slewsToTest_) {
+    key << " s" << value;
+  }
+  // The characterization STA times the command corner, which may read its
+  // buffer models from other libraries than the default corner.
+  sta::Corner* corner = openSta_->cmdCorner();
+  key << " c" << corner->name();
+  std::set<std::string> libFiles;
+  for (const std::string& name : masterNames_) {
+    key << " " << name;
+    odb::dbMaster* master = db_->findMaster(name.c_str());
+    sta::LibertyCell* libCell
+        = db_network_->libertyCell(db_network_->dbToSta(master));
+    if (!libCell) {
+      continue;
+    }
+    libFiles.insert(libCell->libertyLibrary()->filename());
+    for (const sta::MinMax* minMax : sta::MinMax::range()) {
+      sta::LibertyCell* cornerCell
+          = libCell->cornerCell(corner->libertyIndex(minMax));
+      if (cornerCell) {
+        libFiles.insert(cornerCell->libertyLibrary()->filename());
+      }
+    }
   }
-  odb::dbBlock::destroy(charBlock_);
+  const std::string keyStr = key.str();
+  uint64_t hash = hashBytes(hashBasis, keyStr.data(), keyStr.size());
+
+  // The libraries are keyed by their contents only, in content order, so a
+  // copy of the same libraries at another path finds the same cache.
+  std::set<uint64_t> libHashes;
+  for (const std::string& libFile : libFiles) {
+    uint64_t libHash = hashBasis;
+    std::ifstream in(libFile, std::ios::binary);
+    char buffer[1 << 16];
+    while (in.read(buffer, sizeof(buffer)) || in.gcount() > 0) {
+      libHash = hashBytes(libHash, buffer, in.gcount());
+    }
+    libHashes.insert(libHash);
+  }
+  for (uint64_t libHash : libHashes) {
+    hash = hashBytes(
+        hash, reinterpret_cast<const char*>(&libHash), sizeof(libHash));
+  }
+
+  std::ostringstream hashStr;
+  hashStr << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return hashStr.str();
+}
+
+// Leaves the bounds and lutSols untouched unless the whole file is valid.
+bool TechChar::readCache(const std::string& file,
+                         const std::string& key,
+                         std::vector<ResultData>& lutSols)
+{
+  std::ifstream in(file);
+  if (!in) {
+    return false;
+  }
+
+  std::string header;
+  std::string fileKey;
+  unsigned minSlew = 0;
+  unsigned maxSlew = 0;
+  unsigned minCapacitance = 0;
+  unsigned maxCapacitance = 0;
+  unsigned minSegmentLength = 0;
+  unsigned maxSegmentLength = 0;
+  size_t count = 0;
+  in >> header >> fileKey;
+  if (!in || header != "cts_char_v2" || fileKey != key) {
+    return false;
+  }
+  in >> minSlew >> maxSlew >> minCapacitance >> maxCapacitance
+      >> minSegmentLength >> maxSegmentLength >> count;
+  if (!in) {
+    return false;
+  }
+
+  std::vector<ResultData> results;
+  for (size_t i = 0; i < count; i++) {
+    ResultData result;
+    size_t topologySize = 0;
+    in >> result.load >> result.inSlew >> result.wirelength >> result.pinSlew
+        >> result.pinArrival >> result.totalcap >> result.totalPower
+        >> result.isPureWire >> topologySize;
+    result.topology.resize(topologySize);
+    for (std::string& node : result.topology) {
+      in >> node;
+    }
+    if (!in) {
+      return false;
+    }
+    results.push_back(std::move(result));
+  }
+
+  minSlew_ = minSlew;
+  maxSlew_ = maxSlew;
+  minCapacitance_ = minCapacitance;
+  maxCapacitance_ = maxCapacitance;
+  minSegmentLength_ = minSegmentLength;
+  maxSegmentLength_ = maxSegmentLength;
+  lutSols = std::move(results);
+  logger_->info(CTS, 126, "Loaded characterization from {}.", file);
+  return true;
+}
+
+void TechChar::writeCache(const std::string& file,
+                          const std::string& key,
+                          const std::vector<ResultData>& lutSols) const
+{
+  std::error_code error;
+  std::filesystem::create_directories(options_->getCharCacheDir(), error);
+
+  // Write to a temporary file first so concurrent runs never see a
+  // partially written cache.
+  const std::string tmpFile = file + ".tmp" + std::to_string(getpid());
+  std::ofstream out(tmpFile);
+  out << std::setprecision(std::numeric_limits<float>::max_digits10);
+  out << "cts_char_v2 " << key << " " << minSlew_ << " " << maxSlew_ << " "
+      << minCapacitance_ << " " << maxCapacitance_ << " " << minSegmentLength_
+      << " " << maxSegmentLength_ << " " << lutSols.size() << "\n";
+  for (const ResultData& result : lutSols) {
+    out << result.load << " " << result.inSlew << " " << result.wirelength
+        << " " << result.pinSlew << " " << result.pinArrival << " "
+        << result.totalcap << " " << result.totalPower << " "
+        << result.isPureWire << " " << result.topology.size();
+    for (const std::string& node : result.topology) {
+      out << " " << node;
+    }
+    out << "\n";
+  }
+  out.close();
+
+  if (!out || std::rename(tmpFile.c_str(), file.c_str()) != 0) {
+    std::remove(tmpFile.c_str());
+    logger_->warn(CTS, 127, "Unable to write characterization cache {}.", file);
+    return;
+  }
+  debugPrint(logger_, CTS, "tech char", 1, "Wrote characterization {}.", file);
 }
 
 // Compute possible buffering solution combinations given #buffers and
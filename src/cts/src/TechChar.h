@@ -302,6 +302,14 @@ class TechChar
                           unsigned nodeIndex,
                           const std::string& newMasterName);
   std::vector<ResultData> characterizationPostProcess();
+  std::vector<ResultData> characterize();
+  std::string getCacheKey() const;
+  bool readCache(const std::string& file,
+                 const std::string& key,
+                 std::vector<ResultData>& lutSols);
+  void writeCache(const std::string& file,
+                  const std::string& key,
+                  const std::vector<ResultData>& lutSols) const;
   unsigned normalizeCharResults(float value,
                                 float iter,
                                 unsigned* min,
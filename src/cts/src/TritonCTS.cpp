@@ -807,6 +807,16 @@ void TritonCTS::populateTritonCTS()
   block_ = db_->getChip()->getBlock();
   options_->setDbUnits(block_->getDbUnitsPerMicron());
 
+  dummyLoadNames_.clear();
+  if (options_->dummyLoadEnabled()) {
+    for (odb::dbInst* inst : block_->getInsts()) {
+      const std::string name = inst->getName();
+      if (name.compare(0, 7, "clkload") == 0) {
+        dummyLoadNames_.addName(name);
+      }
+    }
+  }
+
   clearNumClocks();
 
   // Use dbSta to find all clock nets in the design.
@@ -1885,8 +1895,12 @@ ClockInst& TritonCTS::placeDummyCell(Clock& clockNet,
                    "No phyiscal master cell found for dummy cell {}.",
                    dummyCell->name());
   }
-  std::string cellName
-      = std::string("clkload") + std::to_string(dummyLoadIndex_++);
+  int nameIndex = 0;
+  const std::string cellName = dummyLoadNames_.makeName(
+      "clkload", nameIndex, [this](const std::string& name) {
+        return block_->findInst(name.c_str()) != nullptr;
+      });
+  dummyLoadIndex_++;
   dummyInst = odb::dbInst::create(block_, master, cellName.c_str());
   dummyInst->setSourceType(odb::dbSourceType::TIMING);
   dummyInst->setLocation(inst->getX(), inst->getY());
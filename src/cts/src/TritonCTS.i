@@ -120,6 +120,12 @@ set_metric_output(const char* file)
   getTritonCts()->getParms()->setMetricsFile(file);
 }
 
+void
+set_char_cache_dir(const char* dir)
+{
+  getTritonCts()->getParms()->setCharCacheDir(dir);
+}
+
 void
 set_debug_cmd()
 {
@@ -0,0 +1,19 @@
+# clock_tree_synthesis with an empty characterization cache writes it and
+# a second run loads it and builds the same tree
+source "helpers.tcl"
+
+set cache_dir [make_result_file cts_cache]
+file delete -force $cache_dir
+set ::env(CTS_CACHE_DIR) $cache_dir
+
+set def_files {}
+foreach run {1 2} {
+  set def_file [make_result_file cts_cache_$run.def]
+  set ::env(CTS_CACHE_DEF) $def_file
+  set log [exec [info nameofexecutable] -no_init -no_splash -exit \
+             cts_cache_run.tcl]
+  puts "run $run loaded characterization: [regexp {CTS-0126} $log]"
+  lappend def_files $def_file
+}
+
+diff_files [lindex $def_files 0] [lindex $def_files 1]
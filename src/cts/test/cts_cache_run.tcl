@@ -0,0 +1,16 @@
+# One clock_tree_synthesis run of cts_cache.tcl.
+source "helpers.tcl"
+read_lef Nangate45/Nangate45.lef
+read_liberty Nangate45/Nangate45_typ.lib
+read_def "16sinks.def"
+
+create_clock -period 5 clk
+
+set_wire_rc -clock -layer metal3
+
+configure_cts_characterization -cache_dir $::env(CTS_CACHE_DIR)
+clock_tree_synthesis -root_buf CLKBUF_X3 \
+  -buf_list CLKBUF_X3 \
+  -wire_unit 20
+
+write_def $::env(CTS_CACHE_DEF)
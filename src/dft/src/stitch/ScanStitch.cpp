@@ -5,9 +5,10 @@
 
 namespace {
 
-constexpr std::string_view kScanEnableNamePattern = "scan_enable_{}";
-constexpr std::string_view kScanInNamePattern = "scan_in_{}";
-constexpr std::string_view kScanOutNamePattern = "scan_out_{}";
+constexpr std::string_view kScanNamePrefix = "scan_";
+constexpr std::string_view kScanEnableNamePrefix = "scan_enable_";
+constexpr std::string_view kScanInNamePrefix = "scan_in_";
+constexpr std::string_view kScanOutNamePrefix = "scan_out_";
 
 }  // namespace
 
@@ -17,6 +18,18 @@ ScanStitch::ScanStitch(odb::dbDatabase* db) : db_(db)
 {
   odb::dbChip* chip = db_->getChip();
   top_block_ = chip->getBlock();
+
+  auto add_name = [this](const std::string& name) {
+    if (name.compare(0, kScanNamePrefix.size(), kScanNamePrefix) == 0) {
+      port_names_.addName(name);
+    }
+  };
+  for (odb::dbBTerm* bterm : top_block_->getBTerms()) {
+    add_name(bterm->getName());
+  }
+  for (odb::dbNet* net : top_block_->getNets()) {
+    add_name(net->getName());
+  }
 }
 
 void ScanStitch::Stitch(
@@ -104,14 +117,14 @@ ScanDriver ScanStitch::FindOrCreateScanEnable(odb::dbBlock* block)
 {
   // TODO: For now we will create a new scan_enable pin at the top level. We
   // need to support defining DFT signals for scan_enable
-  return CreateNewPort<ScanDriver>(block, kScanEnableNamePattern);
+  return CreateNewPort<ScanDriver>(block, kScanEnableNamePrefix);
 }
 
 ScanDriver ScanStitch::FindOrCreateScanIn(odb::dbBlock* block)
 {
   // TODO: For now we will create a new scan_in pin at the top level. We
   // need to support defining DFT signals for scan_in
-  return CreateNewPort<ScanDriver>(block, kScanInNamePattern);
+  return CreateNewPort<ScanDriver>(block, kScanInNamePrefix);
 }
 
 ScanLoad ScanStitch::FindOrCreateScanOut(odb::dbBlock* block,
@@ -134,7 +147,7 @@ ScanLoad ScanStitch::FindOrCreateScanOut(odb::dbBlock* block,
     }
   }
 
-  return CreateNewPort<ScanLoad>(block, kScanOutNamePattern);
+  return CreateNewPort<ScanLoad>(block, kScanOutNamePrefix);
 }
 
 }  // namespace dft
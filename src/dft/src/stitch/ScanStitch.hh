@@ -32,11 +32,13 @@
 #pragma once
 
 #include <optional>
+#include <string>
 #include <type_traits>
 #include <vector>
 
 #include "ScanChain.hh"
 #include "odb/db.h"
+#include "utl/NameAllocator.h"
 
 namespace dft {
 
@@ -65,34 +67,35 @@ class ScanStitch
 
   // Typesafe function to create Ports for the scan chains.
   template <typename Port>
-  Port CreateNewPort(odb::dbBlock* block, std::string_view name_pattern)
+  Port CreateNewPort(odb::dbBlock* block, std::string_view name_prefix)
   {
-    for (int port_number = 1;; ++port_number) {
-      std::string port_name
-          = fmt::format(FMT_RUNTIME(name_pattern), port_number);
-      odb::dbBTerm* port = block->findBTerm(port_name.c_str());
-      if (!port) {
-        odb::dbNet* net = odb::dbNet::create(block, port_name.c_str());
-        net->setSigType(odb::dbSigType::SCAN);
-        port = odb::dbBTerm::create(net, port_name.c_str());
-        port->setSigType(odb::dbSigType::SCAN);
+    // The port and its net share the name, so it must be free for both.
+    int port_number = 1;
+    const std::string port_name = port_names_.makeName(
+        name_prefix, port_number, [block](const std::string& name) {
+          return block->findBTerm(name.c_str()) != nullptr
+                 || block->findNet(name.c_str()) != nullptr;
+        });
+    odb::dbNet* net = odb::dbNet::create(block, port_name.c_str());
+    net->setSigType(odb::dbSigType::SCAN);
+    odb::dbBTerm* port = odb::dbBTerm::create(net, port_name.c_str());
+    port->setSigType(odb::dbSigType::SCAN);
 
-        if constexpr (std::is_same_v<Port, ScanLoad>) {
-          port->setIoType(odb::dbIoType::OUTPUT);
-        } else if constexpr (std::is_same_v<Port, ScanDriver>) {
-          port->setIoType(odb::dbIoType::INPUT);
-        } else {
-          static_assert(always_false_v<Port>,
-                        "Non-exhaustive cases for Port Type");
-        }
-
-        return Port(port);
-      }
+    if constexpr (std::is_same_v<Port, ScanLoad>) {
+      port->setIoType(odb::dbIoType::OUTPUT);
+    } else if constexpr (std::is_same_v<Port, ScanDriver>) {
+      port->setIoType(odb::dbIoType::INPUT);
+    } else {
+      static_assert(always_false_v<Port>, "Non-exhaustive cases for Port Type");
     }
+
+    return Port(port);
   }
 
   odb::dbDatabase* db_;
   odb::dbBlock* top_block_;
+  // Numbered scan port names already taken in top_block_
+  utl::NameAllocator port_names_;
 };
 
 }  // namespace dft
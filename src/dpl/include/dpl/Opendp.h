@@ -144,6 +144,7 @@ class Opendp
   void setPadding(dbMaster* master, int left, int right);
   void setPadding(dbInst* inst, int left, int right);
   void setDebug(std::unique_ptr<dpl::DplObserver>& observer);
+  void setNumThreads(int num_threads);
 
   // Global padding.
   int padGlobalLeft() const;
@@ -210,7 +211,14 @@ class Opendp
   bool checkOverlap(const Cell* cell, const DbuRect& rect) const;
   static bool isInside(const Rect& cell, const Rect& box);
   bool isInside(const Cell* cell, const Rect& rect) const;
-  PixelPt diamondSearch(const Cell* cell, GridX x, GridY y) const;
+  // search_ring returns the last diamond ring that was searched.
+  PixelPt diamondSearch(const Cell* cell,
+                        GridX x,
+                        GridY y,
+                        int* search_ring = nullptr) const;
+  Rect diamondSearchWindow(const Cell* cell,
+                           const GridPt& grid_pt,
+                           int search_ring) const;
   void diamondSearchSide(const Cell* cell,
                          GridX x,
                          GridY y,
@@ -255,6 +263,7 @@ class Opendp
   void prePlace();
   void prePlaceGroups();
   void place();
+  void placeParallel(const vector<Cell*>& cells);
   void placeGroups2();
   void brickPlace1(const Group* group);
   void brickPlace2(const Group* group);
@@ -262,7 +271,7 @@ class Opendp
   int anneal(Group* group);
   int refine();
   void setFixedGridCells();
-  void setGridCell(Cell& cell, Pixel* pixel);
+  void setGridCell(Cell& cell, Pixel* pixel, int grid_idx, GridX x, GridY y);
   void groupAssignCellRegions();
   void groupInitPixels();
   void groupInitPixels2();
@@ -361,6 +370,7 @@ class Opendp
   int max_displacement_y_ = 0;  // sites
   bool disallow_one_site_gaps_ = false;
   vector<Cell*> placement_failures_;
+  int num_threads_ = 1;
 
   // 3D pixel grid
   std::unique_ptr<Grid> grid_;
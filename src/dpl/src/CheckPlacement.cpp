@@ -383,16 +383,24 @@ const Cell* Opendp::checkOverlap(Cell& cell) const
   debugPrint(
       logger_, DPL, "grid", 2, "checking overlap for cell {}", cell.name());
   const Cell* overlap_cell = nullptr;
-  grid_->visitCellPixels(cell, true, [&](Pixel* pixel) {
-    const Cell* pixel_cell = pixel->cell;
-    if (pixel_cell) {
-      if (pixel_cell != &cell && overlap(&cell, pixel_cell)) {
-        overlap_cell = pixel_cell;
-      }
-    } else {
-      pixel->cell = &cell;
-    }
-  });
+  // Report the overlap with the largest x, then y, whatever the visit order.
+  GridX overlap_x{0};
+  GridY overlap_y{0};
+  grid_->visitCellPixels(
+      cell, true, [&](Pixel* pixel, int grid_idx, GridX x, GridY y) {
+        const Cell* pixel_cell = pixel->cell;
+        if (pixel_cell) {
+          if (pixel_cell != &cell && overlap(&cell, pixel_cell)
+              && (!overlap_cell || overlap_x < x
+                  || (x == overlap_x && !(y < overlap_y)))) {
+            overlap_cell = pixel_cell;
+            overlap_x = x;
+            overlap_y = y;
+          }
+        } else {
+          grid_->setPixelCell(grid_idx, x, y, &cell);
+        }
+      });
   return overlap_cell;
 }
 
@@ -143,7 +143,9 @@ void Opendp::setGridCells()
 {
   for (Cell& cell : cells_) {
     grid_->visitCellPixels(
-        cell, false, [&](Pixel* pixel) { setGridCell(cell, pixel); });
+        cell, false, [&](Pixel* pixel, int grid_idx, GridX x, GridY y) {
+          setGridCell(cell, pixel, grid_idx, x, y);
+        });
   }
 }
 
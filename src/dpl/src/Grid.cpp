@@ -329,18 +329,14 @@ void Grid::initGrid(dbDatabase* db,
   // Make pixel grid
   if (pixels_.empty()) {
     resize(getInfoMap().size());
-    for (auto& [gmk, grid_info] : getInfoMap()) {
-      resize(grid_info.getGridIndex(), grid_info.getRowCount());
-    }
   }
 
   for (auto& [gmk, grid_info] : getInfoMap()) {
     const GridY layer_row_count = grid_info.getRowCount();
     const GridX layer_row_site_count = grid_info.getSiteCount();
     const int index = grid_info.getGridIndex();
-    resize(index, layer_row_count);
+    resize(index, layer_row_count, layer_row_site_count);
     for (GridY j{0}; j < layer_row_count; j++) {
-      resize(index, j, layer_row_site_count);
       const auto& grid_sites = grid_info.getSites();
       dbSite* row_site = nullptr;
       if (!grid_sites.empty()) {
@@ -348,7 +344,7 @@ void Grid::initGrid(dbDatabase* db,
       }
 
       for (GridX k{0}; k < layer_row_site_count; k++) {
-        Pixel& pixel = pixels_[index][j.v][k.v];
+        Pixel& pixel = this->pixel(index, j, k);
         pixel.cell = nullptr;
         pixel.group = nullptr;
         pixel.util = 0.0;
@@ -446,7 +442,7 @@ void Grid::initGrid(dbDatabase* db,
     for (const auto& rect : rects) {
       for (int y = gtl::yl(rect); y < gtl::yh(rect); y++) {
         for (int x = gtl::xl(rect); x < gtl::xh(rect); x++) {
-          Pixel& pixel = pixels_[h_index][y][x];
+          Pixel& pixel = this->pixel(h_index, GridY{y}, GridX{x});
           pixel.is_hopeless = true;
         }
       }
@@ -462,15 +458,77 @@ Pixel* Grid::gridPixel(int grid_idx, GridX grid_x, GridY grid_y) const
   const GridInfo* grid_info = grid_info_vector_[grid_idx];
   if (grid_x >= 0 && grid_x < grid_info->getSiteCount() && grid_y >= 0
       && grid_y < grid_info->getRowCount()) {
-    return const_cast<Pixel*>(&pixels_[grid_idx][grid_y.v][grid_x.v]);
+    return const_cast<Pixel*>(&pixel(grid_idx, grid_y, grid_x));
   }
   return nullptr;
 }
 
-void Grid::visitCellPixels(
-    Cell& cell,
-    bool padded,
-    const std::function<void(Pixel* pixel)>& visitor) const
+void Grid::resize(int size)
+{
+  pixels_.resize(size);
+  pixel_row_size_.resize(size, 0);
+  occupancy_.resize(size);
+  occupancy_row_words_.resize(size, 0);
+}
+
+void Grid::resize(int g, GridY row_count, GridX site_count)
+{
+  const int words = (site_count.v + 63) / 64;
+  pixels_[g].resize(static_cast<size_t>(row_count.v) * site_count.v);
+  pixel_row_size_[g] = site_count.v;
+  occupancy_[g].assign(static_cast<size_t>(row_count.v) * words, 0);
+  occupancy_row_words_[g] = words;
+}
+
+void Grid::clear()
+{
+  pixels_.clear();
+  pixel_row_size_.clear();
+  occupancy_.clear();
+  occupancy_row_words_.clear();
+}
+
+void Grid::setPixelCell(int g, GridX x, GridY y, Cell* cell)
+{
+  pixel(g, y, x).cell = cell;
+  uint64_t& word = occupancy_[g][y.v * occupancy_row_words_[g] + x.v / 64];
+  const uint64_t bit = uint64_t{1} << (x.v % 64);
+  if (cell) {
+    word |= bit;
+  } else {
+    word &= ~bit;
+  }
+}
+
+bool Grid::isSpanFree(int g, GridY y, GridX x, GridX x_end) const
+{
+  if (g < 0 || g >= pixels_.size() || y < 0
+      || y >= grid_info_vector_[g]->getRowCount() || x < 0
+      || x_end > grid_info_vector_[g]->getSiteCount()) {
+    return false;
+  }
+  const uint64_t* row = &occupancy_[g][y.v * occupancy_row_words_[g]];
+  int begin = x.v;
+  const int end = x_end.v;
+  while (begin < end) {
+    const int word = begin / 64;
+    const int lo = begin % 64;
+    const int hi = std::min(64, end - word * 64);
+    uint64_t mask = ~uint64_t{0} << lo;
+    if (hi < 64) {
+      mask &= (uint64_t{1} << hi) - 1;
+    }
+    if (row[word] & mask) {
+      return false;
+    }
+    begin = (word + 1) * 64;
+  }
+  return true;
+}
+
+void Grid::cellPixelRects(const Cell& cell,
+                          bool padded,
+                          GridRects& rects) const
 {
   dbInst* inst = cell.db_inst_;
   auto obstructions = inst->getMaster()->getObstructions();
@@ -501,14 +559,7 @@ void Grid::visitCellPixels(
         if (layer_y_end == layer_y_start) {
           ++layer_y_end;
         }
-        for (GridX x = x_start; x < x_end; x++) {
-          for (GridY y{layer_y_start}; y < layer_y_end; y++) {
-            Pixel* pixel = gridPixel(grid_idx, x, y);
-            if (pixel) {
-              visitor(pixel);
-            }
-          }
-        }
+        rects.push_back({grid_idx, x_start, x_end, layer_y_start, layer_y_end});
         grid_idx++;
       }
     }
@@ -532,57 +583,24 @@ void Grid::visitCellPixels(
       if (layer_x_end == layer_x_start) {
         ++layer_x_end;
       }
-
-      for (GridX x{layer_x_start}; x < layer_x_end; x++) {
-        for (GridY y{layer_y_start}; y < layer_y_end; y++) {
-          Pixel* pixel = gridPixel(layer_it.second.getGridIndex(), x, y);
-          if (pixel) {
-            visitor(pixel);
-          }
-        }
-      }
+      rects.push_back({layer_it.second.getGridIndex(),
+                       layer_x_start,
+                       layer_x_end,
+                       layer_y_start,
+                       layer_y_end});
     }
   }
 }
 
-void Grid::visitCellBoundaryPixels(
-    Cell& cell,
-    bool padded,
-    const std::function<
-        void(Pixel* pixel, odb::Direction2D edge, GridX x, GridY y)>& visitor)
-    const
+void Grid::cellBoundaryRects(const Cell& cell,
+                             bool padded,
+                             GridRects& rects) const
 {
   dbInst* inst = cell.db_inst_;
   const GridMapKey& gmk = getGridMapKey(&cell);
   GridInfo grid_info = getInfoMap().at(gmk);
   const int index_in_grid = grid_info.getGridIndex();
 
-  auto visit = [&visitor, index_in_grid, this](const GridX x_start,
-                                               const GridX x_end,
-                                               const GridY y_start,
-                                               const GridY y_end) {
-    for (GridX x = x_start; x < x_end; x++) {
-      Pixel* pixel = gridPixel(index_in_grid, x, y_start);
-      if (pixel) {
-        visitor(pixel, odb::Direction2D::North, x, y_start);
-      }
-      pixel = gridPixel(index_in_grid, x, y_end - 1);
-      if (pixel) {
-        visitor(pixel, odb::Direction2D::South, x, y_end - 1);
-      }
-    }
-    for (GridY y = y_start; y < y_end; y++) {
-      Pixel* pixel = gridPixel(index_in_grid, x_start, y);
-      if (pixel) {
-        visitor(pixel, odb::Direction2D::West, x_start, y);
-      }
-      pixel = gridPixel(index_in_grid, x_end - 1, y);
-      if (pixel) {
-        visitor(pixel, odb::Direction2D::East, x_end - 1, y);
-      }
-    }
-  };
-
   dbMaster* master = inst->getMaster();
   auto obstructions = master->getObstructions();
   bool have_obstructions = false;
@@ -599,7 +617,7 @@ void Grid::visitCellBoundaryPixels(
       GridX x_end = gridEndX(DbuX{rect.xMax() - core.xMin()});
       GridY y_start = gridY(DbuY{rect.yMin() - core.yMin()}, grid_info).first;
       GridY y_end = gridEndY(DbuY{rect.yMax() - core.yMin()}, grid_info).first;
-      visit(x_start, x_end, y_start, y_end);
+      rects.push_back({index_in_grid, x_start, x_end, y_start, y_end});
     }
   }
   if (!have_obstructions) {
@@ -617,7 +635,7 @@ void Grid::visitCellBoundaryPixels(
                y_start,
                y_end);
 
-    visit(x_start, x_end, y_start, y_end);
+    rects.push_back({index_in_grid, x_start, x_end, y_start, y_end});
   }
 }
 
@@ -656,11 +674,12 @@ void Grid::erasePixel(Cell* cell)
 
       for (GridX x = gridPaddedX(cell); x < x_end; x++) {
         for (GridY y = layer_y_start; y < layer_y_end; y++) {
-          Pixel* pixel = gridPixel(target_grid_info.getGridIndex(), x, y);
+          const int grid_idx = target_grid_info.getGridIndex();
+          Pixel* pixel = gridPixel(grid_idx, x, y);
           if (nullptr == pixel) {
             continue;
           }
-          pixel->cell = nullptr;
+          setPixelCell(grid_idx, x, y, nullptr);
           pixel->util = 0;
         }
       }
@@ -737,7 +756,7 @@ void Grid::paintPixel(Cell* cell, GridX grid_x, GridY grid_y)
         logger_->error(
             DPL, 13, "Cannot paint grid because it is already occupied.");
       } else {
-        pixel->cell = cell;
+        setPixelCell(index_in_grid, x, y, cell);
         pixel->util = 1.0;
       }
     }
@@ -794,7 +813,7 @@ void Grid::paintPixel(Cell* cell, GridX grid_x, GridY grid_y)
           }
         }
         if (pixel) {
-          pixel->cell = cell;
+          setPixelCell(layer.second.getGridIndex(), x, y, cell);
           pixel->util = 1.0;
         }
       }
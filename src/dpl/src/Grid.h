@@ -39,7 +39,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <boost/container/small_vector.hpp>
+#include <cstdint>
 #include <unordered_set>
+#include <vector>
 
 #include "Coordinates.h"
 #include "dpl/Opendp.h"
@@ -111,6 +115,20 @@ class GridInfo
   const dbSite::RowPattern sites_;
 };
 
+// A rectangle of pixels [xl, xh) x [yl, yh) on one grid.
+struct GridRect
+{
+  int grid_idx;
+  GridX xl;
+  GridX xh;
+  GridY yl;
+  GridY yh;
+};
+
+// A cell covers one rect per obstruction and grid, usually just one, so
+// these live on the stack of the visiting call.
+using GridRects = boost::container::small_vector<GridRect, 4>;
+
 struct GridMapKey
 {
   int grid_index{0};
@@ -128,6 +146,7 @@ struct GridMapKey
 // multi-height cells. Each unique row height creates a new grid that is used in
 // legalization. The first index is the grid index (corresponding to row
 // height), second index is the row index, and third index is the site index.
+// The pixels of each grid are stored contiguously in row-major order.
 class Grid
 {
  public:
@@ -163,15 +182,16 @@ class Grid
 
   void paintPixel(Cell* cell, GridX grid_x, GridY grid_y);
   void erasePixel(Cell* cell);
-  void visitCellPixels(Cell& cell,
-                       bool padded,
-                       const std::function<void(Pixel* pixel)>& visitor) const;
-  void visitCellBoundaryPixels(
-      Cell& cell,
-      bool padded,
-      const std::function<
-          void(Pixel* pixel, odb::Direction2D edge, GridX x, GridY y)>& visitor)
-      const;
+  // Visitor is called as
+  // visitor(Pixel* pixel, int grid_idx, GridX x, GridY y).
+  template <typename Visitor>
+  void visitCellPixels(Cell& cell, bool padded, Visitor&& visitor) const;
+  // Visitor is called as
+  // visitor(Pixel* pixel, odb::Direction2D edge, GridX x, GridY y).
+  template <typename Visitor>
+  void visitCellBoundaryPixels(Cell& cell,
+                               bool padded,
+                               Visitor&& visitor) const;
 
   GridY getRowCount() const { return row_count_; }
   GridX getRowSiteCount() const { return row_site_count_; }
@@ -184,16 +204,24 @@ class Grid
                          bool start) const;
 
   Pixel* gridPixel(int grid_idx, GridX x, GridY y) const;
-  Pixel& pixel(int g, GridY y, GridX x) { return pixels_[g][y.v][x.v]; }
+  Pixel& pixel(int g, GridY y, GridX x)
+  {
+    return pixels_[g][y.v * pixel_row_size_[g] + x.v];
+  }
   const Pixel& pixel(int g, GridY y, GridX x) const
   {
-    return pixels_[g][y.v][x.v];
+    return pixels_[g][y.v * pixel_row_size_[g] + x.v];
   }
+  // Set the cell occupying pixel (x, y) of grid g. All writes of Pixel::cell
+  // go through here so the occupancy bits stay in sync.
+  void setPixelCell(int g, GridX x, GridY y, Cell* cell);
+  // True if no pixel in [x, x_end) of row y of grid g holds a cell.
+  // Spans outside of the grid are never free.
+  bool isSpanFree(int g, GridY y, GridX x, GridX x_end) const;
 
-  void resize(int size) { pixels_.resize(size); }
-  void resize(int g, GridY size) { pixels_[g].resize(size.v); }
-  void resize(int g, GridY y, GridX size) { pixels_[g][y.v].resize(size.v); }
-  void clear() { pixels_.clear(); }
+  void resize(int size);
+  void resize(int g, GridY row_count, GridX site_count);
+  void clear();
 
   GridInfo& infoMap(const GridMapKey& key) { return grid_info_map_.at(key); }
   const GridInfo& infoMap(const GridMapKey& key) const
@@ -225,11 +253,23 @@ class Grid
   void addInfoMap(const GridMapKey& key, const GridInfo& info);
   void visitDbRows(dbBlock* block,
                    const std::function<void(odb::dbRow*)>& func) const;
+  void cellPixelRects(const Cell& cell,
+                      bool padded,
+                      GridRects& rects) const;
+  void cellBoundaryRects(const Cell& cell,
+                         bool padded,
+                         GridRects& rects) const;
 
   Logger* logger_ = nullptr;
   dbBlock* block_ = nullptr;
   std::shared_ptr<Padding> padding_;
-  std::vector<std::vector<std::vector<Pixel>>> pixels_;
+  std::vector<std::vector<Pixel>> pixels_;
+  // Site count of each grid, the row stride of pixels_.
+  std::vector<int> pixel_row_size_;
+  // One bit per pixel, set when Pixel::cell is not null. Each row is padded
+  // to a whole number of 64 bit words.
+  std::vector<std::vector<uint64_t>> occupancy_;
+  std::vector<int> occupancy_row_words_;
   std::vector<const GridInfo*> grid_info_vector_;
   map<GridMapKey, GridInfo> grid_info_map_;
   std::unordered_map<dbSite*, dbSite*> hybrid_parent_;  // child -> parent
@@ -249,4 +289,62 @@ class Grid
   GridX row_site_count_{0};
 };
 
+template <typename Visitor>
+void Grid::visitCellPixels(Cell& cell, bool padded, Visitor&& visitor) const
+{
+  GridRects rects;
+  cellPixelRects(cell, padded, rects);
+  for (const GridRect& rect : rects) {
+    if (rect.grid_idx < 0 || rect.grid_idx >= pixels_.size()) {
+      continue;
+    }
+    const GridInfo* grid_info = grid_info_vector_[rect.grid_idx];
+    const GridX xl = std::max(GridX{0}, rect.xl);
+    const GridX xh = std::min(grid_info->getSiteCount(), rect.xh);
+    const GridY yl = std::max(GridY{0}, rect.yl);
+    const GridY yh = std::min(grid_info->getRowCount(), rect.yh);
+    const int row_size = pixel_row_size_[rect.grid_idx];
+    Pixel* pixels = const_cast<Pixel*>(pixels_[rect.grid_idx].data());
+    // The pixels are stored row-major, so walk each row contiguously.
+    for (GridY y = yl; y < yh; y++) {
+      Pixel* row = &pixels[y.v * row_size];
+      for (GridX x = xl; x < xh; x++) {
+        visitor(&row[x.v], rect.grid_idx, x, y);
+      }
+    }
+  }
+}
+
+template <typename Visitor>
+void Grid::visitCellBoundaryPixels(Cell& cell,
+                                   bool padded,
+                                   Visitor&& visitor) const
+{
+  GridRects rects;
+  cellBoundaryRects(cell, padded, rects);
+  for (const GridRect& rect : rects) {
+    const int grid_idx = rect.grid_idx;
+    for (GridX x = rect.xl; x < rect.xh; x++) {
+      Pixel* pixel = gridPixel(grid_idx, x, rect.yl);
+      if (pixel) {
+        visitor(pixel, odb::Direction2D::North, x, rect.yl);
+      }
+      pixel = gridPixel(grid_idx, x, rect.yh - 1);
+      if (pixel) {
+        visitor(pixel, odb::Direction2D::South, x, rect.yh - 1);
+      }
+    }
+    for (GridY y = rect.yl; y < rect.yh; y++) {
+      Pixel* pixel = gridPixel(grid_idx, rect.xl, y);
+      if (pixel) {
+        visitor(pixel, odb::Direction2D::West, rect.xl, y);
+      }
+      pixel = gridPixel(grid_idx, rect.xh - 1, y);
+      if (pixel) {
+        visitor(pixel, odb::Direction2D::East, rect.xh - 1, y);
+      }
+    }
+  }
+}
+
 }  // namespace dpl
@@ -113,6 +113,11 @@ void Opendp::setDebug(std::unique_ptr<DplObserver>& observer)
   debug_observer_ = std::move(observer);
 }
 
+void Opendp::setNumThreads(int num_threads)
+{
+  num_threads_ = std::max(1, num_threads);
+}
+
 void Opendp::detailedPlacement(const int max_displacement_x,
                                const int max_displacement_y,
                                const std::string& report_file_name,
@@ -298,14 +303,20 @@ void Opendp::setFixedGridCells()
   for (Cell& cell : cells_) {
     if (cell.isFixed()) {
       grid_->visitCellPixels(
-          cell, true, [&](Pixel* pixel) { setGridCell(cell, pixel); });
+          cell, true, [&](Pixel* pixel, int grid_idx, GridX x, GridY y) {
+            setGridCell(cell, pixel, grid_idx, x, y);
+          });
     }
   }
 }
 
-void Opendp::setGridCell(Cell& cell, Pixel* pixel)
+void Opendp::setGridCell(Cell& cell,
+                         Pixel* pixel,
+                         int grid_idx,
+                         GridX x,
+                         GridY y)
 {
-  pixel->cell = &cell;
+  grid_->setPixelCell(grid_idx, x, y, &cell);
   pixel->util = 1.0;
   if ((&cell)->isBlock()) {
     // Try the is_hopeless strategy to get off of a block
@@ -379,7 +390,8 @@ void Opendp::groupInitPixels2()
           for (Rect& rect : group.region_boundaries) {
             if (!isInside(sub, rect) && checkOverlap(sub, rect)) {
               pixel->util = 0.0;
-              pixel->cell = dummy_cell_.get();
+              grid_->setPixelCell(
+                  grid_info.getGridIndex(), x, y, dummy_cell_.get());
               pixel->is_valid = false;
             }
           }
@@ -473,7 +485,7 @@ void Opendp::groupInitPixels()
             pixel->is_valid = true;
             pixel->util = 1.0;
           } else if (pixel->util > 0.0 && pixel->util < 1.0) {
-            pixel->cell = dummy_cell_.get();
+            grid_->setPixelCell(grid_index, l, k, dummy_cell_.get());
             pixel->util = 0.0;
             pixel->is_valid = false;
           }
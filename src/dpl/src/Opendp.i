@@ -100,6 +100,7 @@ detailed_placement_cmd(int max_displacment_x,
                        bool disallow_one_site_gaps,
                        const char* report_file_name){
   dpl::Opendp *opendp = ord::OpenRoad::openRoad()->getOpendp();
+  opendp->setNumThreads(ord::OpenRoad::openRoad()->getThreadCount());
   opendp->detailedPlacement(max_displacment_x, max_displacment_y, std::string(report_file_name), disallow_one_site_gaps);
 }
 
@@ -49,6 +49,7 @@
 #include "Padding.h"
 #include "dpl/Opendp.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 // #define ODP_DEBUG
 
@@ -343,6 +344,19 @@ void Opendp::place()
       }
     }
   }
+  // The parallel search assumes all cells share a single row grid.
+  if (num_threads_ > 1 && debug_observer_ == nullptr
+      && grid_->getInfoMap().size() == 1) {
+    vector<Cell*> single_row_cells;
+    single_row_cells.reserve(sorted_cells.size());
+    for (Cell* cell : sorted_cells) {
+      if (!isMultiRow(cell)) {
+        single_row_cells.push_back(cell);
+      }
+    }
+    placeParallel(single_row_cells);
+    return;
+  }
   for (Cell* cell : sorted_cells) {
     if (!isMultiRow(cell)) {
       if (!mapMove(cell)) {
@@ -352,6 +366,90 @@ void Opendp::place()
   }
 }
 
+// Cells are diamond searched in parallel batches against the same grid and
+// then committed in placement order. A search result is only used if no cell
+// committed earlier in the batch overlaps the pixels the search examined, so
+// the placement is identical to the serial one. Conflicting cells are
+// searched again serially. A shift move can displace any cell so the next
+// batch starts after it.
+void Opendp::placeParallel(const vector<Cell*>& cells)
+{
+  struct Search
+  {
+    PixelPt pixel_pt;
+    Rect window;
+  };
+
+  const int max_batch = 16 * num_threads_;
+  vector<Search> searches;
+  vector<Rect> committed;
+  int batch_count = 0;
+  int serial_count = 0;
+  int begin = 0;
+  while (begin < cells.size()) {
+    const int end = min(static_cast<int>(cells.size()), begin + max_batch);
+    searches.resize(end - begin);
+    utl::ThreadException exception;
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+    for (int i = begin; i < end; i++) {  // NOLINT
+      try {
+        const Cell* cell = cells[i];
+        const GridPt grid_pt = legalGridPt(cell, true);
+        int search_ring = 0;
+        Search& search = searches[i - begin];
+        search.pixel_pt
+            = diamondSearch(cell, grid_pt.x, grid_pt.y, &search_ring);
+        search.window = diamondSearchWindow(cell, grid_pt, search_ring);
+      } catch (...) {
+        exception.capture();
+      }
+    }
+    exception.rethrow();
+    batch_count++;
+
+    committed.clear();
+    int next = end;
+    for (int i = begin; i < end; i++) {
+      Cell* cell = cells[i];
+      const Search& search = searches[i - begin];
+      bool valid = true;
+      for (const Rect& rect : committed) {
+        if (rect.overlaps(search.window)) {
+          valid = false;
+          break;
+        }
+      }
+      GridPt placed;
+      if (valid && search.pixel_pt.pixel) {
+        grid_->paintPixel(cell, search.pixel_pt.x, search.pixel_pt.y);
+        placed = GridPt(search.pixel_pt.x, search.pixel_pt.y);
+      } else {
+        serial_count++;
+        if (!valid && mapMove(cell)) {
+          placed = GridPt(grid_->gridPaddedX(cell), grid_->gridY(cell));
+        } else {
+          shiftMove(cell);
+          next = i + 1;
+          break;
+        }
+      }
+      committed.emplace_back(placed.x.v,
+                             placed.y.v,
+                             (placed.x + grid_->gridPaddedWidth(cell)).v,
+                             (placed.y + grid_->gridHeight(cell)).v);
+    }
+    begin = next;
+  }
+  debugPrint(logger_,
+             DPL,
+             "place",
+             1,
+             "Parallel placement of {} cells in {} batches, {} placed serially",
+             cells.size(),
+             batch_count,
+             serial_count);
+}
+
 void Opendp::placeGroups2()
 {
   for (Group& group : groups_) {
@@ -708,8 +806,12 @@ int Opendp::distChange(const Cell* cell, const DbuX x, const DbuY y) const
 
 PixelPt Opendp::diamondSearch(const Cell* cell,
                               const GridX x,
-                              const GridY y) const
+                              const GridY y,
+                              int* search_ring) const
 {
+  if (search_ring) {
+    *search_ring = 0;
+  }
   // Diamond search limits.
   GridX x_min = x - max_displacement_x_;
   GridX x_max = x + max_displacement_x_;
@@ -771,6 +873,9 @@ PixelPt Opendp::diamondSearch(const Cell* cell,
 
   const int max_i = std::max(scaled_max_displacement_y.v, max_displacement_x_);
   for (int i = 1; i < max_i; i++) {
+    if (search_ring) {
+      *search_ring = i;
+    }
     PixelPt best_pt;
     int best_dist = 0;
     // left side
@@ -825,6 +930,20 @@ PixelPt Opendp::diamondSearch(const Cell* cell,
   return PixelPt();
 }
 
+// Bounding box of the pixels read by a diamond search that stopped at
+// search_ring, including the one site gap checks around each candidate.
+Rect Opendp::diamondSearchWindow(const Cell* cell,
+                                 const GridPt& grid_pt,
+                                 const int search_ring) const
+{
+  const int x_reach = (search_ring + 1) * bin_search_width_;
+  const GridX x_min = grid_pt.x - x_reach - 2;
+  const GridX x_max = grid_pt.x + x_reach + grid_->gridPaddedWidth(cell) + 2;
+  const GridY y_min = grid_pt.y - search_ring - 1;
+  const GridY y_max = grid_pt.y + search_ring + grid_->gridHeight(cell) + 1;
+  return Rect(x_min.v, y_min.v, x_max.v, y_max.v);
+}
+
 void Opendp::diamondSearchSide(const Cell* cell,
                                const GridX x,
                                const GridY y,
@@ -998,6 +1117,9 @@ bool Opendp::checkPixels(const Cell* cell,
   const auto cell_site = cell->getSite();
   const int layer = row_info.second.getGridIndex();
   for (GridY y1 = y; y1 < y_end; y1++) {
+    if (!grid_->isSpanFree(layer, y1, x, x_end)) {
+      return false;
+    }
     for (GridX x1 = x; x1 < x_end; x1++) {
       const Pixel* pixel = grid_->gridPixel(layer, x1, y1);
       if (pixel == nullptr || pixel->cell || !pixel->is_valid
@@ -0,0 +1,11 @@
+# aes with 4 threads must legalize the same as the single-threaded aes
+source "helpers.tcl"
+read_lef Nangate45/Nangate45.lef
+read_def aes_cipher_top_replace.def
+set_thread_count 4
+detailed_placement
+check_placement
+
+set def_file [make_result_file aes_threads.def]
+write_def $def_file
+diff_file aes.defok $def_file
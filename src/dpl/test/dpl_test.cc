@@ -1,7 +1,11 @@
 #include <unistd.h>
 
 #include <memory>
+#include <string>
 
+#include "Grid.h"
+#include "Objects.h"
+#include "Padding.h"
 #include "dpl/Opendp.h"
 #include "gtest/gtest.h"
 #include "odb/db.h"
@@ -43,4 +47,56 @@ class OpendpTest : public ::testing::Test
   OdbUniquePtr<odb::dbBlock> block_{nullptr, &odb::dbBlock::destroy};
 };
 
+TEST_F(OpendpTest, IsSpanFreeMatchesPixelCells)
+{
+  // Arrange
+  // Two rows of 200 sites, so a row spans four 64 bit occupancy words.
+  odb::dbSite* site = odb::dbSite::create(lib_.get(), "test_site");
+  site->setWidth(100);
+  site->setHeight(1000);
+  site->setClass(odb::dbSiteClass::CORE);
+  constexpr int site_count = 200;
+  block_->setDieArea(odb::Rect(0, 0, site_count * 100, 2000));
+  for (int row = 0; row < 2; row++) {
+    odb::dbRow::create(block_.get(),
+                       ("row" + std::to_string(row)).c_str(),
+                       site,
+                       0,
+                       row * 1000,
+                       odb::dbOrientType::R0,
+                       odb::dbRowDir::HORIZONTAL,
+                       site_count,
+                       100);
+  }
+
+  Grid grid;
+  grid.init(&logger_);
+  grid.initBlock(block_.get());
+  grid.examineRows(block_.get());
+  grid.initGrid(db_.get(), block_.get(), std::make_shared<Padding>(), 0, 0);
+
+  Cell cell;
+  for (int x : {0, 63, 64, 127, 130, 199}) {
+    grid.setPixelCell(0, GridX{x}, GridY{0}, &cell);
+  }
+  grid.setPixelCell(0, GridX{64}, GridY{0}, nullptr);
+
+  // Act & Assert
+  for (int y = 0; y < 2; y++) {
+    for (int x = 0; x < site_count; x++) {
+      bool free = true;
+      for (int x_end = x + 1; x_end <= site_count; x_end++) {
+        const Pixel& last = grid.pixel(0, GridY{y}, GridX{x_end - 1});
+        free = free && last.cell == nullptr;
+        EXPECT_EQ(grid.isSpanFree(0, GridY{y}, GridX{x}, GridX{x_end}), free)
+            << "row " << y << " span [" << x << ", " << x_end << ")";
+      }
+    }
+  }
+  EXPECT_FALSE(
+      grid.isSpanFree(0, GridY{1}, GridX{190}, GridX{site_count + 1}));
+  EXPECT_FALSE(grid.isSpanFree(0, GridY{2}, GridX{0}, GridX{1}));
+  EXPECT_FALSE(grid.isSpanFree(1, GridY{0}, GridX{0}, GridX{1}));
+}
+
 }  // namespace dpl
@@ -1,5 +1,6 @@
 record_tests {
   aes
+  aes_threads
   cell_on_block1
   cell_on_block2
   check1
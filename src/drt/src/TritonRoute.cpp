@@ -1345,6 +1345,7 @@ void TritonRoute::setParams(const ParamStruct& params)
   }
   SAVE_GUIDE_UPDATES = params.saveGuideUpdates;
   REPAIR_PDN_LAYER_NAME = params.repairPDNLayerName;
+  MARKER_DRIVEN_DR = params.markerDriven;
 }
 
 void TritonRoute::addWorkerResults(
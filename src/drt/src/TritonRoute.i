@@ -95,7 +95,8 @@ void detailed_route_cmd(const char* outputMazeFile,
                         int minAccessPoints,
                         bool saveGuideUpdates,
                         const char* repairPDNLayerName,
-                        int drcReportIterStep)
+                        int drcReportIterStep,
+                        bool markerDriven)
 {
   auto* router = ord::OpenRoad::openRoad()->getTritonRoute();
   std::optional<int> drcReportIterStepOpt;
@@ -122,7 +123,8 @@ void detailed_route_cmd(const char* outputMazeFile,
                     singleStepDR,
                     minAccessPoints,
                     saveGuideUpdates,
-                    repairPDNLayerName});
+                    repairPDNLayerName,
+                    markerDriven});
   router->main();
   router->setDistributed(false);
 }
@@ -214,6 +214,12 @@ int FlexDRWorker::main(frDesign* design)
                     routeBox_.xMax() * micronPerDBU,
                     routeBox_.yMax() * micronPerDBU);
   }
+  // Neighboring workers may commit while this one routes, but not while it
+  // reads the design.
+  std::shared_lock<FlexDRDesignLock> design_lock;
+  if (design_lock_) {
+    design_lock = std::shared_lock<FlexDRDesignLock>(*design_lock_);
+  }
   initMarkers(design);
   if (getDRIter() && getInitNumMarkers() == 0 && !needRecheck_) {
     skipRouting_ = true;
@@ -265,6 +271,9 @@ int FlexDRWorker::main(frDesign* design)
   if (!skipRouting_) {
     init(design);
   }
+  if (design_lock) {
+    design_lock.unlock();
+  }
   high_resolution_clock::time_point t1 = high_resolution_clock::now();
   if (!skipRouting_) {
     route_queue();
@@ -556,6 +565,112 @@ void FlexDR::getBatchInfo(int& batchStepX, int& batchStepY)
   batchStepY = 2;
 }
 
+void FlexDR::processWorkers(std::vector<std::unique_ptr<FlexDRWorker>>& workers,
+                            const int size,
+                            const int offset,
+                            const std::function<void()>& progress)
+{
+  ProfileTask profile("DR:processWorkers");
+  const int num_workers = workers.size();
+  auto gCellPatterns = getDesign()->getTopBlock()->getGCellPatterns();
+  auto& xgp = gCellPatterns.at(0);
+  auto& ygp = gCellPatterns.at(1);
+  const int cols = ((int) xgp.getCount() - 1 - offset) / size + 1;
+  const int rows = ((int) ygp.getCount() - 1 - offset) / size + 1;
+  auto getTile = [&](const FlexDRWorker* worker) {
+    const Rect& gcell_box = worker->getGCellBox();
+    return std::make_pair((gcell_box.xMin() - offset) / size,
+                          (gcell_box.yMin() - offset) / size);
+  };
+  std::vector<int> tile_worker(rows * cols, -1);
+  for (int i = 0; i < num_workers; i++) {
+    const auto [x, y] = getTile(workers[i].get());
+    tile_worker[x * rows + y] = i;
+  }
+
+  // A worker's ext box reaches into its neighbors' tiles. It has to wait for
+  // the neighbors that commit before it, and the neighbors that commit
+  // after it wait for it. Non-neighbors never see each other's changes.
+  std::vector<std::vector<int>> successors(num_workers);
+  std::vector<int> pending(num_workers, 0);
+  for (int i = 0; i < num_workers; i++) {
+    const auto [x, y] = getTile(workers[i].get());
+    for (int dx = -1; dx <= 1; dx++) {
+      for (int dy = -1; dy <= 1; dy++) {
+        const int nx = x + dx;
+        const int ny = y + dy;
+        if ((dx == 0 && dy == 0) || nx < 0 || nx >= cols || ny < 0
+            || ny >= rows) {
+          continue;
+        }
+        const int neighbor = tile_worker[nx * rows + ny];
+        if (neighbor > i) {
+          successors[i].push_back(neighbor);
+          pending[neighbor]++;
+        }
+      }
+    }
+  }
+
+  FlexDRDesignLock design_lock;
+  for (auto& worker : workers) {
+    worker->setDesignLock(&design_lock);
+    worker->setGridGraphPool(&graph_pool_);
+  }
+
+  // Workers run as soon as their dependencies are met but commit strictly
+  // in list order, so the result doesn't depend on thread timing.
+  std::mutex commit_mutex;
+  std::vector<char> routed(num_workers, false);
+  int next_commit = 0;
+  ThreadException exception;
+  std::function<void(int)> run = [&](const int idx) {
+    std::vector<int> ready;
+    try {
+      workers[idx]->main(getDesign());
+      std::lock_guard<std::mutex> lock(commit_mutex);
+      routed[idx] = true;
+      for (; next_commit < num_workers && routed[next_commit]; next_commit++) {
+        auto& worker = workers[next_commit];
+        {
+          ProfileTask profile("DR:end_batch");
+          std::unique_lock<FlexDRDesignLock> write(design_lock);
+          if (worker->end(getDesign())) {
+            numWorkUnits_ += 1;
+          }
+        }
+        if (worker->isCongested()) {
+          increaseClipsize_ = true;
+        }
+        worker.reset();
+        for (const int succ : successors[next_commit]) {
+          if (--pending[succ] == 0) {
+            ready.push_back(succ);
+          }
+        }
+        progress();
+      }
+    } catch (...) {
+      exception.capture();
+      return;
+    }
+    for (const int succ : ready) {
+#pragma omp task firstprivate(succ)
+      run(succ);
+    }
+  };
+
+#pragma omp parallel
+#pragma omp single
+  for (int i = 0; i < num_workers; i++) {
+    if (pending[i] == 0) {
+#pragma omp task firstprivate(i)
+      run(i);
+    }
+  }
+  exception.rethrow();
+}
+
 void FlexDR::searchRepair(const SearchRepairArgs& args)
 {
   const int iter = iter_++;
@@ -616,11 +731,16 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
   std::vector<std::vector<std::vector<std::unique_ptr<FlexDRWorker>>>> workers(
       batchStepX * batchStepY);
 
+  // Workers route nothing after iteration 1 unless their drc box holds a
+  // marker (recheck markers included), so in marker driven mode they are
+  // never built.
+  const bool markerDriven = MARKER_DRIVEN_DR && iter > 1;
+  int skipped = 0;
+  std::vector<frMarker*> markers;
+
   int xIdx = 0, yIdx = 0;
   for (int i = offset; i < (int) xgp.getCount(); i += size) {
     for (int j = offset; j < (int) ygp.getCount(); j += size) {
-      auto worker
-          = std::make_unique<FlexDRWorker>(&via_data_, design_, logger_);
       Rect routeBox1 = getDesign()->getTopBlock()->getGCellBox(Point(i, j));
       const int max_i = std::min((int) xgp.getCount() - 1, i + size - 1);
       const int max_j = std::min((int) ygp.getCount(), j + size - 1);
@@ -634,6 +754,17 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
       Rect drcBox;
       routeBox.bloat(MTSAFEDIST, extBox);
       routeBox.bloat(DRCSAFEDIST, drcBox);
+      if (markerDriven) {
+        markers.clear();
+        getRegionQuery()->queryMarker(drcBox, markers);
+        if (markers.empty()) {
+          skipped++;
+          yIdx++;
+          continue;
+        }
+      }
+      auto worker
+          = std::make_unique<FlexDRWorker>(&via_data_, design_, logger_);
       worker->setRouteBox(routeBox);
       worker->setExtBox(extBox);
       worker->setDrcBox(drcBox);
@@ -675,12 +806,44 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
     yIdx = 0;
     xIdx++;
   }
+  tot -= skipped;
+
+  auto progress = [&]() {
+    cnt++;
+    if (VERBOSE > 0) {
+      if (cnt * 1.0 / tot >= prev_perc / 100.0 + 0.1 && prev_perc < 90) {
+        if (prev_perc == 0 && t.isExceed(0)) {
+          isExceed = true;
+        }
+        prev_perc += 10;
+        if (isExceed) {
+          logger_->report("    Completing {}% with {} violations.",
+                          prev_perc,
+                          getDesign()->getTopBlock()->getNumMarkers());
+          logger_->report("    {}.", t);
+        }
+      }
+    }
+  };
 
   omp_set_num_threads(MAX_THREADS);
   int version = 0;
   increaseClipsize_ = false;
   numWorkUnits_ = 0;
-  // parallel execution
+  if (!dist_on_) {
+    // Keep the commit order of the checkerboard batches.
+    std::vector<std::unique_ptr<FlexDRWorker>> ordered;
+    for (auto& workerBatch : workers) {
+      for (auto& workersInBatch : workerBatch) {
+        for (auto& worker : workersInBatch) {
+          ordered.push_back(std::move(worker));
+        }
+      }
+    }
+    workers.clear();
+    processWorkers(ordered, size, offset, progress);
+  }
+  // distributed execution
   for (auto& workerBatch : workers) {
     ProfileTask profile("DR:checkerboard");
     for (auto& workersInBatch : workerBatch) {
@@ -712,25 +875,7 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
                 workersInBatch[i]->main(getDesign());
               }
 #pragma omp critical
-              {
-                cnt++;
-                if (VERBOSE > 0) {
-                  if (cnt * 1.0 / tot >= prev_perc / 100.0 + 0.1
-                      && prev_perc < 90) {
-                    if (prev_perc == 0 && t.isExceed(0)) {
-                      isExceed = true;
-                    }
-                    prev_perc += 10;
-                    if (isExceed) {
-                      logger_->report(
-                          "    Completing {}% with {} violations.",
-                          prev_perc,
-                          getDesign()->getTopBlock()->getNumMarkers());
-                      logger_->report("    {}.", t);
-                    }
-                  }
-                }
-              }
+              progress();
             } catch (...) {
               exception.capture();
             }
@@ -816,7 +961,29 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
              1,
              "Number of work units = {}.",
              numWorkUnits_);
+  debugPrint(logger_,
+             utl::DRT,
+             "workers",
+             1,
+             "Grid graphs allocated {}, reused {}, pooled {:.2f} (MB), "
+             "peak memory {:.2f} (MB).",
+             graph_pool_.getNumAllocs(),
+             graph_pool_.getNumReuses(),
+             graph_pool_.getBytes() / (1024.0 * 1024.0),
+             getPeakRSS() / (1024.0 * 1024.0));
+  graph_pool_.resetStats();
+  if (markerDriven) {
+    logger_->metric(fmt::format("route__workers__skipped__iter:{}", iter_),
+                    skipped);
+  }
   if (VERBOSE > 0) {
+    if (markerDriven) {
+      logger_->info(DRT,
+                    196,
+                    "  Skipped {} of {} workers without violations.",
+                    skipped,
+                    tot + skipped);
+    }
     logger_->info(DRT,
                   199,
                   "  Number of violations = {}.",
@@ -1438,6 +1605,7 @@ int FlexDR::main()
           fmt::format("drt_iter{}.odb", iter_ - 1).c_str());
     }
   }
+  graph_pool_.clear();
 
   end(/* done */ true);
   if (!GUIDE_REPORT_FILE.empty()) {
@@ -33,7 +33,10 @@
 #include <boost/polygon/polygon.hpp>
 #include <boost/serialization/export.hpp>
 #include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 
 #include "db/drObj/drMarker.h"
 #include "db/drObj/drNet.h"
@@ -74,6 +77,30 @@ struct FlexDRViaData
   friend class boost::serialization::access;
 };
 
+// Workers read the design while other workers commit to it. Commits take
+// precedence over new readers so a steady stream of readers can't starve
+// them.
+class FlexDRDesignLock
+{
+ public:
+  void lock()
+  {
+    std::lock_guard<std::mutex> turn(turnstile_);
+    mutex_.lock();
+  }
+  void unlock() { mutex_.unlock(); }
+  void lock_shared()
+  {
+    std::lock_guard<std::mutex> turn(turnstile_);
+    mutex_.lock_shared();
+  }
+  void unlock_shared() { mutex_.unlock_shared(); }
+
+ private:
+  std::mutex turnstile_;
+  std::shared_mutex mutex_;
+};
+
 class FlexDR
 {
  public:
@@ -149,6 +176,7 @@ class FlexDR
   std::unique_ptr<FlexDRGraphics> graphics_;
   std::string debugNetName_;
   int numWorkUnits_;
+  FlexGridGraph::StoragePool graph_pool_;
 
   // distributed
   dst::Distributed* dist_;
@@ -165,6 +193,10 @@ class FlexDR
   void initFromTA();
   void initGCell2BoundaryPin();
   void getBatchInfo(int& batchStepX, int& batchStepY);
+  void processWorkers(std::vector<std::unique_ptr<FlexDRWorker>>& workers,
+                      int size,
+                      int offset,
+                      const std::function<void()>& progress);
 
   void init_halfViaEncArea();
 
@@ -349,6 +381,11 @@ class FlexDRWorker
     gridGraph_.setGraphics(in);
   }
   void setViaData(FlexDRViaData* viaData) { via_data_ = viaData; }
+  void setDesignLock(FlexDRDesignLock* lock) { design_lock_ = lock; }
+  void setGridGraphPool(FlexGridGraph::StoragePool* pool)
+  {
+    gridGraph_.setStoragePool(pool);
+  }
   // getters
   frTechObject* getTech() const { return design_->getTech(); }
   void getRouteBox(Rect& boxIn) const { boxIn = routeBox_; }
@@ -466,6 +503,7 @@ class FlexDRWorker
   FlexDRGraphics* graphics_ = nullptr;  // owned by FlexDR
   frDebugSettings* debugSettings_ = nullptr;
   FlexDRViaData* via_data_ = nullptr;
+  FlexDRDesignLock* design_lock_ = nullptr;  // owned by FlexDR
   Rect routeBox_;
   Rect extBox_;
   Rect drcBox_;
@@ -70,6 +70,7 @@ void FlexGridGraph::initGrids(
   getDim(xDim, yDim, zDim);
   const int capacity = xDim * yDim * zDim;
 
+  acquireStorage();
   nodes_.clear();
   nodes_.resize(capacity, Node());
   // new
@@ -88,6 +89,41 @@ void FlexGridGraph::initGrids(
   }
 }
 
+void FlexGridGraph::acquireStorage()
+{
+  if (!pool_ || nodes_.capacity() != 0) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(pool_->mutex_);
+  if (pool_->free_.empty()) {
+    pool_->num_allocs_++;
+    return;
+  }
+  pool_->num_reuses_++;
+  Storage& storage = pool_->free_.back();
+  nodes_.swap(storage.nodes);
+  prevDirs_.swap(storage.prevDirs);
+  srcs_.swap(storage.srcs);
+  dsts_.swap(storage.dsts);
+  guides_.swap(storage.guides);
+  pool_->free_.pop_back();
+}
+
+void FlexGridGraph::releaseStorage()
+{
+  if (nodes_.capacity() == 0) {
+    return;
+  }
+  Storage storage;
+  storage.nodes.swap(nodes_);
+  storage.prevDirs.swap(prevDirs_);
+  storage.srcs.swap(srcs_);
+  storage.dsts.swap(dsts_);
+  storage.guides.swap(guides_);
+  std::lock_guard<std::mutex> lock(pool_->mutex_);
+  pool_->free_.push_back(std::move(storage));
+}
+
 bool FlexGridGraph::outOfDieVia(frMIdx x,
                                 frMIdx y,
                                 frMIdx z,
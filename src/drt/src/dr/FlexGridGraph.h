@@ -32,6 +32,8 @@
 #include <cstring>
 #include <iostream>
 #include <map>
+#include <mutex>
+#include <vector>
 
 #include "FlexMazeTypes.h"
 #include "db/drObj/drPin.h"
@@ -46,6 +48,8 @@ class FlexDRGraphics;
 class FlexGridGraph
 {
  public:
+  class StoragePool;
+
   // constructors
   FlexGridGraph(frTechObject* techIn, Logger* loggerIn, FlexDRWorker* workerIn)
       : tech_(techIn), logger_(loggerIn), drWorker_(workerIn)
@@ -908,6 +912,8 @@ class FlexGridGraph
 
   void setDstTaperBox(frBox3D* t) { dstTaperBox = t; }
 
+  void setStoragePool(StoragePool* pool) { pool_ = pool; }
+
   frCost getCosts(frMIdx gridX,
                   frMIdx gridY,
                   frMIdx gridZ,
@@ -955,14 +961,18 @@ class FlexGridGraph
   int nTracksY() { return yCoords_.size(); }
   void cleanup()
   {
-    nodes_.clear();
-    nodes_.shrink_to_fit();
-    srcs_.clear();
-    srcs_.shrink_to_fit();
-    dsts_.clear();
-    dsts_.shrink_to_fit();
-    guides_.clear();
-    guides_.shrink_to_fit();
+    if (pool_) {
+      releaseStorage();
+    } else {
+      nodes_.clear();
+      nodes_.shrink_to_fit();
+      srcs_.clear();
+      srcs_.shrink_to_fit();
+      dsts_.clear();
+      dsts_.shrink_to_fit();
+      guides_.clear();
+      guides_.shrink_to_fit();
+    }
     xCoords_.clear();
     xCoords_.shrink_to_fit();
     yCoords_.clear();
@@ -1065,6 +1075,16 @@ class FlexGridGraph
 #ifndef DEBUG_DRT_UNDERFLOW
   static_assert(sizeof(Node) == 16);
 #endif
+  // The per grid vectors, handed between workers by a StoragePool.
+  struct Storage
+  {
+    frVector<Node> nodes;
+    std::vector<bool> prevDirs;
+    std::vector<bool> srcs;
+    std::vector<bool> dsts;
+    std::vector<bool> guides;
+  };
+  StoragePool* pool_ = nullptr;  // owned by FlexDR
   frVector<Node> nodes_;
   std::vector<bool> prevDirs_;
   std::vector<bool> srcs_;
@@ -1256,6 +1276,8 @@ class FlexGridGraph
                       vertLoc2TrackPatterns,
                   std::map<frLayerNum, dbTechLayerDir>& layerNum2PreRouteDir,
                   const Rect& bbox);
+  void acquireStorage();
+  void releaseStorage();
   void initGrids(
       const std::map<frCoord, std::map<frLayerNum, frTrackPattern*>>& xMap,
       const std::map<frCoord, std::map<frLayerNum, frTrackPattern*>>& yMap,
@@ -1332,4 +1354,43 @@ class FlexGridGraph
   friend class FlexDRWorker;
 };
 
+// Keeps the grid storage of finished workers so the next worker reuses it
+// instead of allocating it again.  It holds at most one entry per worker
+// running at the same time.
+class FlexGridGraph::StoragePool
+{
+ public:
+  int getNumAllocs() const { return num_allocs_; }
+  int getNumReuses() const { return num_reuses_; }
+  size_t getBytes() const
+  {
+    size_t bytes = 0;
+    for (const auto& storage : free_) {
+      bytes += storage.nodes.capacity() * sizeof(Node);
+      bytes += (storage.prevDirs.capacity() + storage.srcs.capacity()
+                + storage.dsts.capacity() + storage.guides.capacity())
+               / 8;
+    }
+    return bytes;
+  }
+  void resetStats()
+  {
+    num_allocs_ = 0;
+    num_reuses_ = 0;
+  }
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_.clear();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<Storage> free_;
+  int num_allocs_ = 0;
+  int num_reuses_ = 0;
+
+  friend class FlexGridGraph;
+};
+
 }  // namespace drt
@@ -686,11 +686,21 @@ bool FlexGridGraph::search(std::vector<FlexMazeIdx>& connComps,
   }
 
   wavefront_.cleanup();
+  std::string trace;
+  const bool tracing = logger_->debugCheck(DRT, "maze_trace", 1);
+  wavefront_.setTrace(tracing ? &trace : nullptr);
+  auto endTrace = [&]() {
+    if (tracing) {
+      wavefront_.setTrace(nullptr);
+      debugPrint(logger_, DRT, "maze_trace", 1, "{}", trace);
+    }
+  };
   // init wavefront
   Point currPt;
   for (auto& idx : connComps) {
     if (isDst(idx.x(), idx.y(), idx.z())) {
       path.emplace_back(idx.x(), idx.y(), idx.z());
+      endTrace();
       return true;
     }
     getPoint(currPt, idx.x(), idx.y());
@@ -732,11 +742,13 @@ bool FlexGridGraph::search(std::vector<FlexMazeIdx>& connComps,
     }
     if (isDst(currGrid.x(), currGrid.y(), currGrid.z())) {
       traceBackPath(currGrid, path, connComps, ccMazeIdx1, ccMazeIdx2);
+      endTrace();
       return true;
     }
     // expand and update wavefront
     expandWavefront(currGrid, dstMazeIdx1, dstMazeIdx2, centerPt);
   }
+  endTrace();
   return false;
 }
 
@@ -28,9 +28,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <bitset>
+#include <cstdint>
 #include <memory>
 #include <queue>
+#include <string>
+#include <vector>
 
 #include "dr/FlexMazeTypes.h"
 #include "frBaseTypes.h"
@@ -53,15 +57,15 @@ class FlexWavefrontGrid
                     const std::bitset<WAVEFRONTBITSIZE>& backTraceBufferIn = {})
       : xIdx_(xIn),
         yIdx_(yIn),
-        zIdx_(zIn),
         pathCost_(pathCostIn),
         cost_(costIn),
         vLengthX_(vLengthXIn),
         vLengthY_(vLengthYIn),
         dist_(distIn),
-        prevViaUp_(prevViaUpIn),
         tLength_(tLengthIn),
-        backTraceBuffer_(backTraceBufferIn)
+        zIdx_(zIn),
+        prevViaUp_(prevViaUpIn),
+        backTraceBuffer_(backTraceBufferIn.to_ulong())
   {
   }
   bool operator<(const FlexWavefrontGrid& b) const
@@ -84,7 +88,8 @@ class FlexWavefrontGrid
   frMIdx z() const { return zIdx_; }
   frCost getPathCost() const { return pathCost_; }
   frCost getCost() const { return cost_; }
-  const std::bitset<WAVEFRONTBITSIZE>& getBackTraceBuffer() const
+  frCoord getDist() const { return dist_; }
+  std::bitset<WAVEFRONTBITSIZE> getBackTraceBuffer() const
   {
     return backTraceBuffer_;
   }
@@ -106,37 +111,39 @@ class FlexWavefrontGrid
   void setPrevViaUp(bool in) { prevViaUp_ = in; }
   frDirEnum getLastDir() const
   {
-    auto currDirVal = backTraceBuffer_.to_ulong() & 0b111u;
-    return static_cast<frDirEnum>(currDirVal);
+    return static_cast<frDirEnum>(backTraceBuffer_ & 0b111u);
   }
   bool isBufferFull() const
   {
-    std::bitset<WAVEFRONTBITSIZE> mask = WAVEFRONTBUFFERHIGHMASK;
-    return (mask & backTraceBuffer_).any();
+    return (WAVEFRONTBUFFERHIGHMASK & backTraceBuffer_) != 0;
   }
   frDirEnum shiftAddBuffer(const frDirEnum& dir)
   {
     auto retBS = static_cast<frDirEnum>(
-        (backTraceBuffer_ >> (WAVEFRONTBITSIZE - DIRBITSIZE)).to_ulong());
-    backTraceBuffer_ <<= DIRBITSIZE;
-    std::bitset<WAVEFRONTBITSIZE> newBS = (unsigned) dir;
-    backTraceBuffer_ |= newBS;
+        backTraceBuffer_ >> (WAVEFRONTBITSIZE - DIRBITSIZE));
+    backTraceBuffer_ = ((backTraceBuffer_ << DIRBITSIZE) | (unsigned) dir)
+                       & ((1u << WAVEFRONTBITSIZE) - 1);
     return retBS;
   }
   void setSrcTaperBox(const frBox3D* b) { srcTaperBox = b; }
   const frBox3D* getSrcTaperBox() const { return srcTaperBox; }
 
  private:
-  frMIdx xIdx_, yIdx_, zIdx_;
+  static_assert(WAVEFRONTBITSIZE <= 8, "backtrace buffer is a byte");
+
+  // Ordered by size so a grid packs into 48 bytes; the queue copies every
+  // grid several times.
+  frMIdx xIdx_, yIdx_;
   frCost pathCost_;  // path cost
   frCost cost_;      // path + est cost
   frCoord vLengthX_;
   frCoord vLengthY_;
-  frCoord dist_;  // to maze center
-  bool prevViaUp_;
+  frCoord dist_;     // to maze center
   frCoord tLength_;  // length since last turn
-  std::bitset<WAVEFRONTBITSIZE> backTraceBuffer_;
   const frBox3D* srcTaperBox = nullptr;
+  int16_t zIdx_;
+  bool prevViaUp_;
+  uint8_t backTraceBuffer_;
 };
 
 class myPriorityQueue : public std::priority_queue<FlexWavefrontGrid>
@@ -150,18 +157,137 @@ class myPriorityQueue : public std::priority_queue<FlexWavefrontGrid>
   }
 };
 
+// Radix heap keyed on the grid cost.  Bucket i > 0 holds the grids whose
+// cost first differs from the last popped cost in bit i - 1, so a grid is
+// moved at most once per bit instead of sifting through the whole heap on
+// every push and pop.  Bucket 0 holds the grids at the last popped cost and
+// is a heap on the full FlexWavefrontGrid order, which keeps the dist,
+// layer and path cost tie breaks.  An estimate below the last popped cost
+// lands in bucket 0 too and still comes out first.  Only grids that are
+// equal under that order may pop in a different order than from
+// myPriorityQueue.
+class FlexBucketQueue
+{
+ public:
+  bool empty() const { return size_ == 0; }
+  const FlexWavefrontGrid& top() const { return buckets_[0].front(); }
+  void pop()
+  {
+    auto& bucket = buckets_[0];
+    std::pop_heap(bucket.begin(), bucket.end());
+    bucket.pop_back();
+    if (--size_ != 0 && bucket.empty()) {
+      refill();
+    }
+  }
+  void push(const FlexWavefrontGrid& in)
+  {
+    if (size_++ == 0) {
+      last_ = in.getCost();
+    }
+    insert(in);
+  }
+  unsigned int size() const { return size_; }
+  void cleanup()
+  {
+    for (auto& bucket : buckets_) {
+      bucket.clear();
+    }
+    size_ = 0;
+  }
+  void fit()
+  {
+    for (auto& bucket : buckets_) {
+      bucket.clear();
+      bucket.shrink_to_fit();
+    }
+    size_ = 0;
+  }
+
+ private:
+  static constexpr int num_buckets_ = sizeof(frCost) * 8 + 1;
+
+  int bucketIdx(frCost cost) const
+  {
+    if (cost <= last_) {
+      return 0;
+    }
+    int idx = 0;
+    for (frCost diff = cost ^ last_; diff; diff >>= 1) {
+      ++idx;
+    }
+    return idx;
+  }
+  void insert(const FlexWavefrontGrid& in)
+  {
+    auto& bucket = buckets_[bucketIdx(in.getCost())];
+    bucket.push_back(in);
+    if (&bucket == &buckets_[0]) {
+      std::push_heap(bucket.begin(), bucket.end());
+    }
+  }
+  // Moves the lowest non-empty bucket down after bucket 0 runs dry.
+  void refill()
+  {
+    int idx = 1;
+    while (buckets_[idx].empty()) {
+      ++idx;
+    }
+    auto& bucket = buckets_[idx];
+    last_ = bucket.front().getCost();
+    for (const auto& grid : bucket) {
+      last_ = std::min(last_, grid.getCost());
+    }
+    for (const auto& grid : bucket) {
+      insert(grid);
+    }
+    bucket.clear();
+  }
+
+  std::vector<FlexWavefrontGrid> buckets_[num_buckets_];
+  unsigned int size_ = 0;
+  frCost last_ = 0;
+};
+
+// Configure with -DDRT_BUCKET_QUEUE=ON to route with FlexBucketQueue.
+#ifdef DRT_BUCKET_QUEUE
+using FlexWavefrontQueue = FlexBucketQueue;
+#else
+using FlexWavefrontQueue = myPriorityQueue;
+#endif
+
 class FlexWavefront
 {
  public:
   bool empty() const { return wavefrontPQ_.empty(); }
   const FlexWavefrontGrid& top() const { return wavefrontPQ_.top(); }
-  void pop() { wavefrontPQ_.pop(); }
-  void push(const FlexWavefrontGrid& in) { wavefrontPQ_.push(in); }
+  void pop()
+  {
+    if (trace_) {
+      *trace_ += " -";
+    }
+    wavefrontPQ_.pop();
+  }
+  void push(const FlexWavefrontGrid& in)
+  {
+    if (trace_) {
+      *trace_ += fmt::format(" +{},{},{},{}",
+                             in.getCost(),
+                             in.getDist(),
+                             in.z(),
+                             in.getPathCost());
+    }
+    wavefrontPQ_.push(in);
+  }
   unsigned int size() const { return wavefrontPQ_.size(); }
   void cleanup() { wavefrontPQ_.cleanup(); }
   void fit() { wavefrontPQ_.fit(); }
+  // Records pushes as +cost,dist,z,pathcost and pops as - for
+  // test/mazeQueueBench.cpp.
+  void setTrace(std::string* trace) { trace_ = trace; }
 
  private:
-  myPriorityQueue wavefrontPQ_;
+  FlexWavefrontQueue wavefrontPQ_;
+  std::string* trace_ = nullptr;
 };
 }  // namespace drt
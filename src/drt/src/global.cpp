@@ -70,6 +70,7 @@ bool CLEAN_PATCHES = false;
 bool DO_PA = true;
 bool SINGLE_STEP_DR = false;
 bool SAVE_GUIDE_UPDATES = false;
+bool MARKER_DRIVEN_DR = false;
 
 std::string VIAINPIN_BOTTOMLAYER_NAME;
 std::string VIAINPIN_TOPLAYER_NAME;
@@ -73,6 +73,7 @@ extern bool CLEAN_PATCHES;
 extern bool DO_PA;
 extern bool SINGLE_STEP_DR;
 extern bool SAVE_GUIDE_UPDATES;
+extern bool MARKER_DRIVEN_DR;
 extern std::string VIAINPIN_BOTTOMLAYER_NAME;
 extern std::string VIAINPIN_TOPLAYER_NAME;
 extern frLayerNum VIAINPIN_BOTTOMLAYERNUM;
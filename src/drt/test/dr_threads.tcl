@@ -0,0 +1,18 @@
+# detailed_route on gcd, which spans about 7x7 worker tiles, must write the
+# same DEF for any number of threads
+source "helpers.tcl"
+
+set def_files {}
+foreach threads {1 4} {
+  set def_file [make_result_file dr_threads_$threads.def]
+  set ::env(DRT_THREADS) $threads
+  set ::env(DRT_THREADS_DEF) $def_file
+  exec [info nameofexecutable] -no_init -no_splash -exit dr_threads_run.tcl
+  lappend def_files $def_file
+}
+
+if { [diff_files [lindex $def_files 0] [lindex $def_files 1]] } {
+  puts "fail: the routing depends on the number of threads"
+} else {
+  puts "pass"
+}
@@ -0,0 +1,11 @@
+# One detailed_route run of dr_threads.tcl.
+source "helpers.tcl"
+read_lef Nangate45/Nangate45_tech.lef
+read_lef Nangate45/Nangate45_stdcell.lef
+read_def gcd_nangate45_preroute.def
+read_guides gcd_nangate45.route_guide
+
+set_thread_count $::env(DRT_THREADS)
+detailed_route -verbose 0 -droute_end_iter 3
+
+write_def $::env(DRT_THREADS_DEF)
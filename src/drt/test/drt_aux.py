@@ -31,7 +31,8 @@ def detailed_route(
     no_pin_access=False,
     single_step_dr=False,
     min_access_points=-1,
-    save_guide_updates=False
+    save_guide_updates=False,
+    marker_driven=False
 ):
     router = design.getTritonRoute()
     params = drt.ParamStruct()
@@ -54,6 +55,7 @@ def detailed_route(
     params.singleStepDR = single_step_dr
     params.minAccessPoints = min_access_points
     params.saveGuideUpdates = save_guide_updates
+    params.markerDriven = marker_driven
 
     router.setParams(params)
     router.main()
@@ -0,0 +1,38 @@
+# detailed_route -marker_driven on gcd, which still has violations after
+# the second iteration, so later iterations skip the workers without one
+source "helpers.tcl"
+read_lef Nangate45/Nangate45_tech.lef
+read_lef Nangate45/Nangate45_stdcell.lef
+read_def gcd_nangate45_preroute.def
+read_guides gcd_nangate45.route_guide
+
+set metrics_file [make_result_file marker_driven.json]
+utl::open_metrics $metrics_file
+
+detailed_route -verbose 1 -marker_driven
+
+utl::close_metrics $metrics_file
+
+set stream [open $metrics_file r]
+set metrics [read $stream]
+close $stream
+
+set skipped 0
+set iter2_errors 0
+set errors -1
+foreach {- count} [regexp -all -inline \
+                     {"route__workers__skipped__iter:\d+": (\d+)} $metrics] {
+  incr skipped $count
+}
+regexp {"route__drc_errors__iter:2": (\d+)} $metrics - iter2_errors
+regexp {"route__drc_errors": (\d+)} $metrics - errors
+
+if { $iter2_errors == 0 } {
+  puts "fail: no violations left after the second iteration"
+} elseif { $skipped == 0 } {
+  puts "fail: no worker was skipped"
+} elseif { $errors != 0 } {
+  puts "fail: detailed routing did not converge"
+} else {
+  puts "pass"
+}
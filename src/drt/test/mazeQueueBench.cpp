@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2024, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Replays maze searches recorded by
+//   set_debug_level DRT maze_trace 1
+// (typically around detailed_route_run_worker on a dumped worker) through
+// myPriorityQueue and FlexBucketQueue, checks that both pop the same grids
+// and reports the time each takes.
+//
+// usage: drtMazeQueueBench <log file> [repeat]
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "dr/FlexWavefront.h"
+
+namespace {
+
+using drt::frCoord;
+using drt::frCost;
+using drt::FlexWavefrontGrid;
+
+struct Op
+{
+  bool push;
+  frCost cost;
+  frCoord dist;
+  int z;
+  frCost pathCost;
+};
+
+using Search = std::vector<Op>;
+
+std::vector<Search> readSearches(const char* fileName)
+{
+  std::vector<Search> searches;
+  std::ifstream in(fileName);
+  const std::string tag = "maze_trace]";
+  std::string line;
+  while (std::getline(in, line)) {
+    const auto pos = line.find(tag);
+    if (pos == std::string::npos) {
+      continue;
+    }
+    Search search;
+    std::istringstream ops(line.substr(pos + tag.size()));
+    std::string op;
+    while (ops >> op) {
+      if (op == "-") {
+        search.push_back({false, 0, 0, 0, 0});
+        continue;
+      }
+      Op push{true, 0, 0, 0, 0};
+      if (std::sscanf(op.c_str(),
+                      "+%u,%d,%d,%u",
+                      &push.cost,
+                      &push.dist,
+                      &push.z,
+                      &push.pathCost)
+          == 4) {
+        search.push_back(push);
+      }
+    }
+    searches.push_back(std::move(search));
+  }
+  return searches;
+}
+
+template <class Queue>
+double replay(const std::vector<Search>& searches,
+              int repeat,
+              std::vector<frCost>& popped)
+{
+  Queue queue;
+  popped.clear();
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < repeat; ++i) {
+    for (const auto& search : searches) {
+      queue.cleanup();
+      for (const auto& op : search) {
+        if (op.push) {
+          queue.push(FlexWavefrontGrid(
+              0, 0, op.z, 0, 0, true, 0, op.dist, op.pathCost, op.cost));
+        } else if (!queue.empty()) {
+          const auto& grid = queue.top();
+          if (i == 0) {
+            popped.push_back(grid.getCost());
+            popped.push_back(grid.getDist());
+            popped.push_back(grid.z());
+            popped.push_back(grid.getPathCost());
+          }
+          queue.pop();
+        }
+      }
+    }
+  }
+  const std::chrono::duration<double> elapsed
+      = std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  if (argc < 2) {
+    std::cerr << "usage: " << argv[0] << " <log file> [repeat]\n";
+    return 1;
+  }
+  const int repeat = argc > 2 ? std::stoi(argv[2]) : 1;
+  const auto searches = readSearches(argv[1]);
+  size_t numOps = 0;
+  for (const auto& search : searches) {
+    numOps += search.size();
+  }
+  std::cout << "searches " << searches.size() << " ops " << numOps << "\n";
+
+  std::vector<frCost> heapPops;
+  std::vector<frCost> bucketPops;
+  const double heapTime
+      = replay<drt::myPriorityQueue>(searches, repeat, heapPops);
+  const double bucketTime
+      = replay<drt::FlexBucketQueue>(searches, repeat, bucketPops);
+  std::cout << "myPriorityQueue " << heapTime << " s\n";
+  std::cout << "FlexBucketQueue " << bucketTime << " s\n";
+  if (heapPops != bucketPops) {
+    std::cerr << "pop order differs\n";
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2024, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "dr/FlexWavefront.h"
+#include "gtest/gtest.h"
+
+namespace drt {
+namespace {
+
+// The fields of FlexWavefrontGrid::operator<.  Grids that are equal under
+// it may pop in a different order, so only these are compared.
+using Key = std::tuple<frCost, frCoord, int, frCost>;
+
+struct Op
+{
+  bool push;
+  frCost cost;
+  frCoord dist;
+  int z;
+  frCost pathCost;
+};
+
+Key key(const FlexWavefrontGrid& grid)
+{
+  return {grid.getCost(), grid.getDist(), grid.z(), grid.getPathCost()};
+}
+
+// A maze-like search: the costs drift upwards by at most max_step, a
+// quarter of the pushes are estimates at or below the current cost, and the
+// small dist, z and path cost ranges make ties on every field common.
+std::vector<Op> makeSearch(std::mt19937& rng, int num_ops, frCost max_step)
+{
+  std::uniform_int_distribution<int> op_dist(0, 2);
+  std::uniform_int_distribution<frCost> step_dist(0, max_step);
+  std::uniform_int_distribution<int> small_dist(0, 3);
+  std::vector<Op> ops;
+  frCost base = step_dist(rng);
+  for (int i = 0; i < num_ops; ++i) {
+    if (op_dist(rng) == 0) {
+      ops.push_back({false, 0, 0, 0, 0});
+      continue;
+    }
+    frCost cost;
+    if (small_dist(rng) == 0) {
+      cost = base - std::min<frCost>(base, small_dist(rng));
+    } else {
+      cost = base + step_dist(rng);
+      base += step_dist(rng) / 2;
+    }
+    ops.push_back({true,
+                   cost,
+                   static_cast<frCoord>(small_dist(rng)),
+                   small_dist(rng),
+                   static_cast<frCost>(small_dist(rng))});
+  }
+  return ops;
+}
+
+template <class Queue>
+std::vector<Key> replay(const std::vector<std::vector<Op>>& searches)
+{
+  Queue queue;
+  std::vector<Key> popped;
+  for (const auto& search : searches) {
+    queue.cleanup();
+    for (const auto& op : search) {
+      if (op.push) {
+        queue.push(FlexWavefrontGrid(
+            0, 0, op.z, 0, 0, true, 0, op.dist, op.pathCost, op.cost));
+      } else if (!queue.empty()) {
+        popped.push_back(key(queue.top()));
+        queue.pop();
+      }
+    }
+    // drain what is left so the tail order is checked too
+    while (!queue.empty()) {
+      popped.push_back(key(queue.top()));
+      queue.pop();
+    }
+  }
+  return popped;
+}
+
+void expectSamePopOrder(unsigned seed, frCost max_step)
+{
+  std::mt19937 rng(seed);
+  std::vector<std::vector<Op>> searches;
+  for (int i = 0; i < 20; ++i) {
+    searches.push_back(makeSearch(rng, 2000, max_step));
+  }
+  const std::vector<Key> heap_pops = replay<myPriorityQueue>(searches);
+  const std::vector<Key> bucket_pops = replay<FlexBucketQueue>(searches);
+  ASSERT_EQ(heap_pops.size(), bucket_pops.size());
+  for (size_t i = 0; i < heap_pops.size(); ++i) {
+    ASSERT_EQ(heap_pops[i], bucket_pops[i]) << "pop " << i;
+  }
+}
+
+TEST(FlexBucketQueueTest, SmallCostSteps)
+{
+  expectSamePopOrder(1, 4);
+}
+
+TEST(FlexBucketQueueTest, LargeCostSteps)
+{
+  expectSamePopOrder(2, 1 << 20);
+}
+
+TEST(FlexBucketQueueTest, EqualCosts)
+{
+  expectSamePopOrder(3, 0);
+}
+
+}  // namespace
+}  // namespace drt
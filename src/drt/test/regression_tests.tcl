@@ -14,5 +14,7 @@ record_tests {
   #drt_readme_msgs_check
 }
 record_pass_fail_tests {
+  dr_threads
   gc_test
+  marker_driven
 }
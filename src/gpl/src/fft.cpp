@@ -33,6 +33,9 @@
 
 #include "fft.h"
 
+#include <omp.h>
+
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstdlib>
@@ -42,38 +45,153 @@
 
 namespace gpl {
 
-FFT::FFT(int binCntX, int binCntY, int binSizeX, int binSizeY)
+OouraFFTBackend::OouraFFTBackend(int n1, int n2) : n1_(n1), n2_(n2)
+{
+  csTable_.resize(std::max(n1_, n2_) * 3 / 2, 0);
+  workArea_.resize(round(sqrt(std::max(n1_, n2_))) + 2, 0);
+}
+
+void OouraFFTBackend::ddct2d(int isgn, float** a)
+{
+  gpl::ddct2d(n1_, n2_, isgn, a, nullptr, workArea_.data(), csTable_.data());
+}
+
+void OouraFFTBackend::ddsct2d(int isgn, float** a)
+{
+  gpl::ddsct2d(n1_, n2_, isgn, a, nullptr, workArea_.data(), csTable_.data());
+}
+
+void OouraFFTBackend::ddcst2d(int isgn, float** a)
+{
+  gpl::ddcst2d(n1_, n2_, isgn, a, nullptr, workArea_.data(), csTable_.data());
+}
+
+ThreadedFFTBackend::ThreadedFFTBackend(int n1, int n2, int numThreads)
+    : n1_(n1), n2_(n2), numThreads_(std::max(1, numThreads))
+{
+  const int n = std::max(n1_, n2_);
+  csTable_.resize(n * 3 / 2, 0);
+  workArea_.resize(round(sqrt(n)) + 2, 0);
+
+  // Same table setup as ddct2d so the 1D transforms never rebuild them.
+  int* ip = workArea_.data();
+  float* w = csTable_.data();
+  int nw = ip[0];
+  if (n > (nw << 2)) {
+    nw = n >> 2;
+    makewt(nw, ip, w);
+  }
+  int nc = ip[1];
+  if (n > nc) {
+    nc = n;
+    makect(nc, ip, w + nw);
+  }
+
+  columnBuffers_.resize(numThreads_);
+  for (std::vector<float>& buffer : columnBuffers_) {
+    buffer.resize(columnBlock_ * n1_);
+  }
+}
+
+void ThreadedFFTBackend::ddct2d(int isgn, float** a)
+{
+  transform(isgn, a, false, false);
+}
+
+void ThreadedFFTBackend::ddsct2d(int isgn, float** a)
+{
+  transform(isgn, a, true, false);
+}
+
+void ThreadedFFTBackend::ddcst2d(int isgn, float** a)
+{
+  transform(isgn, a, false, true);
+}
+
+void ThreadedFFTBackend::transform(int isgn,
+                                   float** a,
+                                   bool sineN1,
+                                   bool sineN2)
+{
+  int* ip = workArea_.data();
+  float* w = csTable_.data();
+
+  // rows
+#pragma omp parallel for num_threads(numThreads_)
+  for (int i = 0; i < n1_; i++) {
+    if (sineN2) {
+      ddst(n2_, isgn, a[i], ip, w);
+    } else {
+      ddct(n2_, isgn, a[i], ip, w);
+    }
+  }
+
+  // columns, one block of adjacent columns at a time
+  const int blockCnt = (n2_ + columnBlock_ - 1) / columnBlock_;
+#pragma omp parallel for num_threads(numThreads_)
+  for (int block = 0; block < blockCnt; block++) {
+    float* t = columnBuffers_[omp_get_thread_num()].data();
+    const int j0 = block * columnBlock_;
+    const int width = std::min(columnBlock_, n2_ - j0);
+    for (int i = 0; i < n1_; i++) {
+      const float* row = a[i] + j0;
+      for (int k = 0; k < width; k++) {
+        t[k * n1_ + i] = row[k];
+      }
+    }
+    for (int k = 0; k < width; k++) {
+      if (sineN1) {
+        ddst(n1_, isgn, &t[k * n1_], ip, w);
+      } else {
+        ddct(n1_, isgn, &t[k * n1_], ip, w);
+      }
+    }
+    for (int i = 0; i < n1_; i++) {
+      float* row = a[i] + j0;
+      for (int k = 0; k < width; k++) {
+        row[k] = t[k * n1_ + i];
+      }
+    }
+  }
+}
+
+FFT::FFT(int binCntX, int binCntY, int binSizeX, int binSizeY, int numThreads)
     : binCntX_(binCntX),
       binCntY_(binCntY),
       binSizeX_(binSizeX),
       binSizeY_(binSizeY)
 {
-  binDensity_ = new float*[binCntX_];
-  electroPhi_ = new float*[binCntX_];
-  electroForceX_ = new float*[binCntX_];
-  electroForceY_ = new float*[binCntX_];
+  const size_t size = static_cast<size_t>(binCntX_) * binCntY_;
+  binDensityData_.resize(size, 0.0f);
+  electroPhiData_.resize(size, 0.0f);
+  electroForceXData_.resize(size, 0.0f);
+  electroForceYData_.resize(size, 0.0f);
 
-  for (int i = 0; i < binCntX_; i++) {
-    binDensity_[i] = new float[binCntY_];
-    electroPhi_[i] = new float[binCntY_];
-    electroForceX_[i] = new float[binCntY_];
-    electroForceY_[i] = new float[binCntY_];
+  binDensity_.resize(binCntX_);
+  electroPhi_.resize(binCntX_);
+  electroForceX_.resize(binCntX_);
+  electroForceY_.resize(binCntX_);
 
-    for (int j = 0; j < binCntY_; j++) {
-      binDensity_[i][j] = electroPhi_[i][j] = electroForceX_[i][j]
-          = electroForceY_[i][j] = 0.0f;
-    }
+  for (int i = 0; i < binCntX_; i++) {
+    const size_t offset = static_cast<size_t>(i) * binCntY_;
+    binDensity_[i] = &binDensityData_[offset];
+    electroPhi_[i] = &electroPhiData_[offset];
+    electroForceX_[i] = &electroForceXData_[offset];
+    electroForceY_[i] = &electroForceYData_[offset];
   }
 
-  csTable_.resize(std::max(binCntX_, binCntY_) * 3 / 2, 0);
+  if (numThreads > 1) {
+    backend_ = std::make_unique<ThreadedFFTBackend>(
+        binCntX_, binCntY_, numThreads);
+  } else {
+    backend_ = std::make_unique<OouraFFTBackend>(binCntX_, binCntY_);
+  }
 
   wx_.resize(binCntX_, 0);
   wxSquare_.resize(binCntX_, 0);
   wy_.resize(binCntY_, 0);
   wySquare_.resize(binCntY_, 0);
 
-  workArea_.resize(round(sqrt(std::max(binCntX_, binCntY_))) + 2, 0);
-
   for (int i = 0; i < binCntX_; i++) {
     wx_[i]
         = REPLACE_FFT_PI * static_cast<float>(i) / static_cast<float>(binCntX_);
@@ -88,28 +206,7 @@ FFT::FFT(int binCntX, int binCntY, int binSizeX, int binSizeY)
   }
 }
 
-FFT::~FFT()
-{
-  using std::vector;
-  for (int i = 0; i < binCntX_; i++) {
-    delete[] binDensity_[i];
-    delete[] electroPhi_[i];
-    delete[] electroForceX_[i];
-    delete[] electroForceY_[i];
-  }
-  delete[] binDensity_;
-  delete[] electroPhi_;
-  delete[] electroForceX_;
-  delete[] electroForceY_;
-
-  csTable_.clear();
-  wx_.clear();
-  wxSquare_.clear();
-  wy_.clear();
-  wySquare_.clear();
-
-  workArea_.clear();
-}
+FFT::~FFT() = default;
 
 void FFT::updateDensity(int x, int y, float density)
 {
@@ -128,13 +225,7 @@ float FFT::getElectroPhi(int x, int y) const
 
 void FFT::doFFT()
 {
-  ddct2d(binCntX_,
-         binCntY_,
-         -1,
-         binDensity_,
-         nullptr,
-         (int*) &workArea_[0],
-         (float*) &csTable_[0]);
+  backend_->ddct2d(-1, binDensity_.data());
 
   for (int i = 0; i < binCntX_; i++) {
     binDensity_[i][0] *= 0.5;
@@ -186,27 +277,9 @@ void FFT::doFFT()
     }
   }
   // Inverse DCT
-  ddct2d(binCntX_,
-         binCntY_,
-         1,
-         electroPhi_,
-         nullptr,
-         (int*) &workArea_[0],
-         (float*) &csTable_[0]);
-  ddsct2d(binCntX_,
-          binCntY_,
-          1,
-          electroForceX_,
-          nullptr,
-          (int*) &workArea_[0],
-          (float*) &csTable_[0]);
-  ddcst2d(binCntX_,
-          binCntY_,
-          1,
-          electroForceY_,
-          nullptr,
-          (int*) &workArea_[0],
-          (float*) &csTable_[0]);
+  backend_->ddct2d(1, electroPhi_.data());
+  backend_->ddsct2d(1, electroForceX_.data());
+  backend_->ddcst2d(1, electroForceY_.data());
 }
 
 }  // namespace gpl
@@ -33,14 +33,83 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 namespace gpl {
 
+// 2D cosine/sine transforms of an n1 x n2 array (a[n1][n2]) used by the
+// density solver. The transforms and isgn follow Ooura's ddct2d, ddsct2d
+// (sine along n1, cosine along n2) and ddcst2d (cosine along n1, sine along
+// n2).
+class FFTBackend
+{
+ public:
+  virtual ~FFTBackend() = default;
+
+  virtual void ddct2d(int isgn, float** a) = 0;
+  virtual void ddsct2d(int isgn, float** a) = 0;
+  virtual void ddcst2d(int isgn, float** a) = 0;
+};
+
+// Ooura's single threaded 2D transforms.
+class OouraFFTBackend : public FFTBackend
+{
+ public:
+  OouraFFTBackend(int n1, int n2);
+
+  void ddct2d(int isgn, float** a) override;
+  void ddsct2d(int isgn, float** a) override;
+  void ddcst2d(int isgn, float** a) override;
+
+ private:
+  int n1_ = 0;
+  int n2_ = 0;
+
+  // cos/sin table (prev: w_2d)
+  // length:  max(n1, n2) * 3 / 2
+  std::vector<float> csTable_;
+
+  // work area for bit reversal (prev: ip)
+  // length: round(sqrt( max(n1, n2) )) + 2
+  std::vector<int> workArea_;
+};
+
+// Row-column transforms built on Ooura's 1D transforms with the rows and
+// the column blocks split across threads. Columns are gathered into per
+// thread contiguous buffers. The results are identical to OouraFFTBackend.
+class ThreadedFFTBackend : public FFTBackend
+{
+ public:
+  ThreadedFFTBackend(int n1, int n2, int numThreads);
+
+  void ddct2d(int isgn, float** a) override;
+  void ddsct2d(int isgn, float** a) override;
+  void ddcst2d(int isgn, float** a) override;
+
+ private:
+  void transform(int isgn, float** a, bool sineN1, bool sineN2);
+
+  // Number of columns transformed together.
+  static constexpr int columnBlock_ = 16;
+
+  int n1_ = 0;
+  int n2_ = 0;
+  int numThreads_ = 1;
+
+  // Tables are filled in the constructor and only read by the transforms.
+  std::vector<float> csTable_;
+  std::vector<int> workArea_;
+
+  // one column block buffer per thread
+  std::vector<std::vector<float>> columnBuffers_;
+};
+
 class FFT
 {
  public:
-  FFT(int binCntX, int binCntY, int binSizeX, int binSizeY);
+  // With more than one thread the transforms use ThreadedFFTBackend.
+  FFT(int binCntX, int binCntY, int binSizeX, int binSizeY, int numThreads = 1);
   ~FFT();
 
   // input func
@@ -54,16 +123,20 @@ class FFT
   float getElectroPhi(int x, int y) const;
 
  private:
-  // 2D array; width: binCntX_, height: binCntY_;
-  // No hope to use Vector at this moment...
-  float** binDensity_ = nullptr;
-  float** electroPhi_ = nullptr;
-  float** electroForceX_ = nullptr;
-  float** electroForceY_ = nullptr;
+  // 2D arrays; width: binCntX_, height: binCntY_;
+  // Each array is stored contiguously row by row and accessed through
+  // the row pointers below.
+  std::vector<float> binDensityData_;
+  std::vector<float> electroPhiData_;
+  std::vector<float> electroForceXData_;
+  std::vector<float> electroForceYData_;
 
-  // cos/sin table (prev: w_2d)
-  // length:  max(binCntX, binCntY) * 3 / 2
-  std::vector<float> csTable_;
+  std::vector<float*> binDensity_;
+  std::vector<float*> electroPhi_;
+  std::vector<float*> electroForceX_;
+  std::vector<float*> electroForceY_;
+
+  std::unique_ptr<FFTBackend> backend_;
 
   // wx. length:  binCntX_
   std::vector<float> wx_;
@@ -73,10 +146,6 @@ class FFT
   std::vector<float> wy_;
   std::vector<float> wySquare_;
 
-  // work area for bit reversal (prev: ip)
-  // length: round(sqrt( max(binCntX_, binCntY_) )) + 2
-  std::vector<int> workArea_;
-
   int binCntX_ = 0;
   int binCntY_ = 0;
   int binSizeX_ = 0;
@@ -89,6 +158,8 @@ class FFT
 //
 //
 /// 1D FFT ////////////////////////////////////////////////////////////////
+void makewt(int nw, int* ip, float* w);
+void makect(int nc, int* ip, float* c);
 void cdft(int n, int isgn, float* a, int* ip, float* w);
 void ddct(int n, int isgn, float* a, int* ip, float* w);
 void ddst(int n, int isgn, float* a, int* ip, float* w);
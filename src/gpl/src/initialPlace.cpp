@@ -33,6 +33,7 @@
 
 #include "initialPlace.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "placerBase.h"
@@ -40,8 +41,6 @@
 
 namespace gpl {
 
-using T = Eigen::Triplet<float>;
-
 InitialPlaceVars::InitialPlaceVars()
 {
   reset();
@@ -54,6 +53,7 @@ void InitialPlaceVars::reset()
   maxSolverIter = 100;
   maxFanout = 200;
   netWeightScale = 800.0;
+  solver = InitialPlaceSolver::BiCGSTAB;
   debug = false;
 }
 
@@ -65,7 +65,7 @@ InitialPlace::InitialPlace(InitialPlaceVars ipVars,
 {
 }
 
-void InitialPlace::doBicgstabPlace()
+void InitialPlace::doBicgstabPlace(int threads)
 {
   ResidualError error;
 
@@ -82,8 +82,10 @@ void InitialPlace::doBicgstabPlace()
   for (size_t iter = 1; iter <= ipVars_.maxIter; iter++) {
     updatePinInfo();
     createSparseMatrix();
-    error = cpuSparseSolve(ipVars_.maxSolverIter,
+    error = cpuSparseSolve(ipVars_.solver,
+                           ipVars_.maxSolverIter,
                            iter,
+                           threads,
                            placeInstForceMatrixX_,
                            fixedInstForceVecX_,
                            instLocVecX_,
@@ -224,8 +226,13 @@ void InitialPlace::createSparseMatrix()
   instLocVecY_.resize(placeCnt);
   fixedInstForceVecY_.resize(placeCnt);
 
-  placeInstForceMatrixX_.resize(placeCnt, placeCnt);
-  placeInstForceMatrixY_.resize(placeCnt, placeCnt);
+  // resize() drops the stored pattern, so only do it when the size changes.
+  if (placeInstForceMatrixX_.rows() != placeCnt) {
+    placeInstForceMatrixX_.resize(placeCnt, placeCnt);
+    placeInstForceMatrixY_.resize(placeCnt, placeCnt);
+    patternX_ = SparsePattern();
+    patternY_ = SparsePattern();
+  }
 
   //
   // listX and listY is a temporary vector that have tuples, (idx1, idx2, val)
@@ -237,7 +244,10 @@ void InitialPlace::createSparseMatrix()
   // to fill in SparseMatrix from Eigen docs.
   //
 
-  std::vector<T> listX, listY;
+  std::vector<Triplet>& listX = listX_;
+  std::vector<Triplet>& listY = listY_;
+  listX.clear();
+  listY.clear();
   listX.reserve(1000000);
   listY.reserve(1000000);
 
@@ -389,8 +399,51 @@ void InitialPlace::createSparseMatrix()
     }
   }
 
-  placeInstForceMatrixX_.setFromTriplets(listX.begin(), listX.end());
-  placeInstForceMatrixY_.setFromTriplets(listY.begin(), listY.end());
+  assembleMatrix(listX, patternX_, placeInstForceMatrixX_);
+  assembleMatrix(listY, patternY_, placeInstForceMatrixY_);
+}
+
+// Equivalent to matrix.setFromTriplets(list), but reuses the compressed
+// storage of the previous call when the triplet coordinates are unchanged.
+// Duplicates are summed in list order either way, so the values are
+// bit-identical to those of setFromTriplets.
+void InitialPlace::assembleMatrix(const std::vector<Triplet>& list,
+                                  SparsePattern& pattern,
+                                  SMatrix& matrix)
+{
+  const bool samePattern
+      = pattern.coords.size() == list.size()
+        && std::equal(list.begin(),
+                      list.end(),
+                      pattern.coords.begin(),
+                      [](const Triplet& t, const std::pair<int, int>& c) {
+                        return t.row() == c.first && t.col() == c.second;
+                      });
+
+  if (samePattern) {
+    float* values = matrix.valuePtr();
+    std::fill(values, values + matrix.nonZeros(), 0.0f);
+    for (size_t i = 0; i < list.size(); i++) {
+      values[pattern.slots[i]] += list[i].value();
+    }
+    return;
+  }
+
+  matrix.setFromTriplets(list.begin(), list.end());
+
+  // setFromTriplets leaves the matrix compressed with sorted inner indices.
+  const int* outer = matrix.outerIndexPtr();
+  const int* inner = matrix.innerIndexPtr();
+  pattern.coords.resize(list.size());
+  pattern.slots.resize(list.size());
+  for (size_t i = 0; i < list.size(); i++) {
+    const int row = list[i].row();
+    const int col = list[i].col();
+    pattern.coords[i] = {row, col};
+    pattern.slots[i]
+        = std::lower_bound(inner + outer[row], inner + outer[row + 1], col)
+          - inner;
+  }
 }
 
 void InitialPlace::updateCoordi()
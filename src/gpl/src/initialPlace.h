@@ -35,7 +35,10 @@
 
 #include <Eigen/SparseCore>
 #include <memory>
+#include <utility>
+#include <vector>
 
+#include "gpl/Replace.h"
 #include "nesterovPlace.h"
 #include "odb/db.h"
 
@@ -57,6 +60,7 @@ class InitialPlaceVars
   int maxSolverIter;
   int maxFanout;
   float netWeightScale;
+  InitialPlaceSolver solver;
   bool debug;
 
   InitialPlaceVars();
@@ -64,6 +68,17 @@ class InitialPlaceVars
 };
 
 using SMatrix = Eigen::SparseMatrix<float, Eigen::RowMajor>;
+using Triplet = Eigen::Triplet<float>;
+
+// Sparsity pattern of the last assembled matrix. B2B connections only change
+// when the min/max pins of a net change, so later iterations mostly produce
+// the same triplet coordinates and their values can be written straight into
+// the compressed storage instead of rebuilding it.
+struct SparsePattern
+{
+  std::vector<std::pair<int, int>> coords;  // (row, col) of each triplet
+  std::vector<int> slots;  // triplet index -> index into valuePtr()
+};
 
 class InitialPlace
 {
@@ -72,7 +87,7 @@ class InitialPlace
                std::shared_ptr<PlacerBaseCommon> pbc,
                std::vector<std::shared_ptr<PlacerBase>>& pbVec,
                utl::Logger* logger);
-  void doBicgstabPlace();
+  void doBicgstabPlace(int threads);
 
  private:
   InitialPlaceVars ipVars_;
@@ -104,16 +119,23 @@ class InitialPlace
   //        SparseMatrix that contains connectivity forces on Y // B2B model is
   //        used
   //
-  // Used the interative BiCGSTAB solver to solve matrix eqs.
+  // Used the interative BiCGSTAB (or CG) solver to solve matrix eqs.
 
   Eigen::VectorXf instLocVecX_, fixedInstForceVecX_;
   Eigen::VectorXf instLocVecY_, fixedInstForceVecY_;
   SMatrix placeInstForceMatrixX_, placeInstForceMatrixY_;
 
+  // kept across iterations to reuse their storage
+  std::vector<Triplet> listX_, listY_;
+  SparsePattern patternX_, patternY_;
+
   void placeInstsCenter();
   void setPlaceInstExtId();
   void updatePinInfo();
   void createSparseMatrix();
+  void assembleMatrix(const std::vector<Triplet>& list,
+                      SparsePattern& pattern,
+                      SMatrix& matrix);
   void updateCoordi();
 };
 
@@ -75,6 +75,11 @@ static float getSecondNorm(const std::vector<FloatPoint>& a);
 //
 // Choose to use "float" only in the following functions
 static float getOverlapDensityArea(const Bin& bin, const GCell* cell);
+static float getOverlapDensityArea(const Bin& bin,
+                                   int cellLx,
+                                   int cellLy,
+                                   int cellUx,
+                                   int cellUy);
 
 static float fastExp(float exp);
 
@@ -306,19 +311,10 @@ int64_t GNet::hpwl() const
   return (ux - lx) + (uy - ly);
 }
 
-void GNet::clearWaVars()
+void GNet::setWaVars(const WaVars* waVars, int waIdx)
 {
-  waExpMinSumX_ = 0;
-  waXExpMinSumX_ = 0;
-
-  waExpMaxSumX_ = 0;
-  waXExpMaxSumX_ = 0;
-
-  waExpMinSumY_ = 0;
-  waYExpMinSumY_ = 0;
-
-  waExpMaxSumY_ = 0;
-  waYExpMaxSumY_ = 0;
+  waVars_ = waVars;
+  waIdx_ = waIdx;
 }
 
 void GNet::setDontCare()
@@ -369,39 +365,10 @@ void GPin::setCenterLocation(int cx, int cy)
   cy_ = cy;
 }
 
-void GPin::clearWaVars()
-{
-  hasMaxExpSumX_ = false;
-  hasMaxExpSumY_ = false;
-  hasMinExpSumX_ = false;
-  hasMinExpSumY_ = false;
-
-  maxExpSumX_ = maxExpSumY_ = 0;
-  minExpSumX_ = minExpSumY_ = 0;
-}
-
-void GPin::setMaxExpSumX(float maxExpSumX)
-{
-  hasMaxExpSumX_ = true;
-  maxExpSumX_ = maxExpSumX;
-}
-
-void GPin::setMaxExpSumY(float maxExpSumY)
-{
-  hasMaxExpSumY_ = true;
-  maxExpSumY_ = maxExpSumY;
-}
-
-void GPin::setMinExpSumX(float minExpSumX)
-{
-  hasMinExpSumX_ = true;
-  minExpSumX_ = minExpSumX;
-}
-
-void GPin::setMinExpSumY(float minExpSumY)
+void GPin::setWaVars(const WaVars* waVars, int waIdx)
 {
-  hasMinExpSumY_ = true;
-  minExpSumY_ = minExpSumY;
+  waVars_ = waVars;
+  waIdx_ = waIdx;
 }
 
 void GPin::updateLocation(const GCell* gCell)
@@ -738,50 +705,91 @@ void BinGrid::updateBinsNonPlaceArea()
 void BinGrid::updateBinsGCellDensityArea(const std::vector<GCell*>& cells)
 {
   // clear the Bin-area info
-  for (Bin& bin : bins_) {
+#pragma omp parallel for num_threads(num_threads_)
+  for (auto it = bins_.begin(); it < bins_.end(); ++it) {
+    Bin& bin = *it;  // old-style loop for old OpenMP
     bin.setInstPlacedAreaUnscaled(0);
     bin.setFillerArea(0);
   }
 
-  for (auto& cell : cells) {
-    std::pair<int, int> pairX = getDensityMinMaxIdxX(cell);
-    std::pair<int, int> pairY = getDensityMinMaxIdxY(cell);
-
-    // The following function is critical runtime hotspot
-    // for global placer.
-    //
+  // copy what the bin loops need out of the cells
+  const int numCells = cells.size();
+  CellRects& rects = cellRects_;
+  rects.lx.resize(numCells);
+  rects.ly.resize(numCells);
+  rects.ux.resize(numCells);
+  rects.uy.resize(numCells);
+  rects.binLx.resize(numCells);
+  rects.binLy.resize(numCells);
+  rects.binUx.resize(numCells);
+  rects.binUy.resize(numCells);
+  rects.densityScale.resize(numCells);
+  rects.kind.resize(numCells);
+#pragma omp parallel for num_threads(num_threads_)
+  for (int i = 0; i < numCells; i++) {
+    const GCell* cell = cells[i];
+    const std::pair<int, int> pairX = getDensityMinMaxIdxX(cell);
+    const std::pair<int, int> pairY = getDensityMinMaxIdxY(cell);
+    rects.lx[i] = cell->dLx();
+    rects.ly[i] = cell->dLy();
+    rects.ux[i] = cell->dUx();
+    rects.uy[i] = cell->dUy();
+    rects.binLx[i] = pairX.first;
+    rects.binLy[i] = pairY.first;
+    rects.binUx[i] = pairX.second;
+    rects.binUy[i] = pairY.second;
+    rects.densityScale[i] = cell->densityScale();
     if (cell->isInstance()) {
       // macro should have
       // scale-down with target-density
       if (cell->isMacroInstance()) {
-        for (int y = pairY.first; y < pairY.second; y++) {
-          for (int x = pairX.first; x < pairX.second; x++) {
-            Bin& bin = bins_[y * binCntX_ + x];
-
-            const float scaledAvea = getOverlapDensityArea(bin, cell)
-                                     * cell->densityScale()
-                                     * bin.targetDensity();
-            bin.addInstPlacedAreaUnscaled(scaledAvea);
-          }
-        }
-      }
-      // normal cells
-      else if (cell->isStdInstance()) {
-        for (int y = pairY.first; y < pairY.second; y++) {
-          for (int x = pairX.first; x < pairX.second; x++) {
-            Bin& bin = bins_[y * binCntX_ + x];
-            const float scaledArea
-                = getOverlapDensityArea(bin, cell) * cell->densityScale();
-            bin.addInstPlacedAreaUnscaled(scaledArea);
-          }
-        }
+        rects.kind[i] = Macro;
+      } else if (cell->isStdInstance()) {
+        rects.kind[i] = Std;
+      } else {
+        rects.kind[i] = Other;
       }
     } else if (cell->isFiller()) {
-      for (int y = pairY.first; y < pairY.second; y++) {
-        for (int x = pairX.first; x < pairX.second; x++) {
+      rects.kind[i] = Filler;
+    } else {
+      rects.kind[i] = Other;
+    }
+  }
+
+  // The following loop is critical runtime hotspot
+  // for global placer.
+  //
+  // Each thread owns a band of bin rows and adds every cell overlapping
+  // the band.  The areas are integers, so the result doesn't depend on the
+  // thread count.
+#pragma omp parallel num_threads(num_threads_)
+  {
+    const int numBands = omp_get_num_threads();
+    const int band = omp_get_thread_num();
+    const int rowBegin = binCntY_ * band / numBands;
+    const int rowEnd = binCntY_ * (band + 1) / numBands;
+    for (int i = 0; i < numCells; i++) {
+      const int yBegin = std::max(rects.binLy[i], rowBegin);
+      const int yEnd = std::min(rects.binUy[i], rowEnd);
+      if (yBegin >= yEnd || rects.kind[i] == Other) {
+        continue;
+      }
+      const CellKind kind = rects.kind[i];
+      const float densityScale = rects.densityScale[i];
+      for (int y = yBegin; y < yEnd; y++) {
+        for (int x = rects.binLx[i]; x < rects.binUx[i]; x++) {
           Bin& bin = bins_[y * binCntX_ + x];
-          bin.addFillerArea(getOverlapDensityArea(bin, cell)
-                            * cell->densityScale());
+          const float overlap = getOverlapDensityArea(
+              bin, rects.lx[i], rects.ly[i], rects.ux[i], rects.uy[i]);
+          if (kind == Macro) {
+            const float scaledAvea
+                = overlap * densityScale * bin.targetDensity();
+            bin.addInstPlacedAreaUnscaled(scaledAvea);
+          } else if (kind == Std) {
+            bin.addInstPlacedAreaUnscaled(overlap * densityScale);
+          } else {
+            bin.addFillerArea(overlap * densityScale);
+          }
         }
       }
     }
@@ -973,6 +981,46 @@ NesterovBaseCommon::NesterovBaseCommon(NesterovBaseVars nbVars,
       gNet.addGPin(pbToNb(pin));
     }
   }
+
+  // WA arrays, with the pins of each net next to each other
+  waVars_.netPinBegin.reserve(gNetStor_.size() + 1);
+  int numNetPins = 0;
+  for (auto& gNet : gNetStor_) {
+    waVars_.netPinBegin.push_back(numNetPins);
+    numNetPins += gNet.gPins().size();
+  }
+  waVars_.netPinBegin.push_back(numNetPins);
+
+  // one more pin entry shared by the pins without a net
+  const int numPinEntries = numNetPins + 1;
+  waVars_.cx.resize(numPinEntries, 0);
+  waVars_.cy.resize(numPinEntries, 0);
+  waVars_.minExpSumX.resize(numPinEntries, 0);
+  waVars_.maxExpSumX.resize(numPinEntries, 0);
+  waVars_.minExpSumY.resize(numPinEntries, 0);
+  waVars_.maxExpSumY.resize(numPinEntries, 0);
+
+  const int numNets = gNetStor_.size();
+  waVars_.waExpMinSumX.resize(numNets, 0);
+  waVars_.waXExpMinSumX.resize(numNets, 0);
+  waVars_.waExpMaxSumX.resize(numNets, 0);
+  waVars_.waXExpMaxSumX.resize(numNets, 0);
+  waVars_.waExpMinSumY.resize(numNets, 0);
+  waVars_.waYExpMinSumY.resize(numNets, 0);
+  waVars_.waExpMaxSumY.resize(numNets, 0);
+  waVars_.waYExpMaxSumY.resize(numNets, 0);
+
+  for (auto& gPin : gPinStor_) {
+    gPin.setWaVars(&waVars_, numNetPins);
+  }
+  for (int i = 0; i < numNets; i++) {
+    GNet& gNet = gNetStor_[i];
+    gNet.setWaVars(&waVars_, i);
+    int waIdx = waVars_.netPinBegin[i];
+    for (GPin* gPin : gNet.gPins()) {
+      gPin->setWaVars(&waVars_, waIdx++);
+    }
+  }
 }
 
 GCell* NesterovBaseCommon::pbToNb(Instance* inst) const
@@ -1025,21 +1073,39 @@ GNet* NesterovBaseCommon::dbToNb(odb::dbNet* net) const
 void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
 {
   assert(omp_get_thread_num() == 0);
-  // clear all WA variables.
-#pragma omp parallel for num_threads(num_threads_)
-  for (auto gPin = gPinStor_.begin(); gPin < gPinStor_.end(); ++gPin) {
-    // old-style loop for old OpenMP
-    gPin->clearWaVars();
-  }
+  const bool debug = log_->debugCheck(GPL, "wlUpdateWA", 1);
+  const float minForceBar = nbVars_.minWireLengthForceBar;
+  WaVars& wa = waVars_;
 
 #pragma omp parallel for num_threads(num_threads_)
-  for (auto gNet = gNetStor_.begin(); gNet < gNetStor_.end(); ++gNet) {
-    // old-style loop for old OpenMP
+  for (int netIdx = 0; netIdx < (int) gNetStor_.size(); netIdx++) {
+    GNet& gNet = gNetStor_[netIdx];
+    const int begin = wa.netPinBegin[netIdx];
+    const int end = wa.netPinBegin[netIdx + 1];
+
+    gNet.updateBox();
+    const int lx = gNet.lx();
+    const int ly = gNet.ly();
+    const int ux = gNet.ux();
+    const int uy = gNet.uy();
+
+    // gather the pin locations; everything below reads the arrays
+    for (int i = begin; i < end; i++) {
+      const GPin* gPin = gNet.gPins()[i - begin];
+      wa.cx[i] = gPin->cx();
+      wa.cy[i] = gPin->cy();
+    }
 
-    gNet->clearWaVars();
-    gNet->updateBox();
+    float waExpMinSumX = 0;
+    float waXExpMinSumX = 0;
+    float waExpMaxSumX = 0;
+    float waXExpMaxSumX = 0;
+    float waExpMinSumY = 0;
+    float waYExpMinSumY = 0;
+    float waExpMaxSumY = 0;
+    float waYExpMaxSumY = 0;
 
-    for (auto& gPin : gNet->gPins()) {
+    for (int i = begin; i < end; i++) {
       // The WA terms are shift invariant:
       //
       //   Sum(x_i * exp(x_i))    Sum(x_i * exp(x_i - C))
@@ -1047,73 +1113,56 @@ void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
       //   Sum(exp(x_i))          Sum(exp(x_i - C))
       //
       // So we shift to keep the exponential from overflowing
-      float expMinX = (gNet->lx() - gPin->cx()) * wlCoeffX;
-      float expMaxX = (gPin->cx() - gNet->ux()) * wlCoeffX;
-      float expMinY = (gNet->ly() - gPin->cy()) * wlCoeffY;
-      float expMaxY = (gPin->cy() - gNet->uy()) * wlCoeffY;
-
-      // min x
-      if (expMinX > nbVars_.minWireLengthForceBar) {
-        gPin->setMinExpSumX(fastExp(expMinX));
-        gNet->addWaExpMinSumX(gPin->minExpSumX());
-        gNet->addWaXExpMinSumX(gPin->cx() * gPin->minExpSumX());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MinX updated: {} {:g}",
-                     gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->minExpSumX());
-        }
-      }
-
-      // max x
-      if (expMaxX > nbVars_.minWireLengthForceBar) {
-        gPin->setMaxExpSumX(fastExp(expMaxX));
-        gNet->addWaExpMaxSumX(gPin->maxExpSumX());
-        gNet->addWaXExpMaxSumX(gPin->cx() * gPin->maxExpSumX());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MaxX updated: {} {:g}",
-                     gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->maxExpSumX());
-        }
-      }
-
-      // min y
-      if (expMinY > nbVars_.minWireLengthForceBar) {
-        gPin->setMinExpSumY(fastExp(expMinY));
-        gNet->addWaExpMinSumY(gPin->minExpSumY());
-        gNet->addWaYExpMinSumY(gPin->cy() * gPin->minExpSumY());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MinY updated: {} {:g}",
-                     gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->minExpSumY());
-        }
-      }
+      const float expMinX = (lx - wa.cx[i]) * wlCoeffX;
+      const float expMaxX = (wa.cx[i] - ux) * wlCoeffX;
+      const float expMinY = (ly - wa.cy[i]) * wlCoeffY;
+      const float expMaxY = (wa.cy[i] - uy) * wlCoeffY;
+
+      // A pin below the force bar keeps 0 and adds nothing to the sums.
+      const float minExpSumX = expMinX > minForceBar ? fastExp(expMinX) : 0;
+      const float maxExpSumX = expMaxX > minForceBar ? fastExp(expMaxX) : 0;
+      const float minExpSumY = expMinY > minForceBar ? fastExp(expMinY) : 0;
+      const float maxExpSumY = expMaxY > minForceBar ? fastExp(expMaxY) : 0;
+
+      wa.minExpSumX[i] = minExpSumX;
+      wa.maxExpSumX[i] = maxExpSumX;
+      wa.minExpSumY[i] = minExpSumY;
+      wa.maxExpSumY[i] = maxExpSumY;
+
+      waExpMinSumX += minExpSumX;
+      waXExpMinSumX += wa.cx[i] * minExpSumX;
+      waExpMaxSumX += maxExpSumX;
+      waXExpMaxSumX += wa.cx[i] * maxExpSumX;
+      waExpMinSumY += minExpSumY;
+      waYExpMinSumY += wa.cy[i] * minExpSumY;
+      waExpMaxSumY += maxExpSumY;
+      waYExpMaxSumY += wa.cy[i] * maxExpSumY;
+    }
 
-      // max y
-      if (expMaxY > nbVars_.minWireLengthForceBar) {
-        gPin->setMaxExpSumY(fastExp(expMaxY));
-        gNet->addWaExpMaxSumY(gPin->maxExpSumY());
-        gNet->addWaYExpMaxSumY(gPin->cy() * gPin->maxExpSumY());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MaxY updated: {} {:g}",
-                     gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->maxExpSumY());
+    wa.waExpMinSumX[netIdx] = waExpMinSumX;
+    wa.waXExpMinSumX[netIdx] = waXExpMinSumX;
+    wa.waExpMaxSumX[netIdx] = waExpMaxSumX;
+    wa.waXExpMaxSumX[netIdx] = waXExpMaxSumX;
+    wa.waExpMinSumY[netIdx] = waExpMinSumY;
+    wa.waYExpMinSumY[netIdx] = waYExpMinSumY;
+    wa.waExpMaxSumY[netIdx] = waExpMaxSumY;
+    wa.waYExpMaxSumY[netIdx] = waYExpMaxSumY;
+
+    if (debug) {
+      for (const GPin* gPin : gNet.gPins()) {
+        if (!gPin->gCell() || !gPin->gCell()->isInstance()) {
+          continue;
         }
+        debugPrint(log_,
+                   GPL,
+                   "wlUpdateWA",
+                   1,
+                   "WA updated: {} min x {:g} max x {:g} min y {:g} max y {:g}",
+                   gPin->gCell()->instance()->dbInst()->getConstName(),
+                   gPin->minExpSumX(),
+                   gPin->maxExpSumX(),
+                   gPin->minExpSumY(),
+                   gPin->maxExpSumY());
       }
     }
   }
@@ -1342,8 +1391,11 @@ NesterovBase::NesterovBase(NesterovBaseVars nbVars,
   bg_.initBins();
 
   // initialize fft structrue based on bins
-  std::unique_ptr<FFT> fft(
-      new FFT(bg_.binCntX(), bg_.binCntY(), bg_.binSizeX(), bg_.binSizeY()));
+  std::unique_ptr<FFT> fft(new FFT(bg_.binCntX(),
+                                   bg_.binCntY(),
+                                   bg_.binSizeX(),
+                                   bg_.binSizeY(),
+                                   nbc_->getNumThreads()));
 
   fft_ = std::move(fft);
 
@@ -2382,10 +2434,20 @@ static int fastModulo(const int input, const int ceil)
 
 static float getOverlapDensityArea(const Bin& bin, const GCell* cell)
 {
-  const int rectLx = std::max(bin.lx(), cell->dLx());
-  const int rectLy = std::max(bin.ly(), cell->dLy());
-  const int rectUx = std::min(bin.ux(), cell->dUx());
-  const int rectUy = std::min(bin.uy(), cell->dUy());
+  return getOverlapDensityArea(
+      bin, cell->dLx(), cell->dLy(), cell->dUx(), cell->dUy());
+}
+
+static float getOverlapDensityArea(const Bin& bin,
+                                   int cellLx,
+                                   int cellLy,
+                                   int cellUx,
+                                   int cellUy)
+{
+  const int rectLx = std::max(bin.lx(), cellLx);
+  const int rectLy = std::max(bin.ly(), cellLy);
+  const int rectUx = std::min(bin.ux(), cellUx);
+  const int rectUy = std::min(bin.uy(), cellUy);
 
   if (rectLx >= rectUx || rectLy >= rectUy) {
     return 0;
@@ -33,6 +33,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -65,6 +66,35 @@ class Net;
 class GPin;
 class FFT;
 
+//
+// Weighted average (WA) wirelength state of every GPin and GNet, stored as
+// contiguous arrays so that updateWireLengthForceWA streams through memory
+// instead of chasing GPin and GNet pointers.  The pins of a net are stored
+// next to each other.  GPin and GNet read their values from here through
+// their WA index.
+//
+struct WaVars
+{
+  // Per pin.  The last entry belongs to pins without a net and stays 0.
+  std::vector<int> cx;
+  std::vector<int> cy;
+  std::vector<float> minExpSumX;
+  std::vector<float> maxExpSumX;
+  std::vector<float> minExpSumY;
+  std::vector<float> maxExpSumY;
+
+  // Per net; the pins of net i are [netPinBegin[i], netPinBegin[i + 1]).
+  std::vector<int> netPinBegin;
+  std::vector<float> waExpMinSumX;
+  std::vector<float> waXExpMinSumX;
+  std::vector<float> waExpMaxSumX;
+  std::vector<float> waXExpMaxSumX;
+  std::vector<float> waExpMinSumY;
+  std::vector<float> waYExpMinSumY;
+  std::vector<float> waExpMaxSumY;
+  std::vector<float> waYExpMaxSumY;
+};
+
 class GCell
 {
  public:
@@ -253,20 +283,8 @@ class GNet
   void setDontCare();
   bool isDontCare() const;
 
-  // clear WA(Weighted Average) variables.
-  void clearWaVars();
-
-  void addWaExpMinSumX(float waExpMinSumX);
-  void addWaXExpMinSumX(float waXExpMinSumX);
-
-  void addWaExpMinSumY(float waExpMinSumY);
-  void addWaYExpMinSumY(float waYExpMinSumY);
-
-  void addWaExpMaxSumX(float waExpMaxSumX);
-  void addWaXExpMaxSumX(float waXExpMaxSumX);
-
-  void addWaExpMaxSumY(float waExpMaxSumY);
-  void addWaYExpMaxSumY(float waYExpMaxSumY);
+  void setWaVars(const WaVars* waVars, int waIdx);
+  int waIdx() const { return waIdx_; }
 
   float waExpMinSumX() const;
   float waXExpMinSumX() const;
@@ -303,30 +321,17 @@ class GNet
   //
   // X forces.
   //
-  // waExpMinSumX_: store sigma {exp(x_i/gamma)}
-  // waXExpMinSumX_: store signa {x_i*exp(e_i/gamma)}
-  // waExpMaxSumX_ : store sigma {exp(-x_i/gamma)}
-  // waXExpMaxSumX_: store sigma {x_i*exp(-x_i/gamma)}
-  //
-  float waExpMinSumX_ = 0;
-  float waXExpMinSumX_ = 0;
-
-  float waExpMaxSumX_ = 0;
-  float waXExpMaxSumX_ = 0;
-
+  // waExpMinSumX: store sigma {exp(x_i/gamma)}
+  // waXExpMinSumX: store signa {x_i*exp(e_i/gamma)}
+  // waExpMaxSumX : store sigma {exp(-x_i/gamma)}
+  // waXExpMaxSumX: store sigma {x_i*exp(-x_i/gamma)}
   //
-  // Y forces.
+  // Y forces are the same with y_i.
   //
-  // waExpMinSumY_: store sigma {exp(y_i/gamma)}
-  // waYExpMinSumY_: store signa {y_i*exp(e_i/gamma)}
-  // waExpMaxSumY_ : store sigma {exp(-y_i/gamma)}
-  // waYExpMaxSumY_: store sigma {y_i*exp(-y_i/gamma)}
+  // The values live in waVars_ at index waIdx_.
   //
-  float waExpMinSumY_ = 0;
-  float waYExpMinSumY_ = 0;
-
-  float waExpMaxSumY_ = 0;
-  float waYExpMaxSumY_ = 0;
+  const WaVars* waVars_ = nullptr;
+  int waIdx_ = 0;
 
   bool isDontCare_ = false;
 };
@@ -351,85 +356,44 @@ inline int GNet::uy() const
   return uy_;
 }
 
-// eight add functions
-inline void GNet::addWaExpMinSumX(float waExpMinSumX)
-{
-  waExpMinSumX_ += waExpMinSumX;
-}
-
-inline void GNet::addWaXExpMinSumX(float waXExpMinSumX)
-{
-  waXExpMinSumX_ += waXExpMinSumX;
-}
-
-inline void GNet::addWaExpMinSumY(float waExpMinSumY)
-{
-  waExpMinSumY_ += waExpMinSumY;
-}
-
-inline void GNet::addWaYExpMinSumY(float waYExpMinSumY)
-{
-  waYExpMinSumY_ += waYExpMinSumY;
-}
-
-inline void GNet::addWaExpMaxSumX(float waExpMaxSumX)
-{
-  waExpMaxSumX_ += waExpMaxSumX;
-}
-
-inline void GNet::addWaXExpMaxSumX(float waXExpMaxSumX)
-{
-  waXExpMaxSumX_ += waXExpMaxSumX;
-}
-
-inline void GNet::addWaExpMaxSumY(float waExpMaxSumY)
-{
-  waExpMaxSumY_ += waExpMaxSumY;
-}
-
-inline void GNet::addWaYExpMaxSumY(float waYExpMaxSumY)
-{
-  waYExpMaxSumY_ += waYExpMaxSumY;
-}
-
 inline float GNet::waExpMinSumX() const
 {
-  return waExpMinSumX_;
+  return waVars_->waExpMinSumX[waIdx_];
 }
 
 inline float GNet::waXExpMinSumX() const
 {
-  return waXExpMinSumX_;
+  return waVars_->waXExpMinSumX[waIdx_];
 }
 
 inline float GNet::waExpMinSumY() const
 {
-  return waExpMinSumY_;
+  return waVars_->waExpMinSumY[waIdx_];
 }
 
 inline float GNet::waYExpMinSumY() const
 {
-  return waYExpMinSumY_;
+  return waVars_->waYExpMinSumY[waIdx_];
 }
 
 inline float GNet::waExpMaxSumX() const
 {
-  return waExpMaxSumX_;
+  return waVars_->waExpMaxSumX[waIdx_];
 }
 
 inline float GNet::waXExpMaxSumX() const
 {
-  return waXExpMaxSumX_;
+  return waVars_->waXExpMaxSumX[waIdx_];
 }
 
 inline float GNet::waExpMaxSumY() const
 {
-  return waExpMaxSumY_;
+  return waVars_->waExpMaxSumY[waIdx_];
 }
 
 inline float GNet::waYExpMaxSumY() const
 {
-  return waYExpMaxSumY_;
+  return waVars_->waYExpMaxSumY[waIdx_];
 }
 
 class GPin
@@ -450,23 +414,20 @@ class GPin
   int cx() const { return cx_; }
   int cy() const { return cy_; }
 
-  // clear WA(Weighted Average) variables.
-  void clearWaVars();
+  void setWaVars(const WaVars* waVars, int waIdx);
+  int waIdx() const { return waIdx_; }
 
-  void setMaxExpSumX(float maxExpSumX);
-  void setMaxExpSumY(float maxExpSumY);
-  void setMinExpSumX(float minExpSumX);
-  void setMinExpSumY(float minExpSumY);
+  float maxExpSumX() const { return waVars_->maxExpSumX[waIdx_]; }
+  float maxExpSumY() const { return waVars_->maxExpSumY[waIdx_]; }
+  float minExpSumX() const { return waVars_->minExpSumX[waIdx_]; }
+  float minExpSumY() const { return waVars_->minExpSumY[waIdx_]; }
 
-  float maxExpSumX() const { return maxExpSumX_; }
-  float maxExpSumY() const { return maxExpSumY_; }
-  float minExpSumX() const { return minExpSumX_; }
-  float minExpSumY() const { return minExpSumY_; }
-
-  bool hasMaxExpSumX() const { return hasMaxExpSumX_; }
-  bool hasMaxExpSumY() const { return hasMaxExpSumY_; }
-  bool hasMinExpSumX() const { return hasMinExpSumX_; }
-  bool hasMinExpSumY() const { return hasMinExpSumY_; }
+  // A pin outside the exponent range of its net keeps a zero sum, and a
+  // zero sum adds nothing to the gradient.
+  bool hasMaxExpSumX() const { return maxExpSumX() != 0; }
+  bool hasMaxExpSumY() const { return maxExpSumY() != 0; }
+  bool hasMinExpSumX() const { return minExpSumX() != 0; }
+  bool hasMinExpSumY() const { return minExpSumY() != 0; }
 
   void setCenterLocation(int cx, int cy);
   void updateLocation(const GCell* gCell);
@@ -485,25 +446,14 @@ class GPin
   // weighted average WL vals stor for better indexing
   // Please check the equation (4) in the ePlace-MS paper.
   //
-  // maxExpSum_: holds exp(x_i/gamma)
-  // minExpSum_: holds exp(-x_i/gamma)
+  // maxExpSum: holds exp(x_i/gamma)
+  // minExpSum: holds exp(-x_i/gamma)
   // the x_i is equal to cx_ variable.
   //
-  float maxExpSumX_ = 0;
-  float maxExpSumY_ = 0;
-
-  float minExpSumX_ = 0;
-  float minExpSumY_ = 0;
-
-  // flag variables
+  // The values live in waVars_ at index waIdx_.
   //
-  // check whether
-  // this pin is considered in a WA models.
-  bool hasMaxExpSumX_ = false;
-  bool hasMaxExpSumY_ = false;
-
-  bool hasMinExpSumX_ = false;
-  bool hasMinExpSumY_ = false;
+  const WaVars* waVars_ = nullptr;
+  int waIdx_ = 0;
 };
 
 class Bin
@@ -722,6 +672,31 @@ class BinGrid
   int64_t overflowAreaUnscaled_ = 0;
   bool isSetBinCnt_ = false;
   int num_threads_ = 1;
+
+  // The density rectangles and bin ranges of the cells given to
+  // updateBinsGCellDensityArea, copied into contiguous arrays so the bin
+  // update loops don't dereference the cells.
+  enum CellKind : uint8_t
+  {
+    Macro,
+    Std,
+    Filler,
+    Other
+  };
+  struct CellRects
+  {
+    std::vector<int> lx;
+    std::vector<int> ly;
+    std::vector<int> ux;
+    std::vector<int> uy;
+    std::vector<int> binLx;
+    std::vector<int> binLy;
+    std::vector<int> binUx;
+    std::vector<int> binUy;
+    std::vector<float> densityScale;
+    std::vector<CellKind> kind;
+  };
+  CellRects cellRects_;
 };
 
 inline std::vector<Bin>& BinGrid::bins()
@@ -846,6 +821,8 @@ class NesterovBaseCommon
   std::unordered_map<Pin*, GPin*> gPinMap_;
   std::unordered_map<Net*, GNet*> gNetMap_;
 
+  WaVars waVars_;
+
   int num_threads_;
 };
 
@@ -92,6 +92,7 @@ void Replace::reset()
   initialPlaceMaxSolverIter_ = 100;
   initialPlaceMaxFanout_ = 200;
   initialPlaceNetWeightScale_ = 800;
+  initialPlaceSolver_ = InitialPlaceSolver::BiCGSTAB;
 
   nesterovPlaceMaxIter_ = 5000;
   binGridCntX_ = binGridCntY_ = 0;
@@ -190,7 +191,7 @@ void Replace::doIncrementalPlace(int threads)
   constexpr float rough_oveflow = 0.2f;
   float previous_overflow = overflow_;
   setTargetOverflow(std::max(rough_oveflow, overflow_));
-  doInitialPlace();
+  doInitialPlace(threads);
 
   int previous_max_iter = nesterovPlaceMaxIter_;
   initNesterovPlace(threads);
@@ -210,7 +211,7 @@ void Replace::doIncrementalPlace(int threads)
   }
 }
 
-void Replace::doInitialPlace()
+void Replace::doInitialPlace(int threads)
 {
   if (pbc_ == nullptr) {
     PlacerBaseVars pbVars;
@@ -245,12 +246,13 @@ void Replace::doInitialPlace()
   ipVars.maxSolverIter = initialPlaceMaxSolverIter_;
   ipVars.maxFanout = initialPlaceMaxFanout_;
   ipVars.netWeightScale = initialPlaceNetWeightScale_;
+  ipVars.solver = initialPlaceSolver_;
   ipVars.debug = gui_debug_initial_;
 
   std::unique_ptr<InitialPlace> ip(
       new InitialPlace(ipVars, pbc_, pbVec_, log_));
   ip_ = std::move(ip);
-  ip_->doBicgstabPlace();
+  ip_->doBicgstabPlace(threads);
 }
 
 void Replace::runMBFF(int max_sz,
@@ -402,6 +404,11 @@ void Replace::setInitialPlaceNetWeightScale(float scale)
   initialPlaceNetWeightScale_ = scale;
 }
 
+void Replace::setInitialPlaceSolver(InitialPlaceSolver solver)
+{
+  initialPlaceSolver_ = solver;
+}
+
 void Replace::setNesterovPlaceMaxIter(int iter)
 {
   nesterovPlaceMaxIter_ = iter;
@@ -1,4 +1,6 @@
 %{
+#include <cstring>
+
 #include "ord/OpenRoad.hh"
 #include "gpl/Replace.h"
 #include "odb/db.h"
@@ -33,7 +35,8 @@ void
 replace_initial_place_cmd()
 {
   Replace* replace = getReplace();
-  replace->doInitialPlace();
+  int threads = ord::OpenRoad::openRoad()->getThreadCount();
+  replace->doInitialPlace(threads);
 }
 
 void 
@@ -82,6 +85,20 @@ set_initial_place_max_fanout_cmd(int fanout)
   replace->setInitialPlaceMaxFanout(fanout);
 }
 
+void
+set_initial_place_solver_cmd(const char* solver)
+{
+  Replace* replace = getReplace();
+  if (strcmp(solver, "cg") == 0) {
+    replace->setInitialPlaceSolver(gpl::InitialPlaceSolver::CG);
+  } else if (strcmp(solver, "cg_ichol") == 0) {
+    replace->setInitialPlaceSolver(
+        gpl::InitialPlaceSolver::CGIncompleteCholesky);
+  } else {
+    replace->setInitialPlaceSolver(gpl::InitialPlaceSolver::BiCGSTAB);
+  }
+}
+
 void
 set_nesv_place_iter_cmd(int iter)
 {
@@ -50,6 +50,7 @@ sta::define_cmd_args "global_placement" {\
     [-overflow overflow]\
     [-initial_place_max_iter initial_place_max_iter]\
     [-initial_place_max_fanout initial_place_max_fanout]\
+    [-initial_place_solver bicgstab|cg|cg_ichol]\
     [-routability_use_grt]\
     [-routability_target_rc_metric routability_target_rc_metric]\
     [-routability_check_overflow routability_check_overflow]\
@@ -73,6 +74,7 @@ proc global_placement { args } {
       -min_phi_coef -max_phi_coef -overflow \
       -reference_hpwl \
       -initial_place_max_iter -initial_place_max_fanout \
+      -initial_place_solver \
       -routability_check_overflow -routability_max_density \
       -routability_max_bloat_iter -routability_max_inflation_iter \
       -routability_target_rc_metric \
@@ -174,6 +176,15 @@ proc global_placement { args } {
     gpl::set_initial_place_max_fanout_cmd $initial_place_max_fanout
   }
 
+  if { [info exists keys(-initial_place_solver)] } {
+    set initial_place_solver $keys(-initial_place_solver)
+    if { [lsearch {bicgstab cg cg_ichol} $initial_place_solver] == -1 } {
+      utl::error GPL 155 \
+        "-initial_place_solver must be bicgstab, cg or cg_ichol."
+    }
+    gpl::set_initial_place_solver_cmd $initial_place_solver
+  }
+
   # density settings
   set target_density 0.7
   set uniform_mode 0
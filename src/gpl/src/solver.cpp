@@ -35,10 +35,95 @@
 
 #include "solver.h"
 
+#include <algorithm>
+#include <utility>
+
 namespace gpl {
 
-ResidualError cpuSparseSolve(int maxSolverIter,
+// Returns false, leaving instLocVec untouched, if the preconditioner can't be
+// computed or the solve breaks down. Running out of iterations is not a
+// failure: maxSolverIter is meant to cut the solve short.
+template <typename Solver>
+static bool solve(int maxSolverIter,
+                  const SMatrix& placeInstForceMatrix,
+                  const Eigen::VectorXf& fixedInstForceVec,
+                  Eigen::VectorXf& instLocVec,
+                  int& solverIter,
+                  float& error)
+{
+  Solver solver;
+  solver.setMaxIterations(maxSolverIter);
+  solver.compute(placeInstForceMatrix);
+  if (solver.info() != Eigen::Success) {
+    return false;
+  }
+  Eigen::VectorXf solution
+      = solver.solveWithGuess(fixedInstForceVec, instLocVec);
+  if ((solver.info() != Eigen::Success
+       && solver.info() != Eigen::NoConvergence)
+      || !solution.allFinite()) {
+    return false;
+  }
+  instLocVec = std::move(solution);
+  solverIter = solver.iterations();
+  error = solver.error();
+  return true;
+}
+
+// The B2B matrices are symmetric and positive (semi-)definite, so CG applies.
+// Lower|Upper lets Eigen use the full row-major matrix in the products.
+// A failed CG solve is redone with BiCGSTAB; failed is set when that happens.
+static float solve(InitialPlaceSolver solverType,
+                   int maxSolverIter,
+                   const SMatrix& placeInstForceMatrix,
+                   const Eigen::VectorXf& fixedInstForceVec,
+                   Eigen::VectorXf& instLocVec,
+                   int& solverIter,
+                   bool& failed)
+{
+  float error = 0;
+  failed = false;
+  switch (solverType) {
+    case InitialPlaceSolver::CG:
+      failed = !solve<ConjugateGradient<SMatrix,
+                                        Eigen::Lower | Eigen::Upper,
+                                        DiagonalPreconditioner<float>>>(
+          maxSolverIter,
+          placeInstForceMatrix,
+          fixedInstForceVec,
+          instLocVec,
+          solverIter,
+          error);
+      break;
+    case InitialPlaceSolver::CGIncompleteCholesky:
+      failed = !solve<ConjugateGradient<SMatrix,
+                                        Eigen::Lower | Eigen::Upper,
+                                        IncompleteCholesky<float>>>(
+          maxSolverIter,
+          placeInstForceMatrix,
+          fixedInstForceVec,
+          instLocVec,
+          solverIter,
+          error);
+      break;
+    case InitialPlaceSolver::BiCGSTAB:
+      break;
+  }
+  if (solverType == InitialPlaceSolver::BiCGSTAB || failed) {
+    solve<BiCGSTAB<SMatrix, IdentityPreconditioner>>(maxSolverIter,
+                                                     placeInstForceMatrix,
+                                                     fixedInstForceVec,
+                                                     instLocVec,
+                                                     solverIter,
+                                                     error);
+  }
+  return error;
+}
+
+ResidualError cpuSparseSolve(InitialPlaceSolver& solverType,
+                             int maxSolverIter,
                              int iter,
+                             int threads,
                              SMatrix& placeInstForceMatrixX,
                              Eigen::VectorXf& fixedInstForceVecX,
                              Eigen::VectorXf& instLocVecX,
@@ -48,15 +133,48 @@ ResidualError cpuSparseSolve(int maxSolverIter,
                              utl::Logger* logger)
 {
   ResidualError error;
-  BiCGSTAB<SMatrix, IdentityPreconditioner> solver;
-  solver.setMaxIterations(maxSolverIter);
-  solver.compute(placeInstForceMatrixX);
-  instLocVecX = solver.solveWithGuess(fixedInstForceVecX, instLocVecX);
-  error.x = solver.error();
-
-  solver.compute(placeInstForceMatrixY);
-  instLocVecY = solver.solveWithGuess(fixedInstForceVecY, instLocVecY);
-  error.y = solver.error();
+  int solverIterX = 0;
+  int solverIterY = 0;
+  bool failedX = false;
+  bool failedY = false;
+  // X and Y are solved concurrently on one thread each. The parallel
+  // region of Eigen's products nested in a section runs on that thread, so
+  // the process-wide Eigen thread count is left alone.
+#pragma omp parallel sections num_threads(std::min(threads, 2))
+  {
+#pragma omp section
+    error.x = solve(solverType,
+                    maxSolverIter,
+                    placeInstForceMatrixX,
+                    fixedInstForceVecX,
+                    instLocVecX,
+                    solverIterX,
+                    failedX);
+#pragma omp section
+    error.y = solve(solverType,
+                    maxSolverIter,
+                    placeInstForceMatrixY,
+                    fixedInstForceVecY,
+                    instLocVecY,
+                    solverIterY,
+                    failedY);
+  }
+  if (failedX || failedY) {
+    logger->warn(GPL,
+                 137,
+                 "Initial place iter {}: the CG solver failed, falling back "
+                 "to BiCGSTAB.",
+                 iter);
+    solverType = InitialPlaceSolver::BiCGSTAB;
+  }
+  debugPrint(logger,
+             GPL,
+             "initialPlace",
+             1,
+             "Iter {} solver iterations X: {} Y: {}",
+             iter,
+             solverIterX,
+             solverIterY);
   return error;
 }
 }  // namespace gpl
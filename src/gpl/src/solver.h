@@ -39,6 +39,7 @@
 #include <Eigen/SparseCore>
 #include <memory>
 
+#include "gpl/Replace.h"
 #include "graphics.h"
 #include "odb/db.h"
 #include "placerBase.h"
@@ -57,13 +58,21 @@ struct ResidualError
 };
 
 using Eigen::BiCGSTAB;
+using Eigen::ConjugateGradient;
+using Eigen::DiagonalPreconditioner;
 using Eigen::IdentityPreconditioner;
+using Eigen::IncompleteCholesky;
 using utl::GPL;
 
 using SMatrix = Eigen::SparseMatrix<float, Eigen::RowMajor>;
 
-ResidualError cpuSparseSolve(int maxSolverIter,
+// Solves the X and Y systems concurrently with the given solver when threads
+// is above one. If a CG solve fails, it is redone with BiCGSTAB and
+// solverType is switched to BiCGSTAB.
+ResidualError cpuSparseSolve(InitialPlaceSolver& solverType,
+                             int maxSolverIter,
                              int iter,
+                             int threads,
                              SMatrix& placeInstForceMatrixX,
                              Eigen::VectorXf& fixedInstForceVecX,
                              Eigen::VectorXf& instLocVecX,
@@ -146,4 +146,30 @@ TEST(FloatFFTTest, Basic)
   }
 }
 
+TEST(FloatFFTTest, ThreadedMatchesSerial)
+{
+  const int x_max = 64;
+  const int y_max = 32;
+  std::unique_ptr<gpl::FFT> serial(new gpl::FFT(x_max, y_max, 4, 8));
+  std::unique_ptr<gpl::FFT> threaded(new gpl::FFT(x_max, y_max, 4, 8, 4));
+
+  for (int y = 0; y < y_max; y++) {
+    for (int x = 0; x < x_max; x++) {
+      const float density = ((x * 7 + y * 13) % 17) / 17.0f;
+      serial->updateDensity(x, y, density);
+      threaded->updateDensity(x, y, density);
+    }
+  }
+
+  serial->doFFT();
+  threaded->doFFT();
+
+  for (int y = 0; y < y_max; y++) {
+    for (int x = 0; x < x_max; x++) {
+      EXPECT_EQ(serial->getElectroForce(x, y), threaded->getElectroForce(x, y));
+      EXPECT_EQ(serial->getElectroPhi(x, y), threaded->getElectroPhi(x, y));
+    }
+  }
+}
+
 }  // namespace
@@ -15,6 +15,7 @@ record_tests {
   simple04
   simple05
   simple06
+  simple06-cg
   simple07
   simple08
   simple09
@@ -0,0 +1,8 @@
+# The CG solvers are checked against BiCGSTAB in solver_test
+source helpers.tcl
+set test_name simple06-cg
+read_lef ./nangate45.lef
+read_def ./simple06.def
+
+catch {global_placement -skip_nesterov_place -initial_place_solver gmres} error
+puts $error
@@ -0,0 +1,134 @@
+#include "src/gpl/src/solver.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utl/Logger.h"
+
+namespace gpl {
+namespace {
+
+// A symmetric, diagonally dominant tridiagonal system like the B2B ones.
+SMatrix makeMatrix(int n)
+{
+  std::vector<Eigen::Triplet<float>> triplets;
+  for (int i = 0; i < n; i++) {
+    triplets.emplace_back(i, i, 4.0);
+    if (i > 0) {
+      triplets.emplace_back(i, i - 1, -1.0);
+      triplets.emplace_back(i - 1, i, -1.0);
+    }
+  }
+  SMatrix matrix(n, n);
+  matrix.setFromTriplets(triplets.begin(), triplets.end());
+  return matrix;
+}
+
+Eigen::VectorXf makeVector(int n, float offset)
+{
+  Eigen::VectorXf vec(n);
+  for (int i = 0; i < n; i++) {
+    vec[i] = offset + (i % 7);
+  }
+  return vec;
+}
+
+struct Systems
+{
+  explicit Systems(int n)
+      : matrix_x(makeMatrix(n)),
+        matrix_y(makeMatrix(n)),
+        fixed_x(makeVector(n, 1.0)),
+        fixed_y(makeVector(n, 3.0)),
+        loc_x(Eigen::VectorXf::Zero(n)),
+        loc_y(Eigen::VectorXf::Zero(n))
+  {
+  }
+
+  ResidualError solve(InitialPlaceSolver& solver_type,
+                      int threads,
+                      utl::Logger* logger)
+  {
+    return cpuSparseSolve(solver_type,
+                          100,
+                          1,
+                          threads,
+                          matrix_x,
+                          fixed_x,
+                          loc_x,
+                          matrix_y,
+                          fixed_y,
+                          loc_y,
+                          logger);
+  }
+
+  SMatrix matrix_x;
+  SMatrix matrix_y;
+  Eigen::VectorXf fixed_x;
+  Eigen::VectorXf fixed_y;
+  Eigen::VectorXf loc_x;
+  Eigen::VectorXf loc_y;
+};
+
+TEST(SolverTest, CgMatchesBicgstab)
+{
+  utl::Logger logger;
+  const int n = 200;
+  for (const InitialPlaceSolver type : {InitialPlaceSolver::CG,
+                                        InitialPlaceSolver::CGIncompleteCholesky}) {
+    Systems cg(n);
+    Systems bicgstab(n);
+    InitialPlaceSolver cg_type = type;
+    InitialPlaceSolver bicgstab_type = InitialPlaceSolver::BiCGSTAB;
+
+    const ResidualError cg_error = cg.solve(cg_type, 2, &logger);
+    bicgstab.solve(bicgstab_type, 2, &logger);
+
+    EXPECT_EQ(cg_type, type);
+    EXPECT_LT(cg_error.x, 1e-5);
+    EXPECT_LT(cg_error.y, 1e-5);
+    EXPECT_LT((cg.matrix_x * cg.loc_x - cg.fixed_x).norm(),
+              1e-4 * cg.fixed_x.norm());
+    EXPECT_LT((cg.matrix_y * cg.loc_y - cg.fixed_y).norm(),
+              1e-4 * cg.fixed_y.norm());
+    EXPECT_LT((cg.loc_x - bicgstab.loc_x).norm(), 1e-4 * cg.loc_x.norm());
+    EXPECT_LT((cg.loc_y - bicgstab.loc_y).norm(), 1e-4 * cg.loc_y.norm());
+  }
+}
+
+TEST(SolverTest, ThreadCountDoesNotChangeSolution)
+{
+  utl::Logger logger;
+  const int n = 200;
+  Systems serial(n);
+  Systems threaded(n);
+  InitialPlaceSolver serial_type = InitialPlaceSolver::CG;
+  InitialPlaceSolver threaded_type = InitialPlaceSolver::CG;
+
+  serial.solve(serial_type, 1, &logger);
+  threaded.solve(threaded_type, 4, &logger);
+
+  EXPECT_EQ(serial.loc_x, threaded.loc_x);
+  EXPECT_EQ(serial.loc_y, threaded.loc_y);
+}
+
+TEST(SolverTest, FailedCgFallsBackToBicgstab)
+{
+  utl::Logger logger;
+  const int n = 20;
+  Systems systems(n);
+  systems.fixed_x[0] = std::numeric_limits<float>::quiet_NaN();
+  InitialPlaceSolver type = InitialPlaceSolver::CG;
+
+  systems.solve(type, 2, &logger);
+
+  // The non-finite CG solution is dropped and later solves use BiCGSTAB.
+  EXPECT_EQ(type, InitialPlaceSolver::BiCGSTAB);
+  EXPECT_TRUE(systems.loc_x.allFinite());
+  EXPECT_TRUE(systems.loc_y.allFinite());
+}
+
+}  // namespace
+}  // namespace gpl
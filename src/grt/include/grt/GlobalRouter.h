@@ -174,6 +174,7 @@ class GlobalRouter : public ant::GlobalRouteSource
                            int layer,
                            float reduction_percentage);
   void setVerbose(const bool v);
+  void setNumThreads(int num_threads);
   void setOverflowIterations(int iterations);
   void setCongestionReportIterStep(int congestion_report_iter_step);
   void setCongestionReportFile(const char* file_name);
@@ -462,6 +463,7 @@ class GlobalRouter : public ant::GlobalRouteSource
   std::vector<RegionAdjustment> region_adjustments_;
 
   bool verbose_;
+  int num_threads_;
   int min_layer_for_clock_;
   int max_layer_for_clock_;
 
@@ -534,9 +536,18 @@ class IncrementalGRoute
   // Disables db callbacks.
   ~IncrementalGRoute();
 
+  // Statistics accumulated over all calls to updateRoutes.
+  int getUpdateCount() const { return update_count_; }
+  int getReroutedNetCount() const { return rerouted_net_count_; }
+  // Wall time spent in updateRoutes, in seconds.
+  double getRuntime() const { return runtime_; }
+
  private:
   GlobalRouter* groute_;
   GRouteDbCbk db_cbk_;
+  int update_count_;
+  int rerouted_net_count_;
+  double runtime_;
 };
 
 }  // namespace grt
@@ -72,6 +72,7 @@
 #include "stt/SteinerTreeBuilder.h"
 #include "utl/Logger.h"
 #include "utl/algorithms.h"
+#include "utl/timer.h"
 
 namespace grt {
 
@@ -98,6 +99,7 @@ GlobalRouter::GlobalRouter()
       macro_extension_(0),
       initialized_(false),
       verbose_(false),
+      num_threads_(1),
       min_layer_for_clock_(-1),
       max_layer_for_clock_(-2),
       seed_(0),
@@ -374,7 +376,7 @@ void GlobalRouter::repairAntennas(odb::dbMTerm* diode_mterm,
                                                           num_threads);
     if (violations) {
       IncrementalGRoute incr_groute(this, block_);
-      repair_antennas_->repairAntennas(diode_mterm);
+      repair_antennas_->repairAntennas(diode_mterm, num_threads);
       logger_->info(
           GRT, 15, "Inserted {} diodes.", repair_antennas_->getDiodesCount());
       int illegal_diode_placement_count
@@ -1568,6 +1570,11 @@ void GlobalRouter::setVerbose(const bool v)
   verbose_ = v;
 }
 
+void GlobalRouter::setNumThreads(int num_threads)
+{
+  num_threads_ = num_threads;
+}
+
 void GlobalRouter::setOverflowIterations(int iterations)
 {
   overflow_iterations_ = iterations;
@@ -1684,6 +1691,7 @@ void GlobalRouter::ensureLayerForGuideDimension(int max_routing_layer)
 void GlobalRouter::configFastRoute()
 {
   fastroute_->setVerbose(verbose_);
+  fastroute_->setNumThreads(num_threads_);
   fastroute_->setOverflowIterations(overflow_iterations_);
   fastroute_->setCongestionReportIterStep(congestion_report_iter_step_);
 
@@ -4246,19 +4254,47 @@ bool operator<(const RoutePt& p1, const RoutePt& p2)
 ////////////////////////////////////////////////////////////////
 
 IncrementalGRoute::IncrementalGRoute(GlobalRouter* groute, odb::dbBlock* block)
-    : groute_(groute), db_cbk_(groute)
+    : groute_(groute),
+      db_cbk_(groute),
+      update_count_(0),
+      rerouted_net_count_(0),
+      runtime_(0)
 {
   db_cbk_.addOwner(block);
 }
 
 std::vector<Net*> IncrementalGRoute::updateRoutes(bool save_guides)
 {
-  return groute_->updateDirtyRoutes(save_guides);
+  utl::Timer timer;
+  std::vector<Net*> rerouted_nets = groute_->updateDirtyRoutes(save_guides);
+  const double runtime = timer.elapsed();
+
+  update_count_++;
+  rerouted_net_count_ += rerouted_nets.size();
+  runtime_ += runtime;
+  debugPrint(groute_->logger_,
+             GRT,
+             "incr",
+             1,
+             "Incremental update {}: rerouted {} nets in {:.3f}s.",
+             update_count_,
+             rerouted_nets.size(),
+             runtime);
+
+  return rerouted_nets;
 }
 
 IncrementalGRoute::~IncrementalGRoute()
 {
   db_cbk_.removeOwner();
+  debugPrint(groute_->logger_,
+             GRT,
+             "incr",
+             1,
+             "Incremental routing: {} updates rerouted {} nets in {:.3f}s.",
+             update_count_,
+             rerouted_net_count_,
+             runtime_);
 }
 
 void GlobalRouter::setRenderer(
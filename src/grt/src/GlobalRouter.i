@@ -188,6 +188,8 @@ set_perturbation_amount(int perturbation)
 void
 global_route(bool start_incremental, bool end_incremental)
 {
+  const int num_threads = ord::OpenRoad::openRoad()->getThreadCount();
+  getGlobalRouter()->setNumThreads(num_threads);
   getGlobalRouter()->globalRoute(true, start_incremental, end_incremental);
 }
 
@@ -67,9 +67,11 @@ RepairAntennas::RepairAntennas(GlobalRouter* grouter,
       illegal_diode_placement_count_(0)
 {
   block_ = db_->getChip()->getBlock();
-  while (block_->findInst(
-      fmt::format("ANTENNA_{}", unique_diode_index_).c_str())) {
-    unique_diode_index_++;
+  for (odb::dbInst* inst : block_->getInsts()) {
+    const std::string name = inst->getName();
+    if (name.compare(0, diode_prefix_.size(), diode_prefix_) == 0) {
+      diode_names_.addName(name);
+    }
   }
 }
 
@@ -439,7 +441,8 @@ void RepairAntennas::destroyNetWires(
   }
 }
 
-void RepairAntennas::repairAntennas(odb::dbMTerm* diode_mterm)
+void RepairAntennas::repairAntennas(odb::dbMTerm* diode_mterm,
+                                    const int num_threads)
 {
   int site_width = -1;
   r_tree fixed_insts;
@@ -466,7 +469,9 @@ void RepairAntennas::repairAntennas(odb::dbMTerm* diode_mterm)
 
   setInstsPlacementStatus(odb::dbPlacementStatus::FIRM);
   getFixedInstances(fixed_insts);
+  core_area_ = block_->getCoreArea();
 
+  std::vector<DiodeSite> diodes;
   bool repair_failures = false;
   for (auto const& net_violations : antenna_violations_) {
     odb::dbNet* db_net = net_violations.first;
@@ -486,12 +491,8 @@ void RepairAntennas::repairAntennas(odb::dbMTerm* diode_mterm)
           for (int j = 0; j < violation.diode_count_per_gate; j++) {
             odb::dbTechLayer* violation_layer
                 = tech->findRoutingLayer(violation.routing_level);
-            insertDiode(db_net,
-                        diode_mterm,
-                        gate,
-                        site_width,
-                        fixed_insts,
-                        violation_layer);
+            diodes.push_back(
+                makeDiode(db_net, diode_mterm, gate, violation_layer));
             inserted_diodes = true;
           }
         }
@@ -501,6 +502,59 @@ void RepairAntennas::repairAntennas(odb::dbMTerm* diode_mterm)
     if (inserted_diodes)
       grouter_->addDirtyNet(db_net);
   }
+
+  // Search the diode sites in parallel. Each thread gets a contiguous chunk
+  // of diodes and sees the fixed instances plus the diodes of its chunk
+  // placed before, i.e. a subset of the diodes placed before each one.
+  std::vector<int> diode_chunk(diodes.size());
+#pragma omp parallel num_threads(num_threads)
+  {
+    r_tree placed_diodes;
+#pragma omp for schedule(static)
+    for (int i = 0; i < diodes.size(); i++) {
+      DiodeSite& diode = diodes[i];
+      diode_chunk[i] = omp_get_thread_num();
+      setDiodeLoc(diode, site_width, fixed_insts, placed_diodes);
+      placed_diodes.insert(value(
+          box(point(diode.rect.xMin(), diode.rect.yMin()),
+              point(diode.rect.xMax(), diode.rect.yMax())),
+          i));
+    }
+  }
+
+  // Commit in order. As long as the earlier diodes of its chunk kept their
+  // sites, a diode was checked against a subset of the diodes placed before
+  // it, so a legal site is the first legal one of the serial search unless
+  // it collides with a diode of another chunk. Otherwise the search is redone
+  // against all the diodes committed so far: for a collision, for an illegal
+  // result (the colliding diode may have moved away), and for every diode
+  // following a re-placed one in its chunk. The outcome matches a fully
+  // serial insertion.
+  const r_tree no_diodes;
+  std::vector<char> chunk_replaced(std::max(num_threads, 1), false);
+  int resolved_conflicts = 0;
+  for (int i = 0; i < diodes.size(); i++) {
+    DiodeSite& diode = diodes[i];
+    char& replaced = chunk_replaced[diode_chunk[i]];
+    if (replaced || !diode.legally_placed
+        || !checkDiodeLoc(diode, site_width, fixed_insts)) {
+      const odb::Rect chunk_rect = diode.rect;
+      setDiodeLoc(diode, site_width, fixed_insts, no_diodes);
+      if (diode.rect != chunk_rect) {
+        replaced = true;
+        resolved_conflicts++;
+      }
+    }
+    insertDiode(diode, diode_mterm, fixed_insts);
+  }
+  debugPrint(logger_,
+             GRT,
+             "repair_antennas",
+             1,
+             "{} diodes placed, {} re-placed after thread conflicts",
+             diodes.size(),
+             resolved_conflicts);
+
   if (repair_failures)
     logger_->warn(GRT, 243, "Unable to repair antennas on net with diodes.");
 }
@@ -512,36 +566,53 @@ void RepairAntennas::legalizePlacedCells()
   setInstsPlacementStatus(odb::dbPlacementStatus::PLACED);
 }
 
-void RepairAntennas::insertDiode(odb::dbNet* net,
-                                 odb::dbMTerm* diode_mterm,
-                                 odb::dbITerm* gate,
-                                 int site_width,
-                                 r_tree& fixed_insts,
-                                 odb::dbTechLayer* violation_layer)
+RepairAntennas::DiodeSite RepairAntennas::makeDiode(
+    odb::dbNet* net,
+    odb::dbMTerm* diode_mterm,
+    odb::dbITerm* gate,
+    odb::dbTechLayer* violation_layer)
 {
   odb::dbMaster* diode_master = diode_mterm->getMaster();
-  std::string diode_inst_name
-      = "ANTENNA_" + std::to_string(unique_diode_index_++);
+  const std::string diode_inst_name = diode_names_.makeName(
+      diode_prefix_, unique_diode_index_, [this](const std::string& name) {
+        return block_->findInst(name.c_str()) != nullptr;
+      });
   odb::dbInst* diode_inst
       = odb::dbInst::create(block_, diode_master, diode_inst_name.c_str());
 
-  bool place_vertically
+  DiodeSite diode;
+  diode.net = net;
+  diode.gate = gate;
+  diode.diode_inst = diode_inst;
+  diode.place_vertically
       = violation_layer->getDirection() == odb::dbTechLayerDir::VERTICAL;
-  bool legally_placed = setDiodeLoc(
-      diode_inst, gate, site_width, place_vertically, fixed_insts);
+  diode.left_pad = opendp_->padLeft(diode_inst);
+  diode.right_pad = opendp_->padRight(diode_inst);
+  diode.orient = diode_inst->getOrient();
+  diode.rect = diode_inst->getBBox()->getBox();
+  diode.legally_placed = false;
+  return diode;
+}
+
+void RepairAntennas::insertDiode(DiodeSite& diode,
+                                 odb::dbMTerm* diode_mterm,
+                                 r_tree& fixed_insts)
+{
+  odb::dbInst* diode_inst = diode.diode_inst;
+  diode_inst->setOrient(diode.orient);
+  diode_inst->setLocation(diode.rect.xMin(), diode.rect.yMin());
 
   odb::Rect inst_rect = diode_inst->getBBox()->getBox();
 
-  legally_placed = legally_placed && diodeInRow(inst_rect);
+  bool legally_placed = diode.legally_placed && diodeInRow(inst_rect);
 
   if (!legally_placed)
     illegal_diode_placement_count_++;
 
   // allow detailed placement to move diodes with geometry out of the core area,
   // or near macro pins (can be placed out of row), or illegal placed diodes
-  const odb::Rect& core_area = block_->getCoreArea();
-  odb::dbInst* sink_inst = gate->getInst();
-  if (core_area.contains(inst_rect) && !sink_inst->getMaster()->isBlock()
+  odb::dbInst* sink_inst = diode.gate->getInst();
+  if (core_area_.contains(inst_rect) && !sink_inst->getMaster()->isBlock()
       && legally_placed) {
     diode_inst->setPlacementStatus(odb::dbPlacementStatus::FIRM);
   } else {
@@ -550,7 +621,7 @@ void RepairAntennas::insertDiode(odb::dbNet* net,
 
   odb::dbITerm* diode_iterm
       = diode_inst->findITerm(diode_mterm->getConstName());
-  diode_iterm->connect(net);
+  diode_iterm->connect(diode.net);
   diode_insts_.push_back(diode_inst);
 
   // Add diode to the R-tree of fixed instances
@@ -597,11 +668,11 @@ void RepairAntennas::setInstsPlacementStatus(
   }
 }
 
-bool RepairAntennas::setDiodeLoc(odb::dbInst* diode_inst,
-                                 odb::dbITerm* gate,
-                                 int site_width,
-                                 const bool place_vertically,
-                                 r_tree& fixed_insts)
+// Only reads the db, so it is safe to call from several threads.
+void RepairAntennas::setDiodeLoc(DiodeSite& diode,
+                                 const int site_width,
+                                 const r_tree& fixed_insts,
+                                 const r_tree& placed_diodes)
 {
   const int max_legalize_itr = 50;
   bool place_at_left = true;
@@ -613,19 +684,25 @@ bool RepairAntennas::setDiodeLoc(odb::dbInst* diode_inst,
 
   int inst_loc_x, inst_loc_y, inst_width, inst_height;
   odb::dbOrientType inst_orient;
-  getInstancePlacementData(
-      gate, inst_loc_x, inst_loc_y, inst_width, inst_height, inst_orient);
-
-  odb::dbBox* diode_bbox = diode_inst->getBBox();
-  int diode_width = diode_bbox->xMax() - diode_bbox->xMin();
-  int diode_height = diode_bbox->yMax() - diode_bbox->yMin();
-  odb::dbInst* sink_inst = gate->getInst();
+  getInstancePlacementData(diode.gate,
+                           inst_loc_x,
+                           inst_loc_y,
+                           inst_width,
+                           inst_height,
+                           inst_orient);
+
+  odb::dbMaster* diode_master = diode.diode_inst->getMaster();
+  odb::Rect boundary;
+  diode_master->getPlacementBoundary(boundary);
+  int diode_width = boundary.dx();
+  int diode_height = boundary.dy();
+  odb::dbInst* sink_inst = diode.gate->getInst();
 
   // Use R-tree to check if diode will not overlap or cause 1-site spacing with
   // other fixed cells
   int legalize_itr = 0;
   while (!legally_placed && legalize_itr < max_legalize_itr) {
-    if (place_vertically) {
+    if (diode.place_vertically) {
       computeVerticalOffset(inst_height,
                             top_offset,
                             bottom_offset,
@@ -640,22 +717,26 @@ bool RepairAntennas::setDiodeLoc(odb::dbInst* diode_inst,
                               place_at_left,
                               horizontal_offset);
     }
-    diode_inst->setOrient(inst_orient);
-    if (sink_inst->isBlock() || sink_inst->isPad() || place_vertically) {
+    diode.orient = inst_orient;
+    if (sink_inst->isBlock() || sink_inst->isPad() || diode.place_vertically) {
       int x_center = inst_loc_x + horizontal_offset + diode_width / 2;
       int y_center = inst_loc_y + vertical_offset + diode_height / 2;
       odb::Point diode_center(x_center, y_center);
-      odb::dbOrientType orient = getRowOrient(diode_center);
-      diode_inst->setOrient(orient);
+      diode.orient = getRowOrient(diode_center);
     }
-    diode_inst->setLocation(inst_loc_x + horizontal_offset,
-                            inst_loc_y + vertical_offset);
-
-    legally_placed = checkDiodeLoc(diode_inst, site_width, fixed_insts);
+    // Same box as dbInst::setLocation gives for this orientation.
+    odb::Rect oriented = boundary;
+    odb::dbTransform(diode.orient).apply(oriented);
+    const int x = inst_loc_x + horizontal_offset;
+    const int y = inst_loc_y + vertical_offset;
+    diode.rect = odb::Rect(x, y, x + oriented.dx(), y + oriented.dy());
+
+    legally_placed = checkDiodeLoc(diode, site_width, fixed_insts)
+                     && checkDiodeLoc(diode, site_width, placed_diodes);
     legalize_itr++;
   }
 
-  return legally_placed;
+  diode.legally_placed = legally_placed;
 }
 
 void RepairAntennas::getInstancePlacementData(odb::dbITerm* gate,
@@ -674,23 +755,19 @@ void RepairAntennas::getInstancePlacementData(odb::dbITerm* gate,
   inst_orient = sink_inst->getOrient();
 }
 
-bool RepairAntennas::checkDiodeLoc(odb::dbInst* diode_inst,
+bool RepairAntennas::checkDiodeLoc(const DiodeSite& diode,
                                    const int site_width,
-                                   r_tree& fixed_insts)
+                                   const r_tree& insts)
 {
-  const odb::Rect& core_area = block_->getCoreArea();
-  const int left_pad = opendp_->padLeft(diode_inst);
-  const int right_pad = opendp_->padRight(diode_inst);
-  odb::dbBox* instBox = diode_inst->getBBox();
-  box box(point(instBox->xMin() - ((left_pad + right_pad) * site_width) + 1,
-                instBox->yMin() + 1),
-          point(instBox->xMax() + ((left_pad + right_pad) * site_width) - 1,
-                instBox->yMax() - 1));
+  const odb::Rect& rect = diode.rect;
+  const int pad = (diode.left_pad + diode.right_pad) * site_width;
+  box box(point(rect.xMin() - pad + 1, rect.yMin() + 1),
+          point(rect.xMax() + pad - 1, rect.yMax() - 1));
 
   std::vector<value> overlap_insts;
-  fixed_insts.query(bgi::intersects(box), std::back_inserter(overlap_insts));
+  insts.query(bgi::intersects(box), std::back_inserter(overlap_insts));
 
-  return overlap_insts.empty() && core_area.contains(instBox->getBox());
+  return overlap_insts.empty() && core_area_.contains(rect);
 }
 
 void RepairAntennas::computeHorizontalOffset(const int diode_width,
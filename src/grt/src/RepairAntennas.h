@@ -48,6 +48,7 @@
 #include "odb/dbShape.h"
 #include "odb/wOrder.h"
 #include "sta/Liberty.hh"
+#include "utl/NameAllocator.h"
 
 // Forward declaration protects FastRoute code from any
 // header file from the DB. FastRoute code keeps independent.
@@ -99,7 +100,7 @@ class RepairAntennas
   void checkNetViolations(odb::dbNet* db_net,
                           odb::dbMTerm* diode_mterm,
                           float ratio_margin);
-  void repairAntennas(odb::dbMTerm* diode_mterm);
+  void repairAntennas(odb::dbMTerm* diode_mterm, int num_threads);
   int illegalDiodePlacementCount() const
   {
     return illegal_diode_placement_count_;
@@ -127,28 +128,44 @@ class RepairAntennas
   typedef std::pair<box, int> value;
   typedef bgi::rtree<value, bgi::quadratic<8, 4>> r_tree;
 
-  void insertDiode(odb::dbNet* net,
+  // A diode to insert next to a gate. The site is computed from geometry
+  // only, so the search can run in parallel before anything is committed
+  // to the db.
+  struct DiodeSite
+  {
+    odb::dbNet* net;
+    odb::dbITerm* gate;
+    odb::dbInst* diode_inst;
+    bool place_vertically;
+    int left_pad;
+    int right_pad;
+    odb::dbOrientType orient;
+    odb::Rect rect;
+    bool legally_placed;
+  };
+
+  DiodeSite makeDiode(odb::dbNet* net,
+                      odb::dbMTerm* diode_mterm,
+                      odb::dbITerm* gate,
+                      odb::dbTechLayer* violation_layer);
+  void insertDiode(DiodeSite& diode,
                    odb::dbMTerm* diode_mterm,
-                   odb::dbITerm* sink_iterm,
-                   int site_width,
-                   r_tree& fixed_insts,
-                   odb::dbTechLayer* violation_layer);
+                   r_tree& fixed_insts);
   void getFixedInstances(r_tree& fixed_insts);
   void setInstsPlacementStatus(odb::dbPlacementStatus placement_status);
-  bool setDiodeLoc(odb::dbInst* diode_inst,
-                   odb::dbITerm* gate,
+  void setDiodeLoc(DiodeSite& diode,
                    int site_width,
-                   bool place_vertically,
-                   r_tree& fixed_insts);
+                   const r_tree& fixed_insts,
+                   const r_tree& placed_diodes);
   void getInstancePlacementData(odb::dbITerm* gate,
                                 int& inst_loc_x,
                                 int& inst_loc_y,
                                 int& inst_width,
                                 int& inst_height,
                                 odb::dbOrientType& inst_orient);
-  bool checkDiodeLoc(odb::dbInst* diode_inst,
+  bool checkDiodeLoc(const DiodeSite& diode,
                      int site_width,
-                     r_tree& fixed_insts);
+                     const r_tree& insts);
   void computeHorizontalOffset(int diode_width,
                                int inst_width,
                                int site_width,
@@ -193,9 +210,12 @@ class RepairAntennas
   odb::dbDatabase* db_;
   utl::Logger* logger_;
   odb::dbBlock* block_;
+  odb::Rect core_area_;
   std::vector<odb::dbInst*> diode_insts_;
   AntennaViolations antenna_violations_;
   int unique_diode_index_;
+  utl::NameAllocator diode_names_;
+  const std::string diode_prefix_ = "ANTENNA_";
   int illegal_diode_placement_count_;
 };
 
@@ -91,6 +91,41 @@ struct DebugSetting
   bool isOn() const { return renderer_ != nullptr; }
 };
 
+// Scratch state used to maze route one net at a time. Each thread routing
+// nets in parallel owns one of these.
+struct MazeScratch
+{
+  std::vector<float*> src_heap;
+  std::vector<float*> dest_heap;
+  multi_array<float, 2> d1;
+  multi_array<float, 2> d2;
+  std::vector<bool> pop_heap2;
+  std::vector<OrderNetEdge> net_eo;
+  // used edges, merged into h_used_ggrid_/v_used_ggrid_ after routing
+  std::vector<std::pair<int, int>> h_used_ggrid;
+  std::vector<std::pair<int, int>> v_used_ggrid;
+  // expansion of the last edge ripped up, -1 if no edge was ripped up
+  int last_enlarge = -1;
+  // set when the region of an edge does not fit in the window of the net
+  bool escaped = false;
+};
+
+// The state of a net saved before it is maze routed in a parallel batch.
+// Routing the net only changes the usage of the edges inside its window, so
+// restoring the tree and those usages undoes it.
+struct MazeNetUndo
+{
+  int net_index = -1;  // index of the net in the routing order
+  StTree tree;
+  bool critical = false;
+  std::vector<uint16_t> h_usage;
+  std::vector<uint16_t> v_usage;
+  // used edges of the net, merged into h_used_ggrid_/v_used_ggrid_ unless
+  // the routing is undone
+  std::vector<std::pair<int, int>> h_used_ggrid;
+  std::vector<std::pair<int, int>> v_used_ggrid;
+};
+
 using stt::Tree;
 
 class FastRouteCore
@@ -195,6 +230,7 @@ class FastRouteCore
   void setCriticalNetsPercentage(float u);
   float getCriticalNetsPercentage() { return critical_nets_percentage_; };
   void setMakeWireParasiticsBuilder(AbstractMakeWireParasitics* builder);
+  void setNumThreads(int num_threads);
   void setOverflowIterations(int iterations);
   void setCongestionReportIterStep(int congestion_report_iter_step);
   void setCongestionReportFile(const char* congestion_file_name);
@@ -259,6 +295,43 @@ class FastRouteCore
                      const int slope,
                      const int L,
                      float& slack_th);
+  void mazeRouteMSMDParallel(const std::vector<int>& net_order,
+                             const int iter,
+                             const int expand,
+                             const float cost_height,
+                             const int ripup_threshold,
+                             const int maze_edge_threshold,
+                             const int cost_type,
+                             const float logis_cof,
+                             const int via,
+                             const int slope,
+                             const int L,
+                             const float slack_th);
+  bool mazeRouteMSMDNet(const int netID,
+                        const int iter,
+                        const int expand,
+                        const float cost_height,
+                        const int ripup_threshold,
+                        const int maze_edge_threshold,
+                        const int cost_type,
+                        const float logis_cof,
+                        const int via,
+                        const int slope,
+                        const int L,
+                        const float slack_th,
+                        const odb::Rect& window,
+                        MazeScratch& scratch);
+  odb::Rect mazeRouteWindow(const int netID, const int iter, const int expand);
+  void initMazeScratch(MazeScratch& scratch);
+  void commitUsedGgrids(MazeScratch& scratch);
+  void commitUsedGgrids(MazeNetUndo& undo);
+  void saveMazeNet(const int netID,
+                   const odb::Rect& window,
+                   MazeNetUndo& undo);
+  void restoreMazeNet(const int netID,
+                      const odb::Rect& window,
+                      MazeNetUndo& undo);
+  void updateEnlarge(MazeScratch& scratch);
   void convertToMazeroute();
   void updateCongestionHistory(const int upType, bool stopDEC, int& max_adj);
   int getOverflow2D(int* maxOverflow);
@@ -394,6 +467,10 @@ class FastRouteCore
 
   // rsmt functions
   void copyStTree(const int ind, const Tree& rsmt);
+  int makeRSMT(const int netID,
+               const bool congestionDriven,
+               const bool noADJ,
+               Tree& rsmt);
   void gen_brk_RSMT(const bool congestionDriven,
                     const bool reRoute,
                     const bool genTree,
@@ -506,7 +583,7 @@ class FastRouteCore
   float CalculatePartialSlack();
   bool checkRoute2DTree(int netID);
   void removeLoops();
-  void netedgeOrderDec(int netID);
+  void netedgeOrderDec(int netID, std::vector<OrderNetEdge>& net_eo);
   void printTree2D(int netID);
   void printEdge2D(int netID, int edgeID);
   void printEdge3D(int netID, int edgeID);
@@ -572,6 +649,7 @@ class FastRouteCore
   float h_capacity_lb_;
   bool regular_x_;
   bool regular_y_;
+  int num_threads_;
 
   std::vector<short> v_capacity_3D_;
   std::vector<short> h_capacity_3D_;
@@ -594,7 +672,6 @@ class FastRouteCore
 
   std::vector<FrNet*> nets_;
   std::unordered_map<odb::dbNet*, int> db_net_id_map_;  // db net -> net id
-  std::vector<OrderNetEdge> net_eo_;
   std::vector<std::vector<int>>
       gxs_;  // the copy of xs for nets, used for second FLUTE
   std::vector<std::vector<int>>
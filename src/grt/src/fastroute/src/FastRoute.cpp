@@ -82,6 +82,7 @@ FastRouteCore::FastRouteCore(odb::dbDatabase* db,
       h_capacity_lb_(0),
       regular_x_(false),
       regular_y_(false),
+      num_threads_(1),
       logger_(log),
       stt_builder_(stt_builder),
       debug_(new DebugSetting())
@@ -123,8 +124,6 @@ void FastRouteCore::clear()
   parent_x3_.resize(boost::extents[0][0]);
   parent_y3_.resize(boost::extents[0][0]);
 
-  net_eo_.clear();
-
   xcor_.clear();
   ycor_.clear();
   dcor_.clear();
@@ -970,7 +969,6 @@ NetRouteMap FastRouteCore::run()
   xcor_.resize(max_degree2);
   ycor_.resize(max_degree2);
   dcor_.resize(max_degree2);
-  net_eo_.reserve(max_degree2);
 
   int THRESH_M = 20;
   const int ENLARGE = 15;  // 5
@@ -1389,7 +1387,6 @@ NetRouteMap FastRouteCore::run()
   }
 
   NetRouteMap routes = getRoutes();
-  net_eo_.clear();
   net_ids_.clear();
   return routes;
 }
@@ -1410,6 +1407,11 @@ void FastRouteCore::setMakeWireParasiticsBuilder(
   parasitics_builder_ = builder;
 }
 
+void FastRouteCore::setNumThreads(int num_threads)
+{
+  num_threads_ = std::max(1, num_threads);
+}
+
 void FastRouteCore::setOverflowIterations(int iterations)
 {
   overflow_iterations_ = iterations;
@@ -30,12 +30,15 @@
 // POSSIBILITY OF SUCH DAMAGE.
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <omp.h>
+
 #include <algorithm>
 
 #include "AbstractFastRouteRenderer.h"
 #include "DataType.h"
 #include "FastRoute.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 namespace grt {
 
@@ -639,6 +642,65 @@ float FastRouteCore::coeffADJ(const int netID)
   return coef;
 }
 
+int FastRouteCore::makeRSMT(const int netID,
+                            const bool congestionDriven,
+                            const bool noADJ,
+                            Tree& rsmt)
+{
+  FrNet* net = nets_[netID];
+  const int d = net->getNumPins();
+  const int flute_accuracy = 2;
+  int numShift = 0;
+
+  // check net alpha because FastRoute has a special implementation of flute
+  // TODO: move this flute implementation to SteinerTreeBuilder
+  const float net_alpha = stt_builder_->getAlpha(net->getDbNet());
+  if (net_alpha > 0.0) {
+    rsmt = stt_builder_->makeSteinerTree(
+        net->getDbNet(), net->getPinX(), net->getPinY(), net->getDriverIdx());
+  } else {
+    float coeffV = 1.36;
+
+    if (congestionDriven) {
+      // call congestion driven flute to generate RSMT
+      bool cong;
+      coeffV = noADJ ? 1.2 : coeffADJ(netID);
+      cong = netCongestion(netID);
+      if (cong) {
+        fluteCongest(netID,
+                     net->getPinX(),
+                     net->getPinY(),
+                     flute_accuracy,
+                     coeffV,
+                     rsmt);
+      } else {
+        fluteNormal(netID,
+                    net->getPinX(),
+                    net->getPinY(),
+                    flute_accuracy,
+                    coeffV,
+                    rsmt);
+      }
+      if (d > 3) {
+        numShift += edgeShiftNew(rsmt, netID);
+      }
+    } else {
+      // call FLUTE to generate RSMT for each net
+      if (noADJ || HTreeSuite(netID)) {
+        coeffV = 1.2;
+      }
+      fluteNormal(netID,
+                  net->getPinX(),
+                  net->getPinY(),
+                  flute_accuracy,
+                  coeffV,
+                  rsmt);
+    }
+  }
+
+  return numShift;
+}
+
 void FastRouteCore::gen_brk_RSMT(const bool congestionDriven,
                                  const bool reRoute,
                                  const bool genTree,
@@ -652,9 +714,29 @@ void FastRouteCore::gen_brk_RSMT(const bool congestionDriven,
   int wl1 = 0;
   int totalNumSeg = 0;
 
-  const int flute_accuracy = 2;
+  // With multiple threads, the trees of all nets are built in parallel and
+  // the routes and usages are then updated serially. Congestion driven trees
+  // read the usage left by the nets before them, so they are built serially
+  // to keep the results of a single-threaded run.
+  const bool parallel = num_threads_ > 1 && !congestionDriven;
+  std::vector<Tree> trees;
+  if (parallel) {
+    trees.resize(net_ids_.size());
+    utl::ThreadException exception;
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic) \
+    reduction(+ : numShift)
+    for (int i = 0; i < (int) net_ids_.size(); i++) {  // NOLINT
+      try {
+        numShift += makeRSMT(net_ids_[i], congestionDriven, noADJ, trees[i]);
+      } catch (...) {
+        exception.capture();
+      }
+    }
+    exception.rethrow();
+  }
 
-  for (const int& netID : net_ids_) {
+  for (int i = 0; i < net_ids_.size(); i++) {
+    const int netID = net_ids_[i];
     FrNet* net = nets_[netID];
 
     int d = net->getNumPins();
@@ -684,51 +766,12 @@ void FastRouteCore::gen_brk_RSMT(const bool congestionDriven,
       }
     }
 
-    // check net alpha because FastRoute has a special implementation of flute
-    // TODO: move this flute implementation to SteinerTreeBuilder
-    const float net_alpha = stt_builder_->getAlpha(net->getDbNet());
-    if (net_alpha > 0.0) {
-      rsmt = stt_builder_->makeSteinerTree(
-          net->getDbNet(), net->getPinX(), net->getPinY(), net->getDriverIdx());
+    if (parallel) {
+      rsmt = std::move(trees[i]);
     } else {
-      float coeffV = 1.36;
-
-      if (congestionDriven) {
-        // call congestion driven flute to generate RSMT
-        bool cong;
-        coeffV = noADJ ? 1.2 : coeffADJ(netID);
-        cong = netCongestion(netID);
-        if (cong) {
-          fluteCongest(netID,
-                       net->getPinX(),
-                       net->getPinY(),
-                       flute_accuracy,
-                       coeffV,
-                       rsmt);
-        } else {
-          fluteNormal(netID,
-                      net->getPinX(),
-                      net->getPinY(),
-                      flute_accuracy,
-                      coeffV,
-                      rsmt);
-        }
-        if (d > 3) {
-          numShift += edgeShiftNew(rsmt, netID);
-        }
-      } else {
-        // call FLUTE to generate RSMT for each net
-        if (noADJ || HTreeSuite(netID)) {
-          coeffV = 1.2;
-        }
-        fluteNormal(netID,
-                    net->getPinX(),
-                    net->getPinY(),
-                    flute_accuracy,
-                    coeffV,
-                    rsmt);
-      }
+      numShift += makeRSMT(netID, congestionDriven, noADJ, rsmt);
     }
+
     if (debug_->isOn() && debug_->steinerTree_
         && net->getDbNet() == debug_->net_) {
       steinerTreeVisualization(rsmt, net);
@@ -30,11 +30,15 @@
 // POSSIBILITY OF SUCH DAMAGE.
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <omp.h>
+
 #include <algorithm>
+#include <iterator>
 
 #include "DataType.h"
 #include "FastRoute.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 namespace grt {
 
@@ -1317,8 +1321,6 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
                                   float& slack_th)
 {
   // maze routing for multi-source, multi-destination
-  int tmpX, tmpY;
-
   const int max_usage_multiplier = 40;
 
   // allocate memory for distance and parent and pop_heap
@@ -1346,790 +1348,1257 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
     StNetOrder();
   }
 
-  std::vector<float*> src_heap;
-  std::vector<float*> dest_heap;
-  src_heap.reserve(y_grid_ * x_grid_);
-  dest_heap.reserve(y_grid_ * x_grid_);
+  std::vector<int> net_order;
+  net_order.reserve(net_ids_.size());
+  for (int nidRPC = 0; nidRPC < net_ids_.size(); nidRPC++) {
+    net_order.push_back(ordering ? tree_order_cong_[nidRPC].treeIndex
+                                 : net_ids_[nidRPC]);
+  }
+
+  if (num_threads_ > 1) {
+    mazeRouteMSMDParallel(net_order,
+                          iter,
+                          expand,
+                          cost_height,
+                          ripup_threshold,
+                          maze_edge_threshold,
+                          cost_type,
+                          logis_cof,
+                          via,
+                          slope,
+                          L,
+                          slack_th);
+  } else {
+    MazeScratch scratch;
+    initMazeScratch(scratch);
+    const odb::Rect grid_window(0, 0, x_grid_ - 1, y_grid_ - 1);
+    for (int nidRPC = 0; nidRPC < net_order.size(); nidRPC++) {
+      const int netID = net_order[nidRPC];
+      const bool routed = mazeRouteMSMDNet(netID,
+                                           iter,
+                                           expand,
+                                           cost_height,
+                                           ripup_threshold,
+                                           maze_edge_threshold,
+                                           cost_type,
+                                           logis_cof,
+                                           via,
+                                           slope,
+                                           L,
+                                           slack_th,
+                                           grid_window,
+                                           scratch);
+      commitUsedGgrids(scratch);
+      updateEnlarge(scratch);
+      if (!routed) {
+        reInitTree(netID);
+        nidRPC--;
+      }
+    }
+  }
 
-  multi_array<float, 2> d1(boost::extents[y_range_][x_range_]);
-  multi_array<float, 2> d2(boost::extents[y_range_][x_range_]);
+  h_cost_table_.clear();
+  v_cost_table_.clear();
+}
 
-  std::vector<bool> pop_heap2(y_grid_ * x_range_, false);
+void FastRouteCore::initMazeScratch(MazeScratch& scratch)
+{
+  scratch.src_heap.reserve(y_grid_ * x_grid_);
+  scratch.dest_heap.reserve(y_grid_ * x_grid_);
+  scratch.d1.resize(boost::extents[y_range_][x_range_]);
+  scratch.d2.resize(boost::extents[y_range_][x_range_]);
+  scratch.pop_heap2.assign(y_grid_ * x_range_, false);
+}
 
-  for (int nidRPC = 0; nidRPC < net_ids_.size(); nidRPC++) {
-    const int netID
-        = ordering ? tree_order_cong_[nidRPC].treeIndex : net_ids_[nidRPC];
+void FastRouteCore::commitUsedGgrids(MazeScratch& scratch)
+{
+  h_used_ggrid_.insert(scratch.h_used_ggrid.begin(),
+                       scratch.h_used_ggrid.end());
+  v_used_ggrid_.insert(scratch.v_used_ggrid.begin(),
+                       scratch.v_used_ggrid.end());
+  scratch.h_used_ggrid.clear();
+  scratch.v_used_ggrid.clear();
+}
+
+void FastRouteCore::commitUsedGgrids(MazeNetUndo& undo)
+{
+  h_used_ggrid_.insert(undo.h_used_ggrid.begin(), undo.h_used_ggrid.end());
+  v_used_ggrid_.insert(undo.v_used_ggrid.begin(), undo.v_used_ggrid.end());
+  undo.h_used_ggrid.clear();
+  undo.v_used_ggrid.clear();
+}
+
+void FastRouteCore::saveMazeNet(const int netID,
+                                const odb::Rect& window,
+                                MazeNetUndo& undo)
+{
+  undo.tree = sttrees_[netID];
+  undo.critical = nets_[netID]->isCritical();
+  undo.h_usage.clear();
+  undo.v_usage.clear();
+  for (int y = window.yMin(); y <= window.yMax(); y++) {
+    for (int x = window.xMin(); x < window.xMax(); x++) {
+      undo.h_usage.push_back(h_edges_[y][x].usage);
+    }
+  }
+  for (int y = window.yMin(); y < window.yMax(); y++) {
+    for (int x = window.xMin(); x <= window.xMax(); x++) {
+      undo.v_usage.push_back(v_edges_[y][x].usage);
+    }
+  }
+}
+
+void FastRouteCore::restoreMazeNet(const int netID,
+                                   const odb::Rect& window,
+                                   MazeNetUndo& undo)
+{
+  sttrees_[netID] = std::move(undo.tree);
+  nets_[netID]->setIsCritical(undo.critical);
+  int i = 0;
+  for (int y = window.yMin(); y <= window.yMax(); y++) {
+    for (int x = window.xMin(); x < window.xMax(); x++) {
+      h_edges_[y][x].usage = undo.h_usage[i++];
+    }
+  }
+  i = 0;
+  for (int y = window.yMin(); y < window.yMax(); y++) {
+    for (int x = window.xMin(); x <= window.xMax(); x++) {
+      v_edges_[y][x].usage = undo.v_usage[i++];
+    }
+  }
+  undo.h_used_ggrid.clear();
+  undo.v_used_ggrid.clear();
+}
+
+// The expansion of the last edge ripped up is kept in enlarge_, which
+// FastRouteCore::run uses as the base expansion of the next iteration.
+void FastRouteCore::updateEnlarge(MazeScratch& scratch)
+{
+  if (scratch.last_enlarge >= 0) {
+    enlarge_ = scratch.last_enlarge;
+    scratch.last_enlarge = -1;
+  }
+}
 
-    const int num_terminals = sttrees_[netID].num_terminals;
+// The window of a net is the bounding box of its tree nodes and routes,
+// enlarged by the maximum expansion used for its edges.  The grid positions
+// read or written while maze routing the net usually fall inside it; when
+// the tree grows past it, mazeRouteMSMDNet stops and sets scratch.escaped.
+odb::Rect FastRouteCore::mazeRouteWindow(const int netID,
+                                         const int iter,
+                                         const int expand)
+{
+  const auto& treeedges = sttrees_[netID].edges;
+  const auto& treenodes = sttrees_[netID].nodes;
 
-    const int origENG = expand;
+  odb::Rect window;
+  window.mergeInit();
+  for (const TreeNode& node : treenodes) {
+    window.merge(odb::Rect(node.x, node.y, node.x, node.y));
+  }
+  int max_routelen = 0;
+  for (const TreeEdge& edge : treeedges) {
+    max_routelen = std::max(max_routelen, edge.route.routelen);
+    if (edge.route.type != RouteType::MazeRoute) {
+      continue;
+    }
+    for (int i = 0; i <= edge.route.routelen; i++) {
+      const int x = edge.route.gridsX[i];
+      const int y = edge.route.gridsY[i];
+      window.merge(odb::Rect(x, y, x, y));
+    }
+  }
 
-    netedgeOrderDec(netID);
+  const int enlarge = std::min(expand, (iter / 6 + 3) * max_routelen);
+  return odb::Rect(std::max(window.xMin() - enlarge, 0),
+                   std::max(window.yMin() - enlarge, 0),
+                   std::min(window.xMax() + enlarge, x_grid_ - 1),
+                   std::min(window.yMax() + enlarge, y_grid_ - 1));
+}
 
-    auto& treeedges = sttrees_[netID].edges;
-    auto& treenodes = sttrees_[netID].nodes;
-    // loop for all the tree edges
-    const int num_edges = sttrees_[netID].num_edges();
-    for (int edgeREC = 0; edgeREC < num_edges; edgeREC++) {
-      const int edgeID = net_eo_[edgeREC].edgeID;
-      TreeEdge* treeedge = &(treeedges[edgeID]);
-
-      int n1 = treeedge->n1;
-      int n2 = treeedge->n2;
-      const int n1x = treenodes[n1].x;
-      const int n1y = treenodes[n1].y;
-      const int n2x = treenodes[n2].x;
-      const int n2y = treenodes[n2].y;
-      treeedge->len = abs(n2x - n1x) + abs(n2y - n1y);
-
-      if (treeedge->len
-          <= maze_edge_threshold)  // only route the non-degraded edges (len>0)
-      {
-        continue;
+// Routes the nets in batches whose windows do not overlap, so the nets of a
+// batch touch disjoint edges and grid positions and can be routed
+// concurrently.  Nets that overlap a net left for a later batch are also
+// delayed, which keeps overlapping nets in their original order.
+//
+// A net that escapes its window or has to rebuild its tree is undone and
+// queued again with the whole grid as its window, so it is later routed
+// alone.  Every net routed so far that follows it in the net order is
+// undone and queued again too, as it may depend on its routing; the undo
+// records of a net are kept until no net before it remains to be routed.
+// The result is then the same as routing the nets serially, whatever the
+// thread count.
+void FastRouteCore::mazeRouteMSMDParallel(const std::vector<int>& net_order,
+                                          const int iter,
+                                          const int expand,
+                                          const float cost_height,
+                                          const int ripup_threshold,
+                                          const int maze_edge_threshold,
+                                          const int cost_type,
+                                          const float logis_cof,
+                                          const int via,
+                                          const int slope,
+                                          const int L,
+                                          const float slack_th)
+{
+  const int net_count = net_order.size();
+  std::vector<odb::Rect> windows(net_count);
+#pragma omp parallel for num_threads(num_threads_)
+  for (int i = 0; i < net_count; i++) {
+    windows[i] = mazeRouteWindow(net_order[i], iter, expand);
+  }
+
+  // Windows are checked for overlaps in a coarse grid of bins.
+  const int max_bins_per_dim = 256;
+  const int bin_size
+      = std::max(1, std::max(x_grid_, y_grid_) / max_bins_per_dim + 1);
+  const int x_bins = (x_grid_ + bin_size - 1) / bin_size;
+  const int y_bins = (y_grid_ + bin_size - 1) / bin_size;
+  multi_array<int, 2> routed_stamp(boost::extents[y_bins][x_bins]);
+  multi_array<int, 2> delayed_stamp(boost::extents[y_bins][x_bins]);
+  std::fill_n(routed_stamp.data(), routed_stamp.num_elements(), -1);
+  std::fill_n(delayed_stamp.data(), delayed_stamp.num_elements(), -1);
+
+  const int max_batch_size = 32 * num_threads_;
+  const int max_scanned = 4 * max_batch_size;
+
+  std::vector<MazeScratch> scratches(num_threads_);
+  for (MazeScratch& scratch : scratches) {
+    initMazeScratch(scratch);
+  }
+
+  const odb::Rect grid_window(0, 0, x_grid_ - 1, y_grid_ - 1);
+  // the expansion of the last edge ripped up by each net
+  std::vector<int> net_enlarge(net_count, -1);
+  std::vector<int> delayed;  // indexes in net_order, kept in order
+  std::vector<int> batch;
+  std::vector<int> skipped;
+  // routed nets that may still be undone, in routing order
+  std::vector<MazeNetUndo> kept;
+  int delayed_begin = 0;
+  int next = 0;
+  int batch_count = 0;
+  int requeued_count = 0;
+  while (delayed_begin < delayed.size() || next < net_count) {
+    batch.clear();
+    skipped.clear();
+    int scanned = 0;
+    // returns true if the net was added to the batch
+    auto schedule = [&](const int idx) {
+      const odb::Rect& window = windows[idx];
+      const int bx1 = window.xMin() / bin_size;
+      const int bx2 = window.xMax() / bin_size;
+      const int by1 = window.yMin() / bin_size;
+      const int by2 = window.yMax() / bin_size;
+      bool overlaps = false;
+      for (int y = by1; y <= by2 && !overlaps; y++) {
+        for (int x = bx1; x <= bx2; x++) {
+          if (routed_stamp[y][x] == batch_count
+              || delayed_stamp[y][x] == batch_count) {
+            overlaps = true;
+            break;
+          }
+        }
+      }
+      auto& stamp = overlaps ? delayed_stamp : routed_stamp;
+      for (int y = by1; y <= by2; y++) {
+        for (int x = bx1; x <= bx2; x++) {
+          stamp[y][x] = batch_count;
+        }
+      }
+      return !overlaps;
+    };
+
+    int delayed_idx = delayed_begin;
+    for (; delayed_idx < delayed.size() && scanned < max_scanned
+           && batch.size() < max_batch_size;
+         delayed_idx++, scanned++) {
+      const int idx = delayed[delayed_idx];
+      if (schedule(idx)) {
+        batch.push_back(idx);
+      } else {
+        skipped.push_back(idx);
+      }
+    }
+    // the skipped nets stay right before the unscanned delayed nets
+    delayed_begin = delayed_idx - skipped.size();
+    std::copy(skipped.begin(), skipped.end(), delayed.begin() + delayed_begin);
+    if (delayed_idx == delayed.size()) {
+      for (; next < net_count && scanned < max_scanned
+             && batch.size() < max_batch_size;
+           next++, scanned++) {
+        if (schedule(next)) {
+          batch.push_back(next);
+        } else {
+          delayed.push_back(next);
+        }
+      }
+    }
+
+    std::vector<char> routed(batch.size(), false);
+    std::vector<char> undone(batch.size(), false);
+    std::vector<MazeNetUndo> undos(batch.size());
+    utl::ThreadException exception;
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+    for (int i = 0; i < (int) batch.size(); i++) {  // NOLINT
+      try {
+        const int idx = batch[i];
+        const int netID = net_order[idx];
+        const odb::Rect& window = windows[idx];
+        // a net with the whole grid as window is alone in its batch
+        const bool alone = window == grid_window;
+        MazeScratch& scratch = scratches[omp_get_thread_num()];
+        MazeNetUndo& undo = undos[i];
+        if (!alone) {
+          saveMazeNet(netID, window, undo);
+        }
+        routed[i] = mazeRouteMSMDNet(netID,
+                                     iter,
+                                     expand,
+                                     cost_height,
+                                     ripup_threshold,
+                                     maze_edge_threshold,
+                                     cost_type,
+                                     logis_cof,
+                                     via,
+                                     slope,
+                                     L,
+                                     slack_th,
+                                     window,
+                                     scratch);
+        if (!routed[i] && !alone) {
+          restoreMazeNet(netID, window, undo);
+          undone[i] = true;
+          scratch.h_used_ggrid.clear();
+          scratch.v_used_ggrid.clear();
+        } else {
+          net_enlarge[idx] = scratch.last_enlarge;
+          undo.h_used_ggrid.swap(scratch.h_used_ggrid);
+          undo.v_used_ggrid.swap(scratch.v_used_ggrid);
+        }
+        scratch.last_enlarge = -1;
+        scratch.escaped = false;
+      } catch (...) {
+        exception.capture();
       }
+    }
+    exception.rethrow();
 
-      const bool enter = newRipupCheck(treeedge,
-                                       n1x,
-                                       n1y,
-                                       n2x,
-                                       n2y,
-                                       ripup_threshold,
-                                       slack_th,
-                                       netID,
-                                       edgeID);
-
-      if (!enter) {
+    int first_undone = net_count;
+    for (int i = 0; i < batch.size(); i++) {
+      if (undone[i]) {
+        first_undone = std::min(first_undone, batch[i]);
+      }
+    }
+    std::vector<int> requeued;
+    for (int i = 0; i < batch.size(); i++) {
+      const int idx = batch[i];
+      if (undone[i]) {
+        windows[idx] = grid_window;
+        requeued.push_back(idx);
+      } else if (windows[idx] == grid_window) {
+        // a net routed alone is never undone
+        commitUsedGgrids(undos[i]);
+      } else {
+        undos[i].net_index = idx;
+        kept.push_back(std::move(undos[i]));
+      }
+    }
+    // The nets routed after an undone net in net_order may depend on its
+    // routing, including those of earlier batches.  They are undone from
+    // the last one routed to the first.
+    for (auto it = kept.rbegin(); it != kept.rend(); it++) {
+      const int idx = it->net_index;
+      if (idx > first_undone) {
+        restoreMazeNet(net_order[idx], windows[idx], *it);
+        net_enlarge[idx] = -1;
+        requeued.push_back(idx);
+        it->net_index = -1;
+      }
+    }
+    kept.erase(std::remove_if(kept.begin(),
+                              kept.end(),
+                              [](const MazeNetUndo& undo) {
+                                return undo.net_index < 0;
+                              }),
+               kept.end());
+    if (!requeued.empty()) {
+      std::sort(requeued.begin(), requeued.end());
+      std::vector<int> pending(delayed.begin() + delayed_begin, delayed.end());
+      delayed.clear();
+      std::merge(requeued.begin(),
+                 requeued.end(),
+                 pending.begin(),
+                 pending.end(),
+                 std::back_inserter(delayed));
+      delayed_begin = 0;
+      requeued_count += requeued.size();
+    }
+
+    // A net ahead of every net still to route can no longer be undone.
+    const int first_pending
+        = delayed_begin < delayed.size() ? delayed[delayed_begin] : next;
+    auto final_end = std::stable_partition(
+        kept.begin(), kept.end(), [first_pending](const MazeNetUndo& undo) {
+          return undo.net_index < first_pending;
+        });
+    for (auto it = kept.begin(); it != final_end; it++) {
+      commitUsedGgrids(*it);
+    }
+    kept.erase(kept.begin(), final_end);
+
+    // a net routed alone with an invalid tree is rebuilt and routed again
+    MazeScratch& scratch = scratches[0];
+    for (int i = 0; i < batch.size(); i++) {
+      if (routed[i] || undone[i]) {
         continue;
       }
+      const int netID = net_order[batch[i]];
+      bool rerouted = false;
+      while (!rerouted) {
+        reInitTree(netID);
+        rerouted = mazeRouteMSMDNet(netID,
+                                    iter,
+                                    expand,
+                                    cost_height,
+                                    ripup_threshold,
+                                    maze_edge_threshold,
+                                    cost_type,
+                                    logis_cof,
+                                    via,
+                                    slope,
+                                    L,
+                                    slack_th,
+                                    grid_window,
+                                    scratch);
+        commitUsedGgrids(scratch);
+        if (scratch.last_enlarge >= 0) {
+          net_enlarge[batch[i]] = scratch.last_enlarge;
+          scratch.last_enlarge = -1;
+        }
+      }
+    }
+
+    batch_count++;
+  }
 
-      // ripup the routing for the edge
-      const int ymin = std::min(n1y, n2y);
-      const int ymax = std::max(n1y, n2y);
+  // Delayed nets are routed after some nets that follow them in net_order,
+  // so enlarge_ is taken from the last net in net_order that ripped up an
+  // edge, as in the serial routing.
+  for (auto it = net_enlarge.rbegin(); it != net_enlarge.rend(); it++) {
+    if (*it >= 0) {
+      enlarge_ = *it;
+      break;
+    }
+  }
 
-      const int xmin = std::min(n1x, n2x);
-      const int xmax = std::max(n1x, n2x);
+  debugPrint(logger_,
+             GRT,
+             "maze_2d",
+             1,
+             "Routed {} nets in {} batches using {} threads, {} nets routed "
+             "again.",
+             net_count,
+             batch_count,
+             num_threads_,
+             requeued_count);
+}
 
-      enlarge_ = std::min(origENG, (iter / 6 + 3) * treeedge->route.routelen);
+bool FastRouteCore::mazeRouteMSMDNet(const int netID,
+                                     const int iter,
+                                     const int expand,
+                                     const float cost_height,
+                                     const int ripup_threshold,
+                                     const int maze_edge_threshold,
+                                     const int cost_type,
+                                     const float logis_cof,
+                                     const int via,
+                                     const int slope,
+                                     const int L,
+                                     const float slack_th,
+                                     const odb::Rect& window,
+                                     MazeScratch& scratch)
+{
+  int tmpX, tmpY;
 
-      int decrease = 0;
+  std::vector<float*>& src_heap = scratch.src_heap;
+  std::vector<float*>& dest_heap = scratch.dest_heap;
+  multi_array<float, 2>& d1 = scratch.d1;
+  multi_array<float, 2>& d2 = scratch.d2;
+  std::vector<bool>& pop_heap2 = scratch.pop_heap2;
+  std::vector<OrderNetEdge>& net_eo = scratch.net_eo;
 
-      if (nets_[netID]->isCritical()) {
-        decrease = std::min((iter / 7) * 5, enlarge_ / 2);
-      }
-      const int regionX1 = std::max(xmin - enlarge_ + decrease, 0);
-      const int regionX2 = std::min(xmax + enlarge_ - decrease, x_grid_ - 1);
-      const int regionY1 = std::max(ymin - enlarge_ + decrease, 0);
-      const int regionY2 = std::min(ymax + enlarge_ - decrease, y_grid_ - 1);
-
-      // initialize d1[][] and d2[][] as BIG_INT
-      for (int i = regionY1; i <= regionY2; i++) {
-        for (int j = regionX1; j <= regionX2; j++) {
-          d1[i][j] = BIG_INT;
-          d2[i][j] = BIG_INT;
-          hyper_h_[i][j] = false;
-          hyper_v_[i][j] = false;
-        }
+
+  const int num_terminals = sttrees_[netID].num_terminals;
+
+  const int origENG = expand;
+
+  netedgeOrderDec(netID, net_eo);
+
+  auto& treeedges = sttrees_[netID].edges;
+  auto& treenodes = sttrees_[netID].nodes;
+  // loop for all the tree edges
+  const int num_edges = sttrees_[netID].num_edges();
+  for (int edgeREC = 0; edgeREC < num_edges; edgeREC++) {
+    const int edgeID = net_eo[edgeREC].edgeID;
+    TreeEdge* treeedge = &(treeedges[edgeID]);
+
+    int n1 = treeedge->n1;
+    int n2 = treeedge->n2;
+    const int n1x = treenodes[n1].x;
+    const int n1y = treenodes[n1].y;
+    const int n2x = treenodes[n2].x;
+    const int n2y = treenodes[n2].y;
+    treeedge->len = abs(n2x - n1x) + abs(n2y - n1y);
+
+    if (treeedge->len
+        <= maze_edge_threshold)  // only route the non-degraded edges (len>0)
+    {
+      continue;
+    }
+
+    const bool enter = newRipupCheck(treeedge,
+                                     n1x,
+                                     n1y,
+                                     n2x,
+                                     n2y,
+                                     ripup_threshold,
+                                     slack_th,
+                                     netID,
+                                     edgeID);
+
+    if (!enter) {
+      continue;
+    }
+
+    // ripup the routing for the edge
+    const int ymin = std::min(n1y, n2y);
+    const int ymax = std::max(n1y, n2y);
+
+    const int xmin = std::min(n1x, n2x);
+    const int xmax = std::max(n1x, n2x);
+
+    const int enlarge
+        = std::min(origENG, (iter / 6 + 3) * treeedge->route.routelen);
+    scratch.last_enlarge = enlarge;
+
+    int decrease = 0;
+
+    if (nets_[netID]->isCritical()) {
+      decrease = std::min((iter / 7) * 5, enlarge / 2);
+    }
+    const int regionX1 = std::max(xmin - enlarge + decrease, 0);
+    const int regionX2 = std::min(xmax + enlarge - decrease, x_grid_ - 1);
+    const int regionY1 = std::max(ymin - enlarge + decrease, 0);
+    const int regionY2 = std::min(ymax + enlarge - decrease, y_grid_ - 1);
+
+    // The edges outside the window may be used by the nets routed
+    // concurrently, so the net has to be routed again with a larger window.
+    if (regionX1 < window.xMin() || regionX2 > window.xMax()
+        || regionY1 < window.yMin() || regionY2 > window.yMax()) {
+      scratch.escaped = true;
+      return false;
+    }
+
+    // initialize d1[][] and d2[][] as BIG_INT
+    for (int i = regionY1; i <= regionY2; i++) {
+      for (int j = regionX1; j <= regionX2; j++) {
+        d1[i][j] = BIG_INT;
+        d2[i][j] = BIG_INT;
+        hyper_h_[i][j] = false;
+        hyper_v_[i][j] = false;
       }
+    }
 
-      // setup src_heap, dest_heap and initialize d1[][] and d2[][] for all the
-      // grids on the two subtrees
-      setupHeap(netID,
-                edgeID,
-                src_heap,
-                dest_heap,
-                d1,
-                d2,
-                regionX1,
-                regionX2,
-                regionY1,
-                regionY2);
-
-      // while loop to find shortest path
-      int ind1 = (src_heap[0] - &d1[0][0]);
-      for (int i = 0; i < dest_heap.size(); i++)
-        pop_heap2[(dest_heap[i] - &d2[0][0])] = true;
-
-      // stop when the grid position been popped out from both src_heap and
-      // dest_heap
-      while (pop_heap2[ind1] == false) {
-        // relax all the adjacent grids within the enlarged region for
-        // source subtree
-        const int curX = ind1 % x_range_;
-        const int curY = ind1 / x_range_;
-        int preX, preY;
-        if (d1[curY][curX] != 0) {
-          if (hv_[curY][curX]) {
-            preX = parent_x1_[curY][curX];
-            preY = parent_y1_[curY][curX];
-          } else {
-            preX = parent_x3_[curY][curX];
-            preY = parent_y3_[curY][curX];
-          }
+    // setup src_heap, dest_heap and initialize d1[][] and d2[][] for all the
+    // grids on the two subtrees
+    setupHeap(netID,
+              edgeID,
+              src_heap,
+              dest_heap,
+              d1,
+              d2,
+              regionX1,
+              regionX2,
+              regionY1,
+              regionY2);
+
+    // while loop to find shortest path
+    int ind1 = (src_heap[0] - &d1[0][0]);
+    for (int i = 0; i < dest_heap.size(); i++)
+      pop_heap2[(dest_heap[i] - &d2[0][0])] = true;
+
+    // stop when the grid position been popped out from both src_heap and
+    // dest_heap
+    while (pop_heap2[ind1] == false) {
+      // relax all the adjacent grids within the enlarged region for
+      // source subtree
+      const int curX = ind1 % x_range_;
+      const int curY = ind1 / x_range_;
+      int preX, preY;
+      if (d1[curY][curX] != 0) {
+        if (hv_[curY][curX]) {
+          preX = parent_x1_[curY][curX];
+          preY = parent_y1_[curY][curX];
         } else {
-          preX = curX;
-          preY = curY;
+          preX = parent_x3_[curY][curX];
+          preY = parent_y3_[curY][curX];
         }
+      } else {
+        preX = curX;
+        preY = curY;
+      }
+
+      removeMin(src_heap);
 
-        removeMin(src_heap);
-
-        // left
-        if (curX > regionX1) {
-          float tmp, cost1, cost2;
-          const int pos1 = h_edges_[curY][curX - 1].usage_red()
-                           + L * h_edges_[curY][(curX - 1)].last_usage;
-
-          if (pos1 < h_cost_table_.size())
-            cost1 = h_cost_table_.at(pos1);
-          else
-            cost1 = getCost(
-                pos1, logis_cof, cost_height, slope, h_capacity_, cost_type);
-
-          if ((preY == curY) || (d1[curY][curX] == 0)) {
-            tmp = d1[curY][curX] + cost1;
-          } else {
-            if (curX < regionX2 - 1) {
-              const int pos2 = h_edges_[curY][curX].usage_red()
-                               + L * h_edges_[curY][curX].last_usage;
-
-              if (pos2 < h_cost_table_.size())
-                cost2 = h_cost_table_.at(pos2);
-              else
-                cost2 = getCost(pos2,
-                                logis_cof,
-                                cost_height,
-                                slope,
-                                h_capacity_,
-                                cost_type);
-
-              const int tmp_cost = d1[curY][curX + 1] + cost2;
-
-              if (tmp_cost < d1[curY][curX] + via) {
-                hyper_h_[curY][curX] = true;
-              }
+      // left
+      if (curX > regionX1) {
+        float tmp, cost1, cost2;
+        const int pos1 = h_edges_[curY][curX - 1].usage_red()
+                         + L * h_edges_[curY][(curX - 1)].last_usage;
+
+        if (pos1 < h_cost_table_.size())
+          cost1 = h_cost_table_.at(pos1);
+        else
+          cost1 = getCost(
+              pos1, logis_cof, cost_height, slope, h_capacity_, cost_type);
+
+        if ((preY == curY) || (d1[curY][curX] == 0)) {
+          tmp = d1[curY][curX] + cost1;
+        } else {
+          if (curX < regionX2 - 1) {
+            const int pos2 = h_edges_[curY][curX].usage_red()
+                             + L * h_edges_[curY][curX].last_usage;
+
+            if (pos2 < h_cost_table_.size())
+              cost2 = h_cost_table_.at(pos2);
+            else
+              cost2 = getCost(pos2,
+                              logis_cof,
+                              cost_height,
+                              slope,
+                              h_capacity_,
+                              cost_type);
+
+            const int tmp_cost = d1[curY][curX + 1] + cost2;
+
+            if (tmp_cost < d1[curY][curX] + via) {
+              hyper_h_[curY][curX] = true;
             }
-            tmp = d1[curY][curX] + via + cost1;
-          }
-          tmpX = curX - 1;  // the left neighbor
-
-          if (d1[curY][tmpX]
-              >= BIG_INT)  // left neighbor not been put into src_heap
-          {
-            d1[curY][tmpX] = tmp;
-            parent_x3_[curY][tmpX] = curX;
-            parent_y3_[curY][tmpX] = curY;
-            hv_[curY][tmpX] = false;
-            src_heap.push_back(&d1[curY][tmpX]);
-            updateHeap(src_heap, src_heap.size() - 1);
-          } else if (d1[curY][tmpX] > tmp)  // left neighbor been put into
-                                            // src_heap but needs update
-          {
-            d1[curY][tmpX] = tmp;
-            parent_x3_[curY][tmpX] = curX;
-            parent_y3_[curY][tmpX] = curY;
-            hv_[curY][tmpX] = false;
-            float* dtmp = &d1[curY][tmpX];
-            int ind = 0;
-            while (src_heap[ind] != dtmp)
-              ind++;
-            updateHeap(src_heap, ind);
           }
+          tmp = d1[curY][curX] + via + cost1;
+        }
+        tmpX = curX - 1;  // the left neighbor
+
+        if (d1[curY][tmpX]
+            >= BIG_INT)  // left neighbor not been put into src_heap
+        {
+          d1[curY][tmpX] = tmp;
+          parent_x3_[curY][tmpX] = curX;
+          parent_y3_[curY][tmpX] = curY;
+          hv_[curY][tmpX] = false;
+          src_heap.push_back(&d1[curY][tmpX]);
+          updateHeap(src_heap, src_heap.size() - 1);
+        } else if (d1[curY][tmpX] > tmp)  // left neighbor been put into
+                                          // src_heap but needs update
+        {
+          d1[curY][tmpX] = tmp;
+          parent_x3_[curY][tmpX] = curX;
+          parent_y3_[curY][tmpX] = curY;
+          hv_[curY][tmpX] = false;
+          float* dtmp = &d1[curY][tmpX];
+          int ind = 0;
+          while (src_heap[ind] != dtmp)
+            ind++;
+          updateHeap(src_heap, ind);
         }
-        // right
-        if (curX < regionX2) {
-          float tmp, cost1, cost2;
-          const int pos1 = h_edges_[curY][curX].usage_red()
-                           + L * h_edges_[curY][curX].last_usage;
-
-          if (pos1 < h_cost_table_.size())
-            cost1 = h_cost_table_.at(pos1);
-          else
-            cost1 = getCost(
-                pos1, logis_cof, cost_height, slope, h_capacity_, cost_type);
-
-          if ((preY == curY) || (d1[curY][curX] == 0)) {
-            tmp = d1[curY][curX] + cost1;
-          } else {
-            if (curX > regionX1 + 1) {
-              const int pos2 = h_edges_[curY][curX - 1].usage_red()
-                               + L * h_edges_[curY][curX - 1].last_usage;
-
-              if (pos2 < h_cost_table_.size())
-                cost2 = h_cost_table_.at(pos2);
-              else
-                cost2 = getCost(pos2,
-                                logis_cof,
-                                cost_height,
-                                slope,
-                                h_capacity_,
-                                cost_type);
-              const int tmp_cost = d1[curY][curX - 1] + cost2;
-
-              if (tmp_cost < d1[curY][curX] + via) {
-                hyper_h_[curY][curX] = true;
-              }
+      }
+      // right
+      if (curX < regionX2) {
+        float tmp, cost1, cost2;
+        const int pos1 = h_edges_[curY][curX].usage_red()
+                         + L * h_edges_[curY][curX].last_usage;
+
+        if (pos1 < h_cost_table_.size())
+          cost1 = h_cost_table_.at(pos1);
+        else
+          cost1 = getCost(
+              pos1, logis_cof, cost_height, slope, h_capacity_, cost_type);
+
+        if ((preY == curY) || (d1[curY][curX] == 0)) {
+          tmp = d1[curY][curX] + cost1;
+        } else {
+          if (curX > regionX1 + 1) {
+            const int pos2 = h_edges_[curY][curX - 1].usage_red()
+                             + L * h_edges_[curY][curX - 1].last_usage;
+
+            if (pos2 < h_cost_table_.size())
+              cost2 = h_cost_table_.at(pos2);
+            else
+              cost2 = getCost(pos2,
+                              logis_cof,
+                              cost_height,
+                              slope,
+                              h_capacity_,
+                              cost_type);
+            const int tmp_cost = d1[curY][curX - 1] + cost2;
+
+            if (tmp_cost < d1[curY][curX] + via) {
+              hyper_h_[curY][curX] = true;
             }
-            tmp = d1[curY][curX] + via + cost1;
-          }
-          tmpX = curX + 1;  // the right neighbor
-
-          if (d1[curY][tmpX]
-              >= BIG_INT)  // right neighbor not been put into src_heap
-          {
-            d1[curY][tmpX] = tmp;
-            parent_x3_[curY][tmpX] = curX;
-            parent_y3_[curY][tmpX] = curY;
-            hv_[curY][tmpX] = false;
-            src_heap.push_back(&d1[curY][tmpX]);
-            updateHeap(src_heap, src_heap.size() - 1);
-          } else if (d1[curY][tmpX] > tmp)  // right neighbor been put into
-                                            // src_heap but needs update
-          {
-            d1[curY][tmpX] = tmp;
-            parent_x3_[curY][tmpX] = curX;
-            parent_y3_[curY][tmpX] = curY;
-            hv_[curY][tmpX] = false;
-            float* dtmp = &d1[curY][tmpX];
-            int ind = 0;
-            while (src_heap[ind] != dtmp)
-              ind++;
-            updateHeap(src_heap, ind);
           }
+          tmp = d1[curY][curX] + via + cost1;
+        }
+        tmpX = curX + 1;  // the right neighbor
+
+        if (d1[curY][tmpX]
+            >= BIG_INT)  // right neighbor not been put into src_heap
+        {
+          d1[curY][tmpX] = tmp;
+          parent_x3_[curY][tmpX] = curX;
+          parent_y3_[curY][tmpX] = curY;
+          hv_[curY][tmpX] = false;
+          src_heap.push_back(&d1[curY][tmpX]);
+          updateHeap(src_heap, src_heap.size() - 1);
+        } else if (d1[curY][tmpX] > tmp)  // right neighbor been put into
+                                          // src_heap but needs update
+        {
+          d1[curY][tmpX] = tmp;
+          parent_x3_[curY][tmpX] = curX;
+          parent_y3_[curY][tmpX] = curY;
+          hv_[curY][tmpX] = false;
+          float* dtmp = &d1[curY][tmpX];
+          int ind = 0;
+          while (src_heap[ind] != dtmp)
+            ind++;
+          updateHeap(src_heap, ind);
         }
-        // bottom
-        if (curY > regionY1) {
-          float tmp, cost1, cost2;
-          const int pos1 = v_edges_[curY - 1][curX].usage_red()
-                           + L * v_edges_[curY - 1][curX].last_usage;
-
-          if (pos1 < v_cost_table_.size())
-            cost1 = v_cost_table_.at(pos1);
-          else
-            cost1 = getCost(
-                pos1, logis_cof, cost_height, slope, v_capacity_, cost_type);
-
-          if ((preX == curX) || (d1[curY][curX] == 0)) {
-            tmp = d1[curY][curX] + cost1;
-          } else {
-            if (curY < regionY2 - 1) {
-              const int pos2 = v_edges_[curY][curX].usage_red()
-                               + L * v_edges_[curY][curX].last_usage;
-
-              if (pos2 < v_cost_table_.size())
-                cost2 = v_cost_table_.at(pos2);
-              else
-                cost2 = getCost(pos2,
-                                logis_cof,
-                                cost_height,
-                                slope,
-                                v_capacity_,
-                                cost_type);
-              const int tmp_cost = d1[curY + 1][curX] + cost2;
-
-              if (tmp_cost < d1[curY][curX] + via) {
-                hyper_v_[curY][curX] = true;
-              }
+      }
+      // bottom
+      if (curY > regionY1) {
+        float tmp, cost1, cost2;
+        const int pos1 = v_edges_[curY - 1][curX].usage_red()
+                         + L * v_edges_[curY - 1][curX].last_usage;
+
+        if (pos1 < v_cost_table_.size())
+          cost1 = v_cost_table_.at(pos1);
+        else
+          cost1 = getCost(
+              pos1, logis_cof, cost_height, slope, v_capacity_, cost_type);
+
+        if ((preX == curX) || (d1[curY][curX] == 0)) {
+          tmp = d1[curY][curX] + cost1;
+        } else {
+          if (curY < regionY2 - 1) {
+            const int pos2 = v_edges_[curY][curX].usage_red()
+                             + L * v_edges_[curY][curX].last_usage;
+
+            if (pos2 < v_cost_table_.size())
+              cost2 = v_cost_table_.at(pos2);
+            else
+              cost2 = getCost(pos2,
+                              logis_cof,
+                              cost_height,
+                              slope,
+                              v_capacity_,
+                              cost_type);
+            const int tmp_cost = d1[curY + 1][curX] + cost2;
+
+            if (tmp_cost < d1[curY][curX] + via) {
+              hyper_v_[curY][curX] = true;
             }
-            tmp = d1[curY][curX] + via + cost1;
-          }
-          tmpY = curY - 1;  // the bottom neighbor
-          if (d1[tmpY][curX]
-              >= BIG_INT)  // bottom neighbor not been put into src_heap
-          {
-            d1[tmpY][curX] = tmp;
-            parent_x1_[tmpY][curX] = curX;
-            parent_y1_[tmpY][curX] = curY;
-            hv_[tmpY][curX] = true;
-            src_heap.push_back(&d1[tmpY][curX]);
-            updateHeap(src_heap, src_heap.size() - 1);
-          } else if (d1[tmpY][curX] > tmp)  // bottom neighbor been put into
-                                            // src_heap but needs update
-          {
-            d1[tmpY][curX] = tmp;
-            parent_x1_[tmpY][curX] = curX;
-            parent_y1_[tmpY][curX] = curY;
-            hv_[tmpY][curX] = true;
-            float* dtmp = &d1[tmpY][curX];
-            int ind = 0;
-            while (src_heap[ind] != dtmp)
-              ind++;
-            updateHeap(src_heap, ind);
           }
+          tmp = d1[curY][curX] + via + cost1;
+        }
+        tmpY = curY - 1;  // the bottom neighbor
+        if (d1[tmpY][curX]
+            >= BIG_INT)  // bottom neighbor not been put into src_heap
+        {
+          d1[tmpY][curX] = tmp;
+          parent_x1_[tmpY][curX] = curX;
+          parent_y1_[tmpY][curX] = curY;
+          hv_[tmpY][curX] = true;
+          src_heap.push_back(&d1[tmpY][curX]);
+          updateHeap(src_heap, src_heap.size() - 1);
+        } else if (d1[tmpY][curX] > tmp)  // bottom neighbor been put into
+                                          // src_heap but needs update
+        {
+          d1[tmpY][curX] = tmp;
+          parent_x1_[tmpY][curX] = curX;
+          parent_y1_[tmpY][curX] = curY;
+          hv_[tmpY][curX] = true;
+          float* dtmp = &d1[tmpY][curX];
+          int ind = 0;
+          while (src_heap[ind] != dtmp)
+            ind++;
+          updateHeap(src_heap, ind);
         }
-        // top
-        if (curY < regionY2) {
-          float tmp, cost1, cost2;
-          const int pos1 = v_edges_[curY][curX].usage_red()
-                           + L * v_edges_[curY][curX].last_usage;
-
-          if (pos1 < v_cost_table_.size())
-            cost1 = v_cost_table_.at(pos1);
-          else
-            cost1 = getCost(
-                pos1, logis_cof, cost_height, slope, v_capacity_, cost_type);
-
-          if ((preX == curX) || (d1[curY][curX] == 0)) {
-            tmp = d1[curY][curX] + cost1;
-          } else {
-            if (curY > regionY1 + 1) {
-              const int pos2 = v_edges_[curY - 1][curX].usage_red()
-                               + L * v_edges_[curY - 1][curX].last_usage;
-
-              if (pos2 < v_cost_table_.size())
-                cost2 = v_cost_table_.at(pos2);
-              else
-                cost2 = getCost(pos2,
-                                logis_cof,
-                                cost_height,
-                                slope,
-                                v_capacity_,
-                                cost_type);
-
-              const int tmp_cost = d1[curY - 1][curX] + cost2;
-
-              if (tmp_cost < d1[curY][curX] + via) {
-                hyper_v_[curY][curX] = true;
-              }
+      }
+      // top
+      if (curY < regionY2) {
+        float tmp, cost1, cost2;
+        const int pos1 = v_edges_[curY][curX].usage_red()
+                         + L * v_edges_[curY][curX].last_usage;
+
+        if (pos1 < v_cost_table_.size())
+          cost1 = v_cost_table_.at(pos1);
+        else
+          cost1 = getCost(
+              pos1, logis_cof, cost_height, slope, v_capacity_, cost_type);
+
+        if ((preX == curX) || (d1[curY][curX] == 0)) {
+          tmp = d1[curY][curX] + cost1;
+        } else {
+          if (curY > regionY1 + 1) {
+            const int pos2 = v_edges_[curY - 1][curX].usage_red()
+                             + L * v_edges_[curY - 1][curX].last_usage;
+
+            if (pos2 < v_cost_table_.size())
+              cost2 = v_cost_table_.at(pos2);
+            else
+              cost2 = getCost(pos2,
+                              logis_cof,
+                              cost_height,
+                              slope,
+                              v_capacity_,
+                              cost_type);
+
+            const int tmp_cost = d1[curY - 1][curX] + cost2;
+
+            if (tmp_cost < d1[curY][curX] + via) {
+              hyper_v_[curY][curX] = true;
             }
-            tmp = d1[curY][curX] + via + cost1;
-          }
-          tmpY = curY + 1;  // the top neighbor
-          if (d1[tmpY][curX]
-              >= BIG_INT)  // top neighbor not been put into src_heap
-          {
-            d1[tmpY][curX] = tmp;
-            parent_x1_[tmpY][curX] = curX;
-            parent_y1_[tmpY][curX] = curY;
-            hv_[tmpY][curX] = true;
-            src_heap.push_back(&d1[tmpY][curX]);
-            updateHeap(src_heap, src_heap.size() - 1);
-          } else if (d1[tmpY][curX] > tmp)  // top neighbor been put into
-                                            // src_heap but needs update
-          {
-            d1[tmpY][curX] = tmp;
-            parent_x1_[tmpY][curX] = curX;
-            parent_y1_[tmpY][curX] = curY;
-            hv_[tmpY][curX] = true;
-            float* dtmp = &d1[tmpY][curX];
-            int ind = 0;
-            while (src_heap[ind] != dtmp)
-              ind++;
-            updateHeap(src_heap, ind);
           }
+          tmp = d1[curY][curX] + via + cost1;
         }
+        tmpY = curY + 1;  // the top neighbor
+        if (d1[tmpY][curX]
+            >= BIG_INT)  // top neighbor not been put into src_heap
+        {
+          d1[tmpY][curX] = tmp;
+          parent_x1_[tmpY][curX] = curX;
+          parent_y1_[tmpY][curX] = curY;
+          hv_[tmpY][curX] = true;
+          src_heap.push_back(&d1[tmpY][curX]);
+          updateHeap(src_heap, src_heap.size() - 1);
+        } else if (d1[tmpY][curX] > tmp)  // top neighbor been put into
+                                          // src_heap but needs update
+        {
+          d1[tmpY][curX] = tmp;
+          parent_x1_[tmpY][curX] = curX;
+          parent_y1_[tmpY][curX] = curY;
+          hv_[tmpY][curX] = true;
+          float* dtmp = &d1[tmpY][curX];
+          int ind = 0;
+          while (src_heap[ind] != dtmp)
+            ind++;
+          updateHeap(src_heap, ind);
+        }
+      }
 
-        // update ind1 for next loop
-        ind1 = (src_heap[0] - &d1[0][0]);
+      // update ind1 for next loop
+      ind1 = (src_heap[0] - &d1[0][0]);
 
-      }  // while loop
+    }  // while loop
 
-      for (int i = 0; i < dest_heap.size(); i++)
-        pop_heap2[(dest_heap[i] - &d2[0][0])] = false;
+    for (int i = 0; i < dest_heap.size(); i++)
+      pop_heap2[(dest_heap[i] - &d2[0][0])] = false;
 
-      const int crossX = ind1 % x_range_;
-      const int crossY = ind1 / x_range_;
+    const int crossX = ind1 % x_range_;
+    const int crossY = ind1 / x_range_;
 
-      int cnt = 0;
-      int curX = crossX;
-      int curY = crossY;
-      std::vector<int> tmp_gridsX, tmp_gridsY;
-      while (d1[curY][curX] != 0)  // loop until reach subtree1
-      {
-        bool hypered = false;
-        if (cnt != 0) {
-          if (curX != tmpX && hyper_h_[curY][curX]) {
-            curX = 2 * curX - tmpX;
-            hypered = true;
-          }
+    int cnt = 0;
+    int curX = crossX;
+    int curY = crossY;
+    std::vector<int> tmp_gridsX, tmp_gridsY;
+    while (d1[curY][curX] != 0)  // loop until reach subtree1
+    {
+      bool hypered = false;
+      if (cnt != 0) {
+        if (curX != tmpX && hyper_h_[curY][curX]) {
+          curX = 2 * curX - tmpX;
+          hypered = true;
+        }
 
-          if (curY != tmpY && hyper_v_[curY][curX]) {
-            curY = 2 * curY - tmpY;
-            hypered = true;
-          }
+        if (curY != tmpY && hyper_v_[curY][curX]) {
+          curY = 2 * curY - tmpY;
+          hypered = true;
         }
-        tmpX = curX;
-        tmpY = curY;
-        if (!hypered) {
-          if (hv_[tmpY][tmpX]) {
-            curY = parent_y1_[tmpY][tmpX];
-          } else {
-            curX = parent_x3_[tmpY][tmpX];
-          }
+      }
+      tmpX = curX;
+      tmpY = curY;
+      if (!hypered) {
+        if (hv_[tmpY][tmpX]) {
+          curY = parent_y1_[tmpY][tmpX];
+        } else {
+          curX = parent_x3_[tmpY][tmpX];
         }
-        tmp_gridsX.push_back(curX);
-        tmp_gridsY.push_back(curY);
-        cnt++;
       }
-      // reverse the grids on the path
-      std::vector<int> gridsX(tmp_gridsX.rbegin(), tmp_gridsX.rend());
-      std::vector<int> gridsY(tmp_gridsY.rbegin(), tmp_gridsY.rend());
-
-      // add the connection point (crossX, crossY)
-      gridsX.push_back(crossX);
-      gridsY.push_back(crossY);
+      tmp_gridsX.push_back(curX);
+      tmp_gridsY.push_back(curY);
       cnt++;
+    }
+    // reverse the grids on the path
+    std::vector<int> gridsX(tmp_gridsX.rbegin(), tmp_gridsX.rend());
+    std::vector<int> gridsY(tmp_gridsY.rbegin(), tmp_gridsY.rend());
+
+    // add the connection point (crossX, crossY)
+    gridsX.push_back(crossX);
+    gridsY.push_back(crossY);
+    cnt++;
 
-      curX = crossX;
-      curY = crossY;
-      const int cnt_n1n2 = cnt;
-
-      // change the tree structure according to the new routing for the tree
-      // edge find E1 and E2, and the endpoints of the edges they are on
-      const int E1x = gridsX[0];
-      const int E1y = gridsY[0];
-      const int E2x = gridsX.back();
-      const int E2y = gridsY.back();
-
-      const int edge_n1n2 = edgeID;
-      // (1) consider subtree1
-      if (n1 < num_terminals && (E1x != n1x || E1y != n1y)) {
-        // split neighbor edge and return id new node
-        n1 = splitEdge(treeedges, treenodes, n2, n1, edgeID);
+    curX = crossX;
+    curY = crossY;
+    const int cnt_n1n2 = cnt;
+
+    // change the tree structure according to the new routing for the tree
+    // edge find E1 and E2, and the endpoints of the edges they are on
+    const int E1x = gridsX[0];
+    const int E1y = gridsY[0];
+    const int E2x = gridsX.back();
+    const int E2y = gridsY.back();
+
+    const int edge_n1n2 = edgeID;
+    // (1) consider subtree1
+    if (n1 < num_terminals && (E1x != n1x || E1y != n1y)) {
+      // split neighbor edge and return id new node
+      n1 = splitEdge(treeedges, treenodes, n2, n1, edgeID);
+    }
+    if (n1 >= num_terminals && (E1x != n1x || E1y != n1y))
+    // n1 is not a pin and E1!=n1, then make change to subtree1,
+    // otherwise, no change to subtree1
+    {
+      // find the endpoints of the edge E1 is on
+      const int endpt1 = treeedges[corr_edge_[E1y][E1x]].n1;
+      const int endpt2 = treeedges[corr_edge_[E1y][E1x]].n2;
+
+      // find A1, A2 and edge_n1A1, edge_n1A2
+      int A1, A2;
+      int edge_n1A1, edge_n1A2;
+      if (treenodes[n1].nbr[0] == n2) {
+        A1 = treenodes[n1].nbr[1];
+        A2 = treenodes[n1].nbr[2];
+        edge_n1A1 = treenodes[n1].edge[1];
+        edge_n1A2 = treenodes[n1].edge[2];
+      } else if (treenodes[n1].nbr[1] == n2) {
+        A1 = treenodes[n1].nbr[0];
+        A2 = treenodes[n1].nbr[2];
+        edge_n1A1 = treenodes[n1].edge[0];
+        edge_n1A2 = treenodes[n1].edge[2];
+      } else {
+        A1 = treenodes[n1].nbr[0];
+        A2 = treenodes[n1].nbr[1];
+        edge_n1A1 = treenodes[n1].edge[0];
+        edge_n1A2 = treenodes[n1].edge[1];
       }
-      if (n1 >= num_terminals && (E1x != n1x || E1y != n1y))
-      // n1 is not a pin and E1!=n1, then make change to subtree1,
-      // otherwise, no change to subtree1
+
+      if (endpt1 == n1 || endpt2 == n1)  // E1 is on (n1, A1) or (n1, A2)
       {
-        // find the endpoints of the edge E1 is on
-        const int endpt1 = treeedges[corr_edge_[E1y][E1x]].n1;
-        const int endpt2 = treeedges[corr_edge_[E1y][E1x]].n2;
-
-        // find A1, A2 and edge_n1A1, edge_n1A2
-        int A1, A2;
-        int edge_n1A1, edge_n1A2;
-        if (treenodes[n1].nbr[0] == n2) {
-          A1 = treenodes[n1].nbr[1];
-          A2 = treenodes[n1].nbr[2];
-          edge_n1A1 = treenodes[n1].edge[1];
-          edge_n1A2 = treenodes[n1].edge[2];
-        } else if (treenodes[n1].nbr[1] == n2) {
-          A1 = treenodes[n1].nbr[0];
-          A2 = treenodes[n1].nbr[2];
-          edge_n1A1 = treenodes[n1].edge[0];
-          edge_n1A2 = treenodes[n1].edge[2];
-        } else {
-          A1 = treenodes[n1].nbr[0];
-          A2 = treenodes[n1].nbr[1];
-          edge_n1A1 = treenodes[n1].edge[0];
-          edge_n1A2 = treenodes[n1].edge[1];
+        // if E1 is on (n1, A2), switch A1 and A2 so that E1 is always on
+        // (n1, A1)
+        if (endpt1 == A2 || endpt2 == A2) {
+          std::swap(A1, A2);
+          std::swap(edge_n1A1, edge_n1A2);
         }
 
-        if (endpt1 == n1 || endpt2 == n1)  // E1 is on (n1, A1) or (n1, A2)
-        {
-          // if E1 is on (n1, A2), switch A1 and A2 so that E1 is always on
-          // (n1, A1)
-          if (endpt1 == A2 || endpt2 == A2) {
-            std::swap(A1, A2);
-            std::swap(edge_n1A1, edge_n1A2);
-          }
-
-          // update route for edge (n1, A1), (n1, A2)
-          bool route_ok = updateRouteType1(netID,
-                                           treenodes,
-                                           n1,
-                                           A1,
-                                           A2,
-                                           E1x,
-                                           E1y,
-                                           treeedges,
-                                           edge_n1A1,
-                                           edge_n1A2);
-          if (!route_ok) {
-            if (verbose_)
-              logger_->error(GRT,
-                             150,
-                             "Net {} has errors during updateRouteType1.",
-                             nets_[netID]->getName());
-            reInitTree(netID);
-            nidRPC--;
+        // update route for edge (n1, A1), (n1, A2)
+        bool route_ok = updateRouteType1(netID,
+                                         treenodes,
+                                         n1,
+                                         A1,
+                                         A2,
+                                         E1x,
+                                         E1y,
+                                         treeedges,
+                                         edge_n1A1,
+                                         edge_n1A2);
+        if (!route_ok) {
+          if (verbose_)
+            logger_->error(GRT,
+                           150,
+                           "Net {} has errors during updateRouteType1.",
+                           nets_[netID]->getName());
+          return false;
+        }
+        // update position for n1
+        treenodes[n1].x = E1x;
+        treenodes[n1].y = E1y;
+      }     // if E1 is on (n1, A1) or (n1, A2)
+      else  // E1 is not on (n1, A1) or (n1, A2), but on (C1, C2)
+      {
+        const int C1 = endpt1;
+        const int C2 = endpt2;
+        const int edge_C1C2 = corr_edge_[E1y][E1x];
+
+        // update route for edge (n1, C1), (n1, C2) and (A1, A2)
+        bool route_ok = updateRouteType2(netID,
+                                         treenodes,
+                                         n1,
+                                         A1,
+                                         A2,
+                                         C1,
+                                         C2,
+                                         E1x,
+                                         E1y,
+                                         treeedges,
+                                         edge_n1A1,
+                                         edge_n1A2,
+                                         edge_C1C2);
+        if (!route_ok) {
+          debugPrint(logger_,
+                     utl::GRT,
+                     "maze_2d",
+                     1,
+                     "Net {} has errors during updateRouteType2.",
+                     nets_[netID]->getName());
+          return false;
+        }
+        // update position for n1
+        treenodes[n1].x = E1x;
+        treenodes[n1].y = E1y;
+        // update 3 edges (n1, A1)->(C1, n1), (n1, A2)->(n1, C2), (C1,
+        // C2)->(A1, A2)
+        const int edge_n1C1 = edge_n1A1;
+        treeedges[edge_n1C1].n1 = C1;
+        treeedges[edge_n1C1].n2 = n1;
+        const int edge_n1C2 = edge_n1A2;
+        treeedges[edge_n1C2].n1 = n1;
+        treeedges[edge_n1C2].n2 = C2;
+        const int edge_A1A2 = edge_C1C2;
+        treeedges[edge_A1A2].n1 = A1;
+        treeedges[edge_A1A2].n2 = A2;
+        // update nbr and edge for 5 nodes n1, A1, A2, C1, C2
+        // n1's nbr (n2, A1, A2)->(n2, C1, C2)
+        treenodes[n1].nbr[0] = n2;
+        treenodes[n1].edge[0] = edge_n1n2;
+        treenodes[n1].nbr[1] = C1;
+        treenodes[n1].edge[1] = edge_n1C1;
+        treenodes[n1].nbr[2] = C2;
+        treenodes[n1].edge[2] = edge_n1C2;
+        // A1's nbr n1->A2
+        for (int i = 0; i < 3; i++) {
+          if (treenodes[A1].nbr[i] == n1) {
+            treenodes[A1].nbr[i] = A2;
+            treenodes[A1].edge[i] = edge_A1A2;
             break;
           }
-          // update position for n1
-          treenodes[n1].x = E1x;
-          treenodes[n1].y = E1y;
-        }     // if E1 is on (n1, A1) or (n1, A2)
-        else  // E1 is not on (n1, A1) or (n1, A2), but on (C1, C2)
-        {
-          const int C1 = endpt1;
-          const int C2 = endpt2;
-          const int edge_C1C2 = corr_edge_[E1y][E1x];
-
-          // update route for edge (n1, C1), (n1, C2) and (A1, A2)
-          bool route_ok = updateRouteType2(netID,
-                                           treenodes,
-                                           n1,
-                                           A1,
-                                           A2,
-                                           C1,
-                                           C2,
-                                           E1x,
-                                           E1y,
-                                           treeedges,
-                                           edge_n1A1,
-                                           edge_n1A2,
-                                           edge_C1C2);
-          if (!route_ok) {
-            debugPrint(logger_,
-                       utl::GRT,
-                       "maze_2d",
-                       1,
-                       "Net {} has errors during updateRouteType2.",
-                       nets_[netID]->getName());
-            reInitTree(netID);
-            nidRPC--;
+        }
+        // A2's nbr n1->A1
+        for (int i = 0; i < 3; i++) {
+          if (treenodes[A2].nbr[i] == n1) {
+            treenodes[A2].nbr[i] = A1;
+            treenodes[A2].edge[i] = edge_A1A2;
             break;
           }
-          // update position for n1
-          treenodes[n1].x = E1x;
-          treenodes[n1].y = E1y;
-          // update 3 edges (n1, A1)->(C1, n1), (n1, A2)->(n1, C2), (C1,
-          // C2)->(A1, A2)
-          const int edge_n1C1 = edge_n1A1;
-          treeedges[edge_n1C1].n1 = C1;
-          treeedges[edge_n1C1].n2 = n1;
-          const int edge_n1C2 = edge_n1A2;
-          treeedges[edge_n1C2].n1 = n1;
-          treeedges[edge_n1C2].n2 = C2;
-          const int edge_A1A2 = edge_C1C2;
-          treeedges[edge_A1A2].n1 = A1;
-          treeedges[edge_A1A2].n2 = A2;
-          // update nbr and edge for 5 nodes n1, A1, A2, C1, C2
-          // n1's nbr (n2, A1, A2)->(n2, C1, C2)
-          treenodes[n1].nbr[0] = n2;
-          treenodes[n1].edge[0] = edge_n1n2;
-          treenodes[n1].nbr[1] = C1;
-          treenodes[n1].edge[1] = edge_n1C1;
-          treenodes[n1].nbr[2] = C2;
-          treenodes[n1].edge[2] = edge_n1C2;
-          // A1's nbr n1->A2
-          for (int i = 0; i < 3; i++) {
-            if (treenodes[A1].nbr[i] == n1) {
-              treenodes[A1].nbr[i] = A2;
-              treenodes[A1].edge[i] = edge_A1A2;
-              break;
-            }
-          }
-          // A2's nbr n1->A1
-          for (int i = 0; i < 3; i++) {
-            if (treenodes[A2].nbr[i] == n1) {
-              treenodes[A2].nbr[i] = A1;
-              treenodes[A2].edge[i] = edge_A1A2;
-              break;
-            }
-          }
-          // C1's nbr C2->n1
-          for (int i = 0; i < 3; i++) {
-            if (treenodes[C1].nbr[i] == C2) {
-              treenodes[C1].nbr[i] = n1;
-              treenodes[C1].edge[i] = edge_n1C1;
-              break;
-            }
+        }
+        // C1's nbr C2->n1
+        for (int i = 0; i < 3; i++) {
+          if (treenodes[C1].nbr[i] == C2) {
+            treenodes[C1].nbr[i] = n1;
+            treenodes[C1].edge[i] = edge_n1C1;
+            break;
           }
-          // C2's nbr C1->n1
-          for (int i = 0; i < 3; i++) {
-            if (treenodes[C2].nbr[i] == C1) {
-              treenodes[C2].nbr[i] = n1;
-              treenodes[C2].edge[i] = edge_n1C2;
-              break;
-            }
+        }
+        // C2's nbr C1->n1
+        for (int i = 0; i < 3; i++) {
+          if (treenodes[C2].nbr[i] == C1) {
+            treenodes[C2].nbr[i] = n1;
+            treenodes[C2].edge[i] = edge_n1C2;
+            break;
           }
+        }
 
-        }  // else E1 is not on (n1, A1) or (n1, A2), but on (C1, C2)
-      }    // n1 is not a pin and E1!=n1
+      }  // else E1 is not on (n1, A1) or (n1, A2), but on (C1, C2)
+    }    // n1 is not a pin and E1!=n1
 
-      // (2) consider subtree2
-      if (n2 < num_terminals && (E2x != n2x || E2y != n2y)) {
-        // split neighbor edge and return id new node
-        n2 = splitEdge(treeedges, treenodes, n1, n2, edgeID);
+    // (2) consider subtree2
+    if (n2 < num_terminals && (E2x != n2x || E2y != n2y)) {
+      // split neighbor edge and return id new node
+      n2 = splitEdge(treeedges, treenodes, n1, n2, edgeID);
+    }
+    if (n2 >= num_terminals && (E2x != n2x || E2y != n2y))
+    // n2 is not a pin and E2!=n2, then make change to subtree2,
+    // otherwise, no change to subtree2
+    {
+      // find the endpoints of the edge E1 is on
+      const int endpt1 = treeedges[corr_edge_[E2y][E2x]].n1;
+      const int endpt2 = treeedges[corr_edge_[E2y][E2x]].n2;
+
+      // find B1, B2
+      int B1, B2;
+      int edge_n2B1, edge_n2B2;
+      if (treenodes[n2].nbr[0] == n1) {
+        B1 = treenodes[n2].nbr[1];
+        B2 = treenodes[n2].nbr[2];
+        edge_n2B1 = treenodes[n2].edge[1];
+        edge_n2B2 = treenodes[n2].edge[2];
+      } else if (treenodes[n2].nbr[1] == n1) {
+        B1 = treenodes[n2].nbr[0];
+        B2 = treenodes[n2].nbr[2];
+        edge_n2B1 = treenodes[n2].edge[0];
+        edge_n2B2 = treenodes[n2].edge[2];
+      } else {
+        B1 = treenodes[n2].nbr[0];
+        B2 = treenodes[n2].nbr[1];
+        edge_n2B1 = treenodes[n2].edge[0];
+        edge_n2B2 = treenodes[n2].edge[1];
       }
-      if (n2 >= num_terminals && (E2x != n2x || E2y != n2y))
-      // n2 is not a pin and E2!=n2, then make change to subtree2,
-      // otherwise, no change to subtree2
+
+      if (endpt1 == n2 || endpt2 == n2)  // E2 is on (n2, B1) or (n2, B2)
       {
-        // find the endpoints of the edge E1 is on
-        const int endpt1 = treeedges[corr_edge_[E2y][E2x]].n1;
-        const int endpt2 = treeedges[corr_edge_[E2y][E2x]].n2;
-
-        // find B1, B2
-        int B1, B2;
-        int edge_n2B1, edge_n2B2;
-        if (treenodes[n2].nbr[0] == n1) {
-          B1 = treenodes[n2].nbr[1];
-          B2 = treenodes[n2].nbr[2];
-          edge_n2B1 = treenodes[n2].edge[1];
-          edge_n2B2 = treenodes[n2].edge[2];
-        } else if (treenodes[n2].nbr[1] == n1) {
-          B1 = treenodes[n2].nbr[0];
-          B2 = treenodes[n2].nbr[2];
-          edge_n2B1 = treenodes[n2].edge[0];
-          edge_n2B2 = treenodes[n2].edge[2];
-        } else {
-          B1 = treenodes[n2].nbr[0];
-          B2 = treenodes[n2].nbr[1];
-          edge_n2B1 = treenodes[n2].edge[0];
-          edge_n2B2 = treenodes[n2].edge[1];
+        // if E2 is on (n2, B2), switch B1 and B2 so that E2 is always on
+        // (n2, B1)
+        if (endpt1 == B2 || endpt2 == B2) {
+          std::swap(B1, B2);
+          std::swap(edge_n2B1, edge_n2B2);
         }
 
-        if (endpt1 == n2 || endpt2 == n2)  // E2 is on (n2, B1) or (n2, B2)
-        {
-          // if E2 is on (n2, B2), switch B1 and B2 so that E2 is always on
-          // (n2, B1)
-          if (endpt1 == B2 || endpt2 == B2) {
-            std::swap(B1, B2);
-            std::swap(edge_n2B1, edge_n2B2);
-          }
+        // update route for edge (n2, B1), (n2, B2)
+        bool route_ok = updateRouteType1(netID,
+                                         treenodes,
+                                         n2,
+                                         B1,
+                                         B2,
+                                         E2x,
+                                         E2y,
+                                         treeedges,
+                                         edge_n2B1,
+                                         edge_n2B2);
+        if (!route_ok) {
+          debugPrint(logger_,
+                     utl::GRT,
+                     "maze_2d",
+                     1,
+                     "Net {} has errors during updateRouteType1.",
+                     nets_[netID]->getName());
+          return false;
+        }
 
-          // update route for edge (n2, B1), (n2, B2)
-          bool route_ok = updateRouteType1(netID,
-                                           treenodes,
-                                           n2,
-                                           B1,
-                                           B2,
-                                           E2x,
-                                           E2y,
-                                           treeedges,
-                                           edge_n2B1,
-                                           edge_n2B2);
-          if (!route_ok) {
-            debugPrint(logger_,
-                       utl::GRT,
-                       "maze_2d",
-                       1,
-                       "Net {} has errors during updateRouteType1.",
-                       nets_[netID]->getName());
-            reInitTree(netID);
-            nidRPC--;
+        // update position for n2
+        treenodes[n2].x = E2x;
+        treenodes[n2].y = E2y;
+      }     // if E2 is on (n2, B1) or (n2, B2)
+      else  // E2 is not on (n2, B1) or (n2, B2), but on (D1, D2)
+      {
+        const int D1 = endpt1;
+        const int D2 = endpt2;
+        const int edge_D1D2 = corr_edge_[E2y][E2x];
+
+        // update route for edge (n2, D1), (n2, D2) and (B1, B2)
+        bool route_ok = updateRouteType2(netID,
+                                         treenodes,
+                                         n2,
+                                         B1,
+                                         B2,
+                                         D1,
+                                         D2,
+                                         E2x,
+                                         E2y,
+                                         treeedges,
+                                         edge_n2B1,
+                                         edge_n2B2,
+                                         edge_D1D2);
+        if (!route_ok) {
+          debugPrint(logger_,
+                     utl::GRT,
+                     "maze_2d",
+                     1,
+                     "Net {} has errors during updateRouteType2.",
+                     nets_[netID]->getName());
+          return false;
+        }
+        // update position for n2
+        treenodes[n2].x = E2x;
+        treenodes[n2].y = E2y;
+        // update 3 edges (n2, B1)->(D1, n2), (n2, B2)->(n2, D2), (D1,
+        // D2)->(B1, B2)
+        const int edge_n2D1 = edge_n2B1;
+        treeedges[edge_n2D1].n1 = D1;
+        treeedges[edge_n2D1].n2 = n2;
+        const int edge_n2D2 = edge_n2B2;
+        treeedges[edge_n2D2].n1 = n2;
+        treeedges[edge_n2D2].n2 = D2;
+        const int edge_B1B2 = edge_D1D2;
+        treeedges[edge_B1B2].n1 = B1;
+        treeedges[edge_B1B2].n2 = B2;
+        // update nbr and edge for 5 nodes n2, B1, B2, D1, D2
+        // n1's nbr (n1, B1, B2)->(n1, D1, D2)
+        treenodes[n2].nbr[0] = n1;
+        treenodes[n2].edge[0] = edge_n1n2;
+        treenodes[n2].nbr[1] = D1;
+        treenodes[n2].edge[1] = edge_n2D1;
+        treenodes[n2].nbr[2] = D2;
+        treenodes[n2].edge[2] = edge_n2D2;
+        // B1's nbr n2->B2
+        for (int i = 0; i < 3; i++) {
+          if (treenodes[B1].nbr[i] == n2) {
+            treenodes[B1].nbr[i] = B2;
+            treenodes[B1].edge[i] = edge_B1B2;
             break;
           }
-
-          // update position for n2
-          treenodes[n2].x = E2x;
-          treenodes[n2].y = E2y;
-        }     // if E2 is on (n2, B1) or (n2, B2)
-        else  // E2 is not on (n2, B1) or (n2, B2), but on (D1, D2)
-        {
-          const int D1 = endpt1;
-          const int D2 = endpt2;
-          const int edge_D1D2 = corr_edge_[E2y][E2x];
-
-          // update route for edge (n2, D1), (n2, D2) and (B1, B2)
-          bool route_ok = updateRouteType2(netID,
-                                           treenodes,
-                                           n2,
-                                           B1,
-                                           B2,
-                                           D1,
-                                           D2,
-                                           E2x,
-                                           E2y,
-                                           treeedges,
-                                           edge_n2B1,
-                                           edge_n2B2,
-                                           edge_D1D2);
-          if (!route_ok) {
-            debugPrint(logger_,
-                       utl::GRT,
-                       "maze_2d",
-                       1,
-                       "Net {} has errors during updateRouteType2.",
-                       nets_[netID]->getName());
-            reInitTree(netID);
-            nidRPC--;
+        }
+        // B2's nbr n2->B1
+        for (int i = 0; i < 3; i++) {
+          if (treenodes[B2].nbr[i] == n2) {
+            treenodes[B2].nbr[i] = B1;
+            treenodes[B2].edge[i] = edge_B1B2;
             break;
           }
-          // update position for n2
-          treenodes[n2].x = E2x;
-          treenodes[n2].y = E2y;
-          // update 3 edges (n2, B1)->(D1, n2), (n2, B2)->(n2, D2), (D1,
-          // D2)->(B1, B2)
-          const int edge_n2D1 = edge_n2B1;
-          treeedges[edge_n2D1].n1 = D1;
-          treeedges[edge_n2D1].n2 = n2;
-          const int edge_n2D2 = edge_n2B2;
-          treeedges[edge_n2D2].n1 = n2;
-          treeedges[edge_n2D2].n2 = D2;
-          const int edge_B1B2 = edge_D1D2;
-          treeedges[edge_B1B2].n1 = B1;
-          treeedges[edge_B1B2].n2 = B2;
-          // update nbr and edge for 5 nodes n2, B1, B2, D1, D2
-          // n1's nbr (n1, B1, B2)->(n1, D1, D2)
-          treenodes[n2].nbr[0] = n1;
-          treenodes[n2].edge[0] = edge_n1n2;
-          treenodes[n2].nbr[1] = D1;
-          treenodes[n2].edge[1] = edge_n2D1;
-          treenodes[n2].nbr[2] = D2;
-          treenodes[n2].edge[2] = edge_n2D2;
-          // B1's nbr n2->B2
-          for (int i = 0; i < 3; i++) {
-            if (treenodes[B1].nbr[i] == n2) {
-              treenodes[B1].nbr[i] = B2;
-              treenodes[B1].edge[i] = edge_B1B2;
-              break;
-            }
-          }
-          // B2's nbr n2->B1
-          for (int i = 0; i < 3; i++) {
-            if (treenodes[B2].nbr[i] == n2) {
-              treenodes[B2].nbr[i] = B1;
-              treenodes[B2].edge[i] = edge_B1B2;
-              break;
-            }
-          }
-          // D1's nbr D2->n2
-          for (int i = 0; i < 3; i++) {
-            if (treenodes[D1].nbr[i] == D2) {
-              treenodes[D1].nbr[i] = n2;
-              treenodes[D1].edge[i] = edge_n2D1;
-              break;
-            }
+        }
+        // D1's nbr D2->n2
+        for (int i = 0; i < 3; i++) {
+          if (treenodes[D1].nbr[i] == D2) {
+            treenodes[D1].nbr[i] = n2;
+            treenodes[D1].edge[i] = edge_n2D1;
+            break;
           }
-          // D2's nbr D1->n2
-          for (int i = 0; i < 3; i++) {
-            if (treenodes[D2].nbr[i] == D1) {
-              treenodes[D2].nbr[i] = n2;
-              treenodes[D2].edge[i] = edge_n2D2;
-              break;
-            }
+        }
+        // D2's nbr D1->n2
+        for (int i = 0; i < 3; i++) {
+          if (treenodes[D2].nbr[i] == D1) {
+            treenodes[D2].nbr[i] = n2;
+            treenodes[D2].edge[i] = edge_n2D2;
+            break;
           }
-        }  // else E2 is not on (n2, B1) or (n2, B2), but on (D1, D2)
-      }    // n2 is not a pin and E2!=n2
+        }
+      }  // else E2 is not on (n2, B1) or (n2, B2), but on (D1, D2)
+    }    // n2 is not a pin and E2!=n2
 
-      // update route for edge (n1, n2) and edge usage
-      if (treeedges[edge_n1n2].route.type == RouteType::MazeRoute) {
-        treeedges[edge_n1n2].route.gridsX.clear();
-        treeedges[edge_n1n2].route.gridsY.clear();
-      }
-      treeedges[edge_n1n2].route.gridsX.resize(cnt_n1n2, 0);
-      treeedges[edge_n1n2].route.gridsY.resize(cnt_n1n2, 0);
-      treeedges[edge_n1n2].route.type = RouteType::MazeRoute;
-      treeedges[edge_n1n2].route.routelen = cnt_n1n2 - 1;
-      treeedges[edge_n1n2].len = abs(E1x - E2x) + abs(E1y - E2y);
-
-      for (int i = 0; i < cnt_n1n2; i++) {
-        treeedges[edge_n1n2].route.gridsX[i] = gridsX[i];
-        treeedges[edge_n1n2].route.gridsY[i] = gridsY[i];
-      }
+    // update route for edge (n1, n2) and edge usage
+    if (treeedges[edge_n1n2].route.type == RouteType::MazeRoute) {
+      treeedges[edge_n1n2].route.gridsX.clear();
+      treeedges[edge_n1n2].route.gridsY.clear();
+    }
+    treeedges[edge_n1n2].route.gridsX.resize(cnt_n1n2, 0);
+    treeedges[edge_n1n2].route.gridsY.resize(cnt_n1n2, 0);
+    treeedges[edge_n1n2].route.type = RouteType::MazeRoute;
+    treeedges[edge_n1n2].route.routelen = cnt_n1n2 - 1;
+    treeedges[edge_n1n2].len = abs(E1x - E2x) + abs(E1y - E2y);
 
-      int edgeCost = nets_[netID]->getEdgeCost();
+    for (int i = 0; i < cnt_n1n2; i++) {
+      treeedges[edge_n1n2].route.gridsX[i] = gridsX[i];
+      treeedges[edge_n1n2].route.gridsY[i] = gridsY[i];
+    }
 
-      // update edge usage
-      for (int i = 0; i < cnt_n1n2 - 1; i++) {
-        if (gridsX[i] == gridsX[i + 1])  // a vertical edge
-        {
-          const int min_y = std::min(gridsY[i], gridsY[i + 1]);
-          v_edges_[min_y][gridsX[i]].usage += edgeCost;
-          v_used_ggrid_.insert(std::make_pair(min_y, gridsX[i]));
-        } else  /// if(gridsY[i]==gridsY[i+1])// a horizontal edge
-        {
-          const int min_x = std::min(gridsX[i], gridsX[i + 1]);
-          h_edges_[gridsY[i]][min_x].usage += edgeCost;
-          h_used_ggrid_.insert(std::make_pair(gridsY[i], min_x));
-        }
+    int edgeCost = nets_[netID]->getEdgeCost();
+
+    // update edge usage
+    for (int i = 0; i < cnt_n1n2 - 1; i++) {
+      if (gridsX[i] == gridsX[i + 1])  // a vertical edge
+      {
+        const int min_y = std::min(gridsY[i], gridsY[i + 1]);
+        v_edges_[min_y][gridsX[i]].usage += edgeCost;
+        scratch.v_used_ggrid.emplace_back(min_y, gridsX[i]);
+      } else  /// if(gridsY[i]==gridsY[i+1])// a horizontal edge
+      {
+        const int min_x = std::min(gridsX[i], gridsX[i + 1]);
+        h_edges_[gridsY[i]][min_x].usage += edgeCost;
+        scratch.h_used_ggrid.emplace_back(gridsY[i], min_x);
       }
-    }  // loop edgeID
-  }    // loop netID
+    }
+  }  // loop edgeID
 
-  h_cost_table_.clear();
-  v_cost_table_.clear();
+  return true;
 }
 
 void FastRouteCore::findCongestedEdgesNets(
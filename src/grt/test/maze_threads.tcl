@@ -0,0 +1,20 @@
+# congestion1 with 4 threads; the parallel 2D maze routing must write the
+# same guides as the single-threaded congestion1
+source "helpers.tcl"
+read_lef "Nangate45/Nangate45.lef"
+read_def "gcd.def"
+
+set guide_file [make_result_file maze_threads.guide]
+
+set_global_routing_layer_adjustment metal2 0.9
+set_global_routing_layer_adjustment metal3 0.9
+set_global_routing_layer_adjustment metal4-metal10 1
+
+set_routing_layers -signal metal2-metal10
+
+set_thread_count 4
+global_route -allow_congestion -verbose
+
+write_guides $guide_file
+
+diff_file congestion1.guideok $guide_file
@@ -0,0 +1,48 @@
+# Global routing runtime benchmark for the parallel 2D maze routing on
+# ibex_core (34k instances, Nangate45). Too slow for the regression, which
+# checks the same with maze_threads on gcd; run with
+#   openroad -exit maze_threads_bench.tcl
+# The thread counts can be changed with the GRT_BENCH_THREADS environment
+# variable, e.g. GRT_BENCH_THREADS="1 4 8".
+source "helpers.tcl"
+read_lef "Nangate45/Nangate45.lef"
+read_def "../../dpl/test/ibex_core_replace.def"
+
+set_global_routing_layer_adjustment metal2-metal10 0.5
+set_routing_layers -signal metal2-metal10
+
+set thread_counts {1 2 4 8}
+if { [info exists ::env(GRT_BENCH_THREADS)] } {
+  set thread_counts $::env(GRT_BENCH_THREADS)
+}
+
+proc route_with_threads { threads guide_file } {
+  set_thread_count $threads
+  set start [clock milliseconds]
+  global_route -allow_congestion
+  set runtime [expr ([clock milliseconds] - $start) / 1000.0]
+  write_guides $guide_file
+  return $runtime
+}
+
+set results {}
+foreach threads $thread_counts {
+  set guide_file [make_result_file maze_threads_bench_$threads.guide]
+  set runtime [route_with_threads $threads $guide_file]
+  lappend results [list $threads $runtime $guide_file]
+}
+
+puts "threads  runtime(s)  speedup"
+set serial_runtime [lindex $results 0 1]
+foreach result $results {
+  lassign $result threads runtime
+  puts [format "%7d  %10.2f  %7.2f" $threads $runtime \
+          [expr $serial_runtime / max($runtime, 0.001)]]
+}
+# the parallel routing must match the routing of the first thread count
+set serial_guide_file [lindex $results 0 2]
+foreach result [lrange $results 1 end] {
+  lassign $result threads runtime guide_file
+  puts "$threads threads:"
+  diff_files $serial_guide_file $guide_file
+}
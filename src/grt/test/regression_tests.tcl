@@ -22,6 +22,7 @@ record_tests {
   invalid_routing_layer
   invalid_pin_placement
   macro_obs_not_aligned
+  maze_threads
   modeling_instance_obs
   multiple_calls
   ndr_1w_3s
@@ -49,6 +50,7 @@ record_tests {
   repair_antennas2
   repair_antennas3
   repair_antennas4
+  repair_antennas_threads
   repair_antennas_error1
   repair_antennas_error2
   report_wire_length1
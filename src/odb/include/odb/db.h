@@ -394,6 +394,14 @@ class dbDatabase : public dbObject
   ///
   void read(std::istream& f);
 
+  ///
+  /// Read a database from a file. The file is memory mapped when possible,
+  /// in which case block wires and parasitics are only loaded on first
+  /// access.
+  /// WARNING: This function destroys the data currently in the database.
+  ///
+  void read(const char* filename);
+
   ///
   /// Write a database to this stream.
   /// Throws ZIOError..
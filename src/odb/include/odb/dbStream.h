@@ -36,6 +36,7 @@
 #include <cstdint>
 #include <cstring>
 #include <istream>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <unordered_map>
@@ -51,6 +52,7 @@
 namespace odb {
 
 class _dbDatabase;
+class dbMappedFile;
 
 inline constexpr size_t kTemplateRecursionLimit = 16;
 
@@ -272,6 +274,11 @@ class dbOStream
 
   void pushScope(const std::string& name);
   void popScope();
+
+  // A section is prefixed with its size so readers can skip over it.
+  // beginSection writes a placeholder that endSection fills in.
+  Position beginSection();
+  void endSection(Position start);
 };
 
 // RAII class for scoping ostream operations
@@ -291,16 +298,29 @@ class dbOStreamScope
 
 class dbIStream
 {
+  using Position = std::istream::pos_type;
+
   std::istream& _f;
   _dbDatabase* _db;
   double _lef_area_factor;
   double _lef_dist_factor;
+  std::shared_ptr<dbMappedFile> _mapped_file;
 
  public:
   dbIStream(_dbDatabase* db, std::istream& f);
 
   _dbDatabase* getDatabase() { return _db; }
 
+  // Set when reading from a mapped file whose sections may be deferred.
+  void setMappedFile(std::shared_ptr<dbMappedFile> file)
+  {
+    _mapped_file = std::move(file);
+  }
+  const std::shared_ptr<dbMappedFile>& getMappedFile() const
+  {
+    return _mapped_file;
+  }
+
   dbIStream& operator>>(bool& c)
   {
     unsigned char b;
@@ -490,6 +510,9 @@ class dbIStream
 
   double lefdist(int value) { return ((double) value * _lef_dist_factor); }
 
+  Position pos() const { return _f.tellg(); }
+  void skip(uint64_t size) { _f.seekg(size, std::ios::cur); }
+
  private:
   template <uint32_t I = 0, typename... Ts>
   dbIStream& variantHelper(uint32_t index, std::variant<Ts...>& v)
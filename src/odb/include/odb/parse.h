@@ -32,9 +32,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <vector>
 
 #include "array1.h"
 #include "utl/Logger.h"
@@ -48,6 +50,11 @@ class Ath__parser
   ~Ath__parser();
   void openFile(const char* name = nullptr);
   void setInputFP(FILE* fp);
+  // Read files opened afterwards through a memory map, breaking blocks of
+  // lines into words with numThreads threads. The separators and comment
+  // character must not change while such a file is read. Compressed files
+  // are still read through a pipe.
+  void enableMappedInput(int numThreads);
   int mkWords(const char* word, const char* sep = nullptr);
   int readLineAndBreak(int prevWordCnt = -1);
   int parseNextLine();
@@ -74,11 +81,28 @@ class Ath__parser
   bool isDigit(int ii, int jj);
 
  private:
+  // Words of the lines of one piece of a mapped file, each NUL terminated
+  struct MappedChunk
+  {
+    std::vector<char> text;
+    std::vector<int> wordStart;  // offset of each word in text
+    std::vector<int> lineEnd;    // wordStart index past each line's last word
+  };
+
   void init();
   void reportProgress();
   int mkWords(int jj);
   bool isSeparator(char a);
 
+  bool openMappedFile(const char* name);
+  void closeMappedFile();
+  bool readMappedBlock();
+  void breakMappedChunk(const char* begin,
+                        const char* end,
+                        const bool* separator,
+                        MappedChunk& chunk) const;
+  int readMappedLine(int prevWordCnt);
+
   char* _line;
   char* _tmpLine;
   char* _wordSeparators;
@@ -94,6 +118,23 @@ class Ath__parser
 
   int _progressLineChunk;
   utl::Logger* _logger;
+
+  // words of the current line, either _wordArray or _lineWords
+  char** _words;
+
+  int _mapThreads = 0;  // 0 when mapped input is disabled
+  bool _mapped = false;
+  char* _map = nullptr;
+  size_t _mapSize = 0;
+  size_t _mapPos = 0;
+  std::vector<MappedChunk> _chunks;
+  // previous block, kept so that words of the last line stay valid
+  std::vector<MappedChunk> _prevChunks;
+  size_t _chunkIdx = 0;
+  size_t _chunkLine = 0;
+  std::vector<char*> _lineWords;
+
+  static constexpr size_t _mapChunkSize = 4 * 1024 * 1024;
 };
 
 }  // namespace odb
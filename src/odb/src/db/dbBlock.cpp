@@ -666,7 +666,7 @@ _dbBlock::~_dbBlock()
   delete _track_grid_tbl;
   delete _obstruction_tbl;
   delete _blockage_tbl;
-  delete _wire_tbl;
+  delete _wire_tbl.getUnloaded();
   delete _swire_tbl;
   delete _sbox_tbl;
   delete _row_tbl;
@@ -678,12 +678,12 @@ _dbBlock::~_dbBlock()
   delete _layer_rule_tbl;
   delete _prop_tbl;
   delete _name_cache;
-  delete _r_val_tbl;
-  delete _c_val_tbl;
-  delete _cc_val_tbl;
-  delete _cap_node_tbl;
-  delete _r_seg_tbl;
-  delete _cc_seg_tbl;
+  delete _r_val_tbl.getUnloaded();
+  delete _c_val_tbl.getUnloaded();
+  delete _cc_val_tbl.getUnloaded();
+  delete _cap_node_tbl.getUnloaded();
+  delete _r_seg_tbl.getUnloaded();
+  delete _cc_seg_tbl.getUnloaded();
   delete _extControl;
   delete _net_bterm_itr;
   delete _net_iterm_itr;
@@ -691,9 +691,9 @@ _dbBlock::~_dbBlock()
   delete _box_itr;
   delete _swire_itr;
   delete _sbox_itr;
-  delete _cap_node_itr;
-  delete _r_seg_itr;
-  delete _cc_seg_itr;
+  delete _cap_node_itr.getUnloaded();
+  delete _r_seg_itr.getUnloaded();
+  delete _cc_seg_itr.getUnloaded();
   delete _region_inst_itr;
   delete _module_inst_itr;
   delete _module_modinst_itr;
@@ -1016,7 +1016,9 @@ dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
   stream << *block._track_grid_tbl;
   stream << *block._obstruction_tbl;
   stream << *block._blockage_tbl;
+  const auto wire_section = stream.beginSection();
   stream << *block._wire_tbl;
+  stream.endSection(wire_section);
   stream << *block._swire_tbl;
   stream << *block._sbox_tbl;
   stream << *block._row_tbl;
@@ -1029,12 +1031,14 @@ dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
   stream << *block._prop_tbl;
 
   stream << *block._name_cache;
+  const auto parasitic_section = stream.beginSection();
   stream << *block._r_val_tbl;
   stream << *block._c_val_tbl;
   stream << *block._cc_val_tbl;
-  stream << NamedTable("cap_node_tbl", block._cap_node_tbl);
-  stream << NamedTable("r_seg_tbl", block._r_seg_tbl);
-  stream << NamedTable("cc_seg_tbl", block._cc_seg_tbl);
+  stream << NamedTable("cap_node_tbl", block._cap_node_tbl.get());
+  stream << NamedTable("r_seg_tbl", block._r_seg_tbl.get());
+  stream << NamedTable("cc_seg_tbl", block._cc_seg_tbl.get());
+  stream.endSection(parasitic_section);
   stream << *block._extControl;
   stream << block._dft;
   stream << *block._dft_tbl;
@@ -1151,7 +1155,15 @@ dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
   stream >> *block._track_grid_tbl;
   stream >> *block._obstruction_tbl;
   stream >> *block._blockage_tbl;
-  stream >> *block._wire_tbl;
+  if (db->isSchema(db_schema_deferred_tables)) {
+    block.readSection(
+        stream, block._wire_section, "wires", [&block](dbIStream& wire_stream) {
+          wire_stream >> *block._wire_tbl.getUnloaded();
+        });
+    block._wire_tbl.setSection(block._wire_section.get());
+  } else {
+    stream >> *block._wire_tbl;
+  }
   stream >> *block._swire_tbl;
   stream >> *block._sbox_tbl;
   stream >> *block._row_tbl;
@@ -1163,12 +1175,30 @@ dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
   stream >> *block._layer_rule_tbl;
   stream >> *block._prop_tbl;
   stream >> *block._name_cache;
-  stream >> *block._r_val_tbl;
-  stream >> *block._c_val_tbl;
-  stream >> *block._cc_val_tbl;
-  stream >> *block._cap_node_tbl;  // DKF
-  stream >> *block._r_seg_tbl;     // DKF
-  stream >> *block._cc_seg_tbl;
+  auto read_parasitics = [&block](dbIStream& rc_stream) {
+    rc_stream >> *block._r_val_tbl.getUnloaded();
+    rc_stream >> *block._c_val_tbl.getUnloaded();
+    rc_stream >> *block._cc_val_tbl.getUnloaded();
+    rc_stream >> *block._cap_node_tbl.getUnloaded();  // DKF
+    rc_stream >> *block._r_seg_tbl.getUnloaded();     // DKF
+    rc_stream >> *block._cc_seg_tbl.getUnloaded();
+  };
+  if (db->isSchema(db_schema_deferred_tables)) {
+    block.readSection(
+        stream, block._parasitic_section, "parasitics", read_parasitics);
+    dbDeferredSection* section = block._parasitic_section.get();
+    block._r_val_tbl.setSection(section);
+    block._c_val_tbl.setSection(section);
+    block._cc_val_tbl.setSection(section);
+    block._cap_node_tbl.setSection(section);
+    block._r_seg_tbl.setSection(section);
+    block._cc_seg_tbl.setSection(section);
+    block._cap_node_itr.setSection(section);
+    block._r_seg_itr.setSection(section);
+    block._cc_seg_itr.setSection(section);
+  } else {
+    read_parasitics(stream);
+  }
   stream >> *block._extControl;
   if (db->isSchema(db_schema_add_scan)) {
     stream >> block._dft;
@@ -1194,6 +1224,34 @@ dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
   return stream;
 }
 
+void _dbBlock::readSection(dbIStream& stream,
+                           std::unique_ptr<dbDeferredSection>& section,
+                           const char* name,
+                           const dbDeferredSection::Reader& reader)
+{
+  uint64_t size;
+  stream >> size;
+
+  const std::shared_ptr<dbMappedFile>& file = stream.getMappedFile();
+  if (!file) {
+    reader(stream);
+    return;
+  }
+
+  // Check the bounds now, while a bad file can still be reported by the
+  // reader, instead of on the first access to one of its tables.
+  const uint64_t offset = stream.pos();
+  if (offset > file->size() || size > file->size() - offset) {
+    throw std::ios_base::failure(std::string("database section ") + name
+                                 + " extends past the end of the file");
+  }
+
+  // Leave the section in the mapped file until one of its tables is used.
+  section = std::make_unique<dbDeferredSection>(
+      getDatabase(), file, offset, size, name, reader);
+  stream.skip(size);
+}
+
 void _dbBlock::add_rect(const Rect& rect)
 {
   _dbBox* box = _box_tbl->getPtr(_bbox);
@@ -33,9 +33,11 @@
 #pragma once
 
 #include <list>
+#include <memory>
 #include <vector>
 
 #include "dbCore.h"
+#include "dbDeferredTable.h"
 #include "dbHashTable.h"
 #include "dbIntHashTable.h"
 #include "dbPagedVector.h"
@@ -212,7 +214,7 @@ class _dbBlock : public _dbObject
   dbTable<_dbTrackGrid>* _track_grid_tbl;
   dbTable<_dbObstruction>* _obstruction_tbl;
   dbTable<_dbBlockage>* _blockage_tbl;
-  dbTable<_dbWire>* _wire_tbl;
+  dbDeferred<dbTable<_dbWire>> _wire_tbl;
   dbTable<_dbSWire>* _swire_tbl;
   dbTable<_dbSBox>* _sbox_tbl;
   dbTable<_dbRow>* _row_tbl;
@@ -238,18 +240,18 @@ class _dbBlock : public _dbObject
   _dbNameCache* _name_cache;
   dbTable<_dbDft>* _dft_tbl;
 
-  dbPagedVector<float, 4096, 12>* _r_val_tbl;
-  dbPagedVector<float, 4096, 12>* _c_val_tbl;
-  dbPagedVector<float, 4096, 12>* _cc_val_tbl;
+  dbDeferred<dbPagedVector<float, 4096, 12>> _r_val_tbl;
+  dbDeferred<dbPagedVector<float, 4096, 12>> _c_val_tbl;
+  dbDeferred<dbPagedVector<float, 4096, 12>> _cc_val_tbl;
 
   dbTable<_dbModBTerm>* _modbterm_tbl;
   dbTable<_dbModITerm>* _moditerm_tbl;
   dbTable<_dbModNet>* _modnet_tbl;
   dbTable<_dbBusPort>* _busport_tbl;
 
-  dbTable<_dbCapNode>* _cap_node_tbl;
-  dbTable<_dbRSeg>* _r_seg_tbl;
-  dbTable<_dbCCSeg>* _cc_seg_tbl;
+  dbDeferred<dbTable<_dbCapNode>> _cap_node_tbl;
+  dbDeferred<dbTable<_dbRSeg>> _r_seg_tbl;
+  dbDeferred<dbTable<_dbCCSeg>> _cc_seg_tbl;
   dbExtControl* _extControl;
 
   // NON-PERSISTANT-NON-STREAMED-MEMBERS
@@ -259,9 +261,9 @@ class _dbBlock : public _dbObject
   dbBoxItr* _box_itr;
   dbSWireItr* _swire_itr;
   dbSBoxItr* _sbox_itr;
-  dbCapNodeItr* _cap_node_itr;
-  dbRSegItr* _r_seg_itr;
-  dbCCSegItr* _cc_seg_itr;
+  dbDeferred<dbCapNodeItr> _cap_node_itr;
+  dbDeferred<dbRSegItr> _r_seg_itr;
+  dbDeferred<dbCCSegItr> _cc_seg_itr;
   dbRegionInstItr* _region_inst_itr;
   dbModuleInstItr* _module_inst_itr;
   dbModuleModInstItr* _module_modinst_itr;
@@ -294,6 +296,10 @@ class _dbBlock : public _dbObject
   dbJournal* _journal;
   dbJournal* _journal_pending;
 
+  // Wires and parasitics left in the mapped file until first accessed
+  std::unique_ptr<dbDeferredSection> _wire_section;
+  std::unique_ptr<dbDeferredSection> _parasitic_section;
+
   _dbBlock(_dbDatabase* db);
   _dbBlock(_dbDatabase* db, const _dbBlock& block);
   ~_dbBlock();
@@ -316,6 +322,10 @@ class _dbBlock : public _dbObject
   _dbTech* getTech();
 
   dbObjectTable* getObjectTable(dbObjectType type);
+  void readSection(dbIStream& stream,
+                   std::unique_ptr<dbDeferredSection>& section,
+                   const char* name,
+                   const dbDeferredSection::Reader& reader);
 };
 
 dbOStream& operator<<(dbOStream& stream, const _dbBlock& block);
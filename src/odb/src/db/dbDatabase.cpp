@@ -35,6 +35,7 @@
 #include <algorithm>
 #include <fstream>
 #include <map>
+#include <memory>
 #include <string>
 
 #include "dbArrayTable.h"
@@ -43,6 +44,7 @@
 #include "dbCCSeg.h"
 #include "dbCapNode.h"
 #include "dbChip.h"
+#include "dbDeferredTable.h"
 #include "dbITerm.h"
 #include "dbJournal.h"
 #include "dbLib.h"
@@ -509,6 +511,22 @@ void dbDatabase::read(std::istream& file)
   stream >> *db;
 }
 
+void dbDatabase::read(const char* filename)
+{
+  _dbDatabase* db = (_dbDatabase*) this;
+  std::shared_ptr<dbMappedFile> file = dbMappedFile::open(filename);
+  if (file) {
+    dbMappedFile::read(db, file, [db](dbIStream& stream) { stream >> *db; });
+    return;
+  }
+
+  std::ifstream stream;
+  stream.exceptions(std::ifstream::failbit | std::ifstream::badbit
+                    | std::ios::eofbit);
+  stream.open(filename, std::ios::binary);
+  read(stream);
+}
+
 void dbDatabase::write(std::ostream& file)
 {
   _dbDatabase* db = (_dbDatabase*) this;
@@ -33,6 +33,7 @@
 #pragma once
 
 #include <iostream>
+#include <mutex>
 
 #include "dbCore.h"
 #include "odb/odb.h"
@@ -70,7 +71,11 @@ namespace odb {
 const uint db_schema_major = 0;  // Not used...
 const uint db_schema_initial = 57;
 
-const uint db_schema_minor = 88;  // Current revision number
+const uint db_schema_minor = 89;  // Current revision number
+
+// Revision where block wires and parasitics became size-prefixed sections
+// that can be deferred when reading from a mapped file
+const uint db_schema_deferred_tables = 89;
 
 // Revision where odb::Polygon was added
 const uint db_schema_polygon = 88;
@@ -194,6 +199,10 @@ class _dbDatabase : public _dbObject
 
   utl::Logger* _logger;
 
+  // Serializes deferred section loads, which stream with the schema of the
+  // file swapped into _schema_minor.
+  std::recursive_mutex _deferred_load_mutex;
+
   _dbDatabase(_dbDatabase* db);
   _dbDatabase(_dbDatabase* db, int id);
   _dbDatabase(_dbDatabase* db, const _dbDatabase& d);
@@ -0,0 +1,252 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "dbDeferredTable.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <istream>
+#include <streambuf>
+#include <string>
+
+#include "dbDatabase.h"
+#include "odb/ZException.h"
+#include "odb/dbStream.h"
+#include "utl/Logger.h"
+
+namespace odb {
+
+namespace {
+
+// Read-only, seekable stream buffer over a range of memory.
+class dbMemoryBuf : public std::streambuf
+{
+ public:
+  dbMemoryBuf(const char* data, uint64_t size)
+  {
+    char* begin = const_cast<char*>(data);
+    setg(begin, begin, begin + size);
+  }
+
+ protected:
+  pos_type seekoff(off_type off,
+                   std::ios_base::seekdir dir,
+                   std::ios_base::openmode which) override
+  {
+    if (!(which & std::ios_base::in)) {
+      return pos_type(off_type(-1));
+    }
+    char* base = gptr();
+    if (dir == std::ios_base::beg) {
+      base = eback();
+    } else if (dir == std::ios_base::end) {
+      base = egptr();
+    }
+    if (off < eback() - base || off > egptr() - base) {
+      return pos_type(off_type(-1));
+    }
+    setg(eback(), base + off, egptr());
+    return pos_type(gptr() - eback());
+  }
+
+  pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+  {
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+  }
+};
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////
+//
+// dbMappedFile - Methods
+//
+////////////////////////////////////////////////////////////////////
+
+std::shared_ptr<dbMappedFile> dbMappedFile::open(const char* filename)
+{
+  const int fd = ::open(filename, O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+    close(fd);
+    return nullptr;
+  }
+
+  void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (data == MAP_FAILED) {
+    close(fd);
+    return nullptr;
+  }
+
+  // The descriptor stays open so that deferred loads can check the file
+  // was not truncated.
+  return std::shared_ptr<dbMappedFile>(
+      new dbMappedFile(fd, (const char*) data, st.st_size));
+}
+
+dbMappedFile::~dbMappedFile()
+{
+  munmap(const_cast<char*>(_data), _size);
+  close(_fd);
+}
+
+uint64_t dbMappedFile::fileSize() const
+{
+  struct stat st;
+  if (fstat(_fd, &st) != 0) {
+    return 0;
+  }
+  return st.st_size;
+}
+
+void dbMappedFile::read(_dbDatabase* db,
+                        const std::shared_ptr<dbMappedFile>& file,
+                        const std::function<void(dbIStream&)>& reader)
+{
+  dbMemoryBuf buf(file->data(), file->size());
+  std::istream stream(&buf);
+  stream.exceptions(std::ios::failbit | std::ios::badbit | std::ios::eofbit);
+
+  dbIStream db_stream(db, stream);
+  db_stream.setMappedFile(file);
+  reader(db_stream);
+
+  // Deferred sections were skipped by their recorded sizes. If the sizes
+  // are consistent the database ends exactly at the end of the file.
+  if (stream.tellg() != std::streampos(file->size())) {
+    throw std::ios_base::failure(
+        "database sections do not add up to the file size");
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// dbDeferredSection - Methods
+//
+////////////////////////////////////////////////////////////////////
+
+dbDeferredSection::dbDeferredSection(_dbDatabase* db,
+                                     std::shared_ptr<dbMappedFile> file,
+                                     uint64_t offset,
+                                     uint64_t size,
+                                     const char* name,
+                                     Reader reader)
+    : _db(db),
+      _file(std::move(file)),
+      _offset(offset),
+      _size(size),
+      _schema_minor(db->_schema_minor),
+      _name(name),
+      _reader(std::move(reader))
+{
+}
+
+void dbDeferredSection::loadSection()
+{
+  // _schema_minor is shared by the whole database, so all of its sections
+  // load under one lock.
+  std::lock_guard<std::recursive_mutex> lock(_db->_deferred_load_mutex);
+  if (_loaded.load(std::memory_order_relaxed)) {
+    return;
+  }
+
+  // Reading pages of a mapping past the end of a truncated file raises
+  // SIGBUS, so check the file before touching them.
+  if (_file->fileSize() < _offset + _size) {
+    loadFailed("the file was truncated after it was read");
+  }
+
+  dbMemoryBuf buf(_file->data() + _offset, _size);
+  std::istream stream(&buf);
+  stream.exceptions(std::ios::failbit | std::ios::badbit | std::ios::eofbit);
+
+  // The tables were written with the schema of the file, not the current one.
+  const uint schema_minor = _db->_schema_minor;
+  _db->_schema_minor = _schema_minor;
+  std::string error;
+  try {
+    dbIStream db_stream(_db, stream);
+    _reader(db_stream);
+  } catch (const std::exception& e) {
+    error = e.what();
+  }
+  _db->_schema_minor = schema_minor;
+
+  if (!error.empty()) {
+    loadFailed(error);
+  }
+  if (stream.tellg() != std::streampos(_size)) {
+    loadFailed("the section has an invalid size");
+  }
+
+  // A database read without a logger loads eagerly without one, so the
+  // deferred load must not require it either.
+  utl::Logger* logger = _db->_logger;
+  if (logger) {
+    debugPrint(logger,
+               utl::ODB,
+               "io_size",
+               1,
+               "loaded {} ({:.1f} MB)",
+               _name,
+               _size / 1048576.0);
+  }
+
+  // Release the mapping once nothing else needs it.
+  _file.reset();
+  _reader = nullptr;
+  _loaded.store(true, std::memory_order_release);
+}
+
+void dbDeferredSection::loadFailed(const std::string& reason)
+{
+  utl::Logger* logger = _db->_logger;
+  if (logger) {
+    logger->critical(utl::ODB,
+                     446,
+                     "Cannot load database section {}: {}",
+                     _name,
+                     reason);
+  }
+  throw ZException("Cannot load database section %s: %s",
+                   _name.c_str(),
+                   reason.c_str());
+}
+
+}  // namespace odb
@@ -0,0 +1,162 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "odb/odb.h"
+
+namespace odb {
+
+class _dbDatabase;
+class dbIStream;
+
+//
+// A read-only memory mapping of a database file. Deferred sections keep
+// the mapping alive until the last of them has been loaded.
+//
+class dbMappedFile
+{
+ public:
+  ~dbMappedFile();
+
+  // Returns nullptr if the file can't be mapped.
+  static std::shared_ptr<dbMappedFile> open(const char* filename);
+
+  // Streams the database in through reader. Block sections found along
+  // the way are deferred instead of read.
+  static void read(_dbDatabase* db,
+                   const std::shared_ptr<dbMappedFile>& file,
+                   const std::function<void(dbIStream&)>& reader);
+
+  const char* data() const { return _data; }
+  uint64_t size() const { return _size; }
+
+  // The current size of the file on disk. It is smaller than size() if the
+  // file was truncated after it was mapped.
+  uint64_t fileSize() const;
+
+ private:
+  dbMappedFile(int fd, const char* data, uint64_t size)
+      : _fd(fd), _data(data), _size(size)
+  {
+  }
+
+  int _fd;
+  const char* _data;
+  uint64_t _size;
+};
+
+//
+// A byte range of a mapped database file holding tables that are only
+// streamed in when one of them is first accessed. The reader checks that
+// the range lies within the file. A load can be triggered by any accessor,
+// including one running in a worker thread, so a load that fails anyway is
+// fatal.
+//
+class dbDeferredSection
+{
+ public:
+  using Reader = std::function<void(dbIStream&)>;
+
+  dbDeferredSection(_dbDatabase* db,
+                    std::shared_ptr<dbMappedFile> file,
+                    uint64_t offset,
+                    uint64_t size,
+                    const char* name,
+                    Reader reader);
+
+  void load()
+  {
+    if (!_loaded.load(std::memory_order_acquire)) {
+      loadSection();
+    }
+  }
+
+  bool isLoaded() const { return _loaded.load(std::memory_order_acquire); }
+
+ private:
+  void loadSection();
+  [[noreturn]] void loadFailed(const std::string& reason);
+
+  _dbDatabase* _db;
+  std::shared_ptr<dbMappedFile> _file;
+  uint64_t _offset;
+  uint64_t _size;
+  uint _schema_minor;
+  std::string _name;
+  Reader _reader;
+  std::atomic<bool> _loaded{false};
+};
+
+//
+// Owning pointer to a table that may still be deferred. Every access
+// loads the section first so callers can treat it as a plain pointer.
+//
+template <class T>
+class dbDeferred
+{
+ public:
+  dbDeferred& operator=(T* table)
+  {
+    _table = table;
+    return *this;
+  }
+
+  T* operator->() const { return get(); }
+  T& operator*() const { return *get(); }
+  operator T*() const { return get(); }
+
+  T* get() const
+  {
+    if (_section) {
+      _section->load();
+    }
+    return _table;
+  }
+
+  // Access without loading, for destruction only.
+  T* getUnloaded() const { return _table; }
+
+  void setSection(dbDeferredSection* section) { _section = section; }
+
+ private:
+  T* _table = nullptr;
+  dbDeferredSection* _section = nullptr;
+};
+
+}  // namespace odb
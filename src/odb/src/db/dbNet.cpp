@@ -461,8 +461,9 @@ void _dbNet::differences(dbDiff& diff,
     set_symmetric_diff(diff, lhs_vec, rhs_vec);
   }
 
-  DIFF_OBJECT(_wire, lhs_block->_wire_tbl, rhs_block->_wire_tbl);
-  DIFF_OBJECT(_global_wire, lhs_block->_wire_tbl, rhs_block->_wire_tbl);
+  DIFF_OBJECT(_wire, lhs_block->_wire_tbl.get(), rhs_block->_wire_tbl.get());
+  DIFF_OBJECT(
+      _global_wire, lhs_block->_wire_tbl.get(), rhs_block->_wire_tbl.get());
   DIFF_SET(_swires, lhs_block->_swire_itr, rhs_block->_swire_itr);
   DIFF_SET(_cap_nodes, lhs_block->_cap_node_itr, rhs_block->_cap_node_itr);
   DIFF_SET(_r_segs, lhs_block->_r_seg_itr, rhs_block->_r_seg_itr);
@@ -540,8 +541,8 @@ void _dbNet::out(dbDiff& diff, char side, const char* field) const
     diff.end_object();
   }
 
-  DIFF_OUT_OBJECT(_wire, block->_wire_tbl);
-  DIFF_OUT_OBJECT(_global_wire, block->_wire_tbl);
+  DIFF_OUT_OBJECT(_wire, block->_wire_tbl.get());
+  DIFF_OUT_OBJECT(_global_wire, block->_wire_tbl.get());
   DIFF_OUT_SET(_swires, block->_swire_itr);
   DIFF_OUT_SET(_cap_nodes, block->_cap_node_itr);
   DIFF_OUT_SET(_r_segs, block->_r_seg_itr);
@@ -65,6 +65,25 @@ void dbOStream::popScope()
   _scopes.pop_back();
 }
 
+dbOStream::Position dbOStream::beginSection()
+{
+  const Position start = pos();
+  if (start == Position(-1)) {
+    throw ZException("database sections require a seekable stream");
+  }
+  *this << (uint64_t) 0;
+  return start;
+}
+
+void dbOStream::endSection(Position start)
+{
+  const Position end = pos();
+  const uint64_t size = end - start - sizeof(uint64_t);
+  _f.seekp(start);
+  *this << size;
+  _f.seekp(end);
+}
+
 dbOStream& operator<<(dbOStream& stream, const Rect& r)
 {
   stream << r.xlo_;
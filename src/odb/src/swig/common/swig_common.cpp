@@ -37,6 +37,7 @@
 #include "odb/lefin.h"
 #include "odb/lefout.h"
 #include "utl/Logger.h"
+#include "utl/ScopedTemporaryFile.h"
 
 using namespace boost::polygon::operators;
 
@@ -165,13 +166,8 @@ odb::dbDatabase* read_db(odb::dbDatabase* db, const char* db_path)
     db = odb::dbDatabase::create();
   }
 
-  std::ifstream file;
-  file.exceptions(std::ifstream::failbit | std::ifstream::badbit
-                  | std::ios::eofbit);
-  file.open(db_path, std::ios::binary);
-
   try {
-    db->read(file);
+    db->read(db_path);
   } catch (const std::ios_base::failure& f) {
     auto msg = fmt::format("odb file {} is invalid: {}", db_path, f.what());
     throw std::ios_base::failure(msg);
@@ -182,14 +178,15 @@ odb::dbDatabase* read_db(odb::dbDatabase* db, const char* db_path)
 
 int write_db(odb::dbDatabase* db, const char* db_path)
 {
-  std::ofstream fp(db_path, std::ios::binary);
-  if (!fp) {
-    int errnum = errno;
-    fprintf(stderr, "Error opening file: %s\n", strerror(errnum));
-    fprintf(stderr, "Errno: %d\n", errno);
+  // db may still load deferred sections from a mapping of db_path, so the
+  // file is replaced only once the new one is complete.
+  try {
+    utl::StreamHandler stream_handler(db_path, true);
+    db->write(stream_handler.getStream());
+  } catch (const std::ios_base::failure& f) {
+    fprintf(stderr, "Error writing file: %s\n", f.what());
     return errno;
   }
-  db->write(fp);
   return 1;
 }
 
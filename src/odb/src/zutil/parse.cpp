@@ -32,6 +32,12 @@
 
 #include "odb/parse.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -80,6 +86,8 @@ Ath__parser::Ath__parser(utl::Logger* logger)
 
 Ath__parser::~Ath__parser()
 {
+  closeMappedFile();
+
   if (_inFP && strlen(_inputFile) > 4
       && !strcmp(_inputFile + strlen(_inputFile) - 3, ".gz")) {
     char buff[1024];
@@ -117,6 +125,7 @@ void Ath__parser::init()
   for (int ii = 0; ii < _maxWordCnt; ii++) {
     _wordArray[ii] = ATH__allocCharWord(512, _logger);
   }
+  _words = _wordArray;
 
   _wordSeparators = ATH__allocCharWord(24, _logger);
 
@@ -145,7 +154,7 @@ void Ath__parser::resetLineNum(int v)
 
 bool Ath__parser::isDigit(int ii, int jj)
 {
-  const char C = _wordArray[ii][jj];
+  const char C = _words[ii][jj];
 
   return (C >= '0') && (C <= '9');
 }
@@ -162,6 +171,7 @@ void Ath__parser::addSeparator(const char* s)
 
 void Ath__parser::openFile(const char* name)
 {
+  closeMappedFile();
   if (name != nullptr && strlen(name) > 4
       && !strcmp(name + strlen(name) - 3, ".gz")) {
     char cmd[256];
@@ -184,25 +194,203 @@ void Ath__parser::openFile(const char* name)
     sprintf(cmd, "gzip -cd %s", _inputFile);
     _inFP = popen(cmd, "r");
   } else if (name != nullptr) {
-    _inFP = ATH__openFile(name, "r", _logger);
+    if (!openMappedFile(name)) {
+      _inFP = ATH__openFile(name, "r", _logger);
+    }
     strcpy(_inputFile, name);
   } else {  //
-    _inFP = ATH__openFile(_inputFile, "r", _logger);
+    if (!openMappedFile(_inputFile)) {
+      _inFP = ATH__openFile(_inputFile, "r", _logger);
+    }
   }
 }
 
 void Ath__parser::setInputFP(FILE* fp)
 {
+  closeMappedFile();
   _inFP = fp;
 }
 
+void Ath__parser::enableMappedInput(int numThreads)
+{
+  _mapThreads = std::max(1, numThreads);
+}
+
+bool Ath__parser::openMappedFile(const char* name)
+{
+  closeMappedFile();
+  if (_mapThreads == 0) {
+    return false;
+  }
+
+  const int fd = open(name, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    return false;
+  }
+  _mapSize = st.st_size;
+  if (_mapSize > 0) {
+    void* map = mmap(nullptr, _mapSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) {
+      close(fd);
+      _mapSize = 0;
+      return false;
+    }
+    _map = static_cast<char*>(map);
+    madvise(_map, _mapSize, MADV_SEQUENTIAL);
+  }
+  close(fd);
+
+  _mapped = true;
+  return true;
+}
+
+void Ath__parser::closeMappedFile()
+{
+  if (_map != nullptr) {
+    munmap(_map, _mapSize);
+  }
+  _map = nullptr;
+  _mapSize = 0;
+  _mapPos = 0;
+  _mapped = false;
+  _chunks.clear();
+  _prevChunks.clear();
+  _chunkIdx = 0;
+  _chunkLine = 0;
+  _lineWords.clear();
+  _words = _wordArray;
+}
+
+// Same rules as mkWords(int) applied to each line of [begin, end), which
+// holds whole lines only.
+void Ath__parser::breakMappedChunk(const char* begin,
+                                   const char* end,
+                                   const bool* separator,
+                                   MappedChunk& chunk) const
+{
+  chunk.text.clear();
+  chunk.wordStart.clear();
+  chunk.lineEnd.clear();
+  chunk.text.reserve(end - begin + 1);
+
+  const char* line = begin;
+  while (line < end) {
+    const char* newline
+        = static_cast<const char*>(memchr(line, '\n', end - line));
+    // the newline is part of the line, as it is with fgets
+    const char* lineEnd = newline != nullptr ? newline + 1 : end;
+
+    const char* c = line;
+    if (*c == _commentChar) {
+      c = lineEnd;
+    }
+    while (c < lineEnd) {
+      while (c < lineEnd && separator[static_cast<unsigned char>(*c)]) {
+        c++;
+      }
+      if (c == lineEnd) {
+        break;
+      }
+      const size_t start = chunk.text.size();
+      while (c < lineEnd && !separator[static_cast<unsigned char>(*c)]) {
+        if (*c == _commentChar) {
+          break;
+        }
+        chunk.text.push_back(*c++);
+      }
+      if (c < lineEnd && *c == _commentChar) {
+        // the rest of the line, including the partial word, is a comment
+        chunk.text.resize(start);
+        break;
+      }
+      chunk.text.push_back('\0');
+      chunk.wordStart.push_back(start);
+    }
+    chunk.lineEnd.push_back(chunk.wordStart.size());
+    line = lineEnd;
+  }
+}
+
+bool Ath__parser::readMappedBlock()
+{
+  if (_mapPos >= _mapSize) {
+    return false;
+  }
+
+  std::vector<std::pair<size_t, size_t>> pieces;
+  while (_mapPos < _mapSize && (int) pieces.size() < _mapThreads) {
+    size_t end = std::min(_mapPos + _mapChunkSize, _mapSize);
+    const char* newline = static_cast<const char*>(
+        memchr(_map + end, '\n', _mapSize - end));
+    end = newline != nullptr ? newline - _map + 1 : _mapSize;
+    pieces.emplace_back(_mapPos, end);
+    _mapPos = end;
+  }
+
+  bool separator[256] = {false};
+  for (const char* c = _wordSeparators; *c != '\0'; c++) {
+    separator[static_cast<unsigned char>(*c)] = true;
+  }
+
+  std::swap(_prevChunks, _chunks);
+  _chunks.resize(pieces.size());
+#pragma omp parallel for num_threads(_mapThreads) schedule(static, 1)
+  for (int ii = 0; ii < (int) pieces.size(); ii++) {
+    breakMappedChunk(_map + pieces[ii].first,
+                     _map + pieces[ii].second,
+                     separator,
+                     _chunks[ii]);
+  }
+
+  _chunkIdx = 0;
+  _chunkLine = 0;
+  return true;
+}
+
+int Ath__parser::readMappedLine(int prevWordCnt)
+{
+  while (_chunkIdx == _chunks.size()
+         || _chunkLine == _chunks[_chunkIdx].lineEnd.size()) {
+    if (_chunkIdx < _chunks.size()) {
+      _chunkIdx++;
+      _chunkLine = 0;
+    } else if (!readMappedBlock()) {
+      _currentWordCnt = prevWordCnt;
+      return prevWordCnt;
+    }
+  }
+
+  _lineNum++;
+  reportProgress();
+
+  MappedChunk& chunk = _chunks[_chunkIdx];
+  const int first = _chunkLine == 0 ? 0 : chunk.lineEnd[_chunkLine - 1];
+  const int last = chunk.lineEnd[_chunkLine];
+  _chunkLine++;
+
+  // A continuation line appends to the words of the previous line
+  _lineWords.resize(std::max(prevWordCnt, 0));
+  for (int ii = first; ii < last; ii++) {
+    _lineWords.push_back(chunk.text.data() + chunk.wordStart[ii]);
+  }
+  _words = _lineWords.data();
+  _currentWordCnt = _lineWords.size();
+
+  return _currentWordCnt;
+}
+
 void Ath__parser::printWords(FILE* fp)
 {
   if (fp == nullptr) {
     return;
   }
   for (int ii = 0; ii < _currentWordCnt; ii++) {
-    fprintf(fp, "%s ", _wordArray[ii]);
+    fprintf(fp, "%s ", _words[ii]);
   }
   fprintf(fp, "\n");
 }
@@ -222,7 +410,7 @@ char* Ath__parser::get(int ii)
   if ((ii < 0) || (ii >= _currentWordCnt)) {
     return nullptr;
   }
-  return _wordArray[ii];
+  return _words[ii];
 }
 
 int Ath__parser::getInt(int ii)
@@ -296,6 +484,7 @@ int Ath__parser::mkWords(const char* word, const char* sep)
   }
 
   strcpy(_line, word);
+  _words = _wordArray;
   _currentWordCnt = mkWords(0);
 
   if (sep != nullptr) {
@@ -390,6 +579,10 @@ void Ath__parser::reportProgress()
 
 int Ath__parser::readLineAndBreak(int prevWordCnt)
 {
+  if (_mapped) {
+    return readMappedLine(prevWordCnt);
+  }
+
   if (fgets(_line, _lineSize, _inFP) == nullptr) {
     _currentWordCnt = prevWordCnt;
     return prevWordCnt;
@@ -6,12 +6,18 @@
 
 #include <unistd.h>
 
+#include <cstdlib>
+#include <fstream>
+#include <ios>
 #include <memory>
+#include <sstream>
 
 #include "gtest/gtest.h"
 #include "odb/db.h"
 #include "odb/dbWireCodec.h"
 #include "odb/lefin.h"
+#include "spdlog/sinks/ostream_sink.h"
+#include "swig_common.h"
 #include "utl/Logger.h"
 
 namespace odb {
@@ -25,6 +31,7 @@ class OdbMultiPatternedTest : public ::testing::Test
   {
     db_ = OdbUniquePtr<odb::dbDatabase>(odb::dbDatabase::create(),
                                         &odb::dbDatabase::destroy);
+    db_->setLogger(&logger_);
     odb::lefin lef_reader(
         db_.get(), &logger_, /*ignore_non_routing_layers=*/false);
     lib_ = OdbUniquePtr<odb::dbLib>(
@@ -130,4 +137,190 @@ TEST_F(OdbMultiPatternedTest, WireColorIsClearedOnNewPath)
   EXPECT_EQ(decoder.getColor().value(), /*mask_color=*/2);
 }
 
+TEST_F(OdbMultiPatternedTest, MappedReadLoadsWiresOnFirstAccess)
+{
+  // Arrange
+  dbNet* net = dbNet::create(block_.get(), "net0");
+  dbTechLayer* met1 = lib_->getTech()->findLayer("met1");
+  dbWire* wire = dbWire::create(net);
+
+  dbWireEncoder encoder;
+  encoder.begin(wire);
+  encoder.newPath(met1, dbWireType::ROUTED);
+  encoder.addPoint(50, 50);
+  encoder.addPoint(100, 50);
+  encoder.end();
+
+  char path[] = "/tmp/TestDbWireXXXXXX";
+  const int fd = mkstemp(path);
+  ASSERT_NE(fd, -1);
+  close(fd);
+  {
+    std::ofstream out(path, std::ios::binary);
+    db_->write(out);
+  }
+
+  // Loading a section is reported at debug level io_size 1.
+  std::ostringstream log;
+  auto sink = std::make_shared<spdlog::sinks::ostream_sink_mt>(log);
+  logger_.addSink(sink);
+  logger_.setDebugLevel(utl::ODB, "io_size", 1);
+
+  // Act
+  OdbUniquePtr<dbDatabase> db(dbDatabase::create(), &dbDatabase::destroy);
+  db->setLogger(&logger_);
+  db->read(path);
+  // The mapping must outlive the file name.
+  unlink(path);
+
+  // Assert
+  dbNet* read_net = db->getChip()->getBlock()->findNet("net0");
+  ASSERT_NE(read_net, nullptr);
+  EXPECT_EQ(log.str().find("loaded wires"), std::string::npos);
+  dbWire* read_wire = read_net->getWire();
+  EXPECT_NE(log.str().find("loaded wires"), std::string::npos);
+  ASSERT_NE(read_wire, nullptr);
+  EXPECT_EQ(read_wire->length(), wire->length());
+  EXPECT_EQ(read_wire->getBBox(), wire->getBBox());
+
+  logger_.removeSink(sink);
+}
+
+TEST_F(OdbMultiPatternedTest, MappedReadRejectsTrailingData)
+{
+  // Arrange
+  char path[] = "/tmp/TestDbWireXXXXXX";
+  const int fd = mkstemp(path);
+  ASSERT_NE(fd, -1);
+  close(fd);
+  {
+    std::ofstream out(path, std::ios::binary);
+    db_->write(out);
+    // The section sizes no longer add up to the file size.
+    out << 'x';
+  }
+
+  // Act & Assert
+  OdbUniquePtr<dbDatabase> db(dbDatabase::create(), &dbDatabase::destroy);
+  EXPECT_THROW(db->read(path), std::ios_base::failure);
+  unlink(path);
+}
+
+TEST_F(OdbMultiPatternedTest, MappedReadFailsCleanlyOnTruncatedFile)
+{
+  // Arrange
+  dbNet* net = dbNet::create(block_.get(), "net0");
+  dbTechLayer* met1 = lib_->getTech()->findLayer("met1");
+  dbWire* wire = dbWire::create(net);
+
+  dbWireEncoder encoder;
+  encoder.begin(wire);
+  encoder.newPath(met1, dbWireType::ROUTED);
+  encoder.addPoint(50, 50);
+  encoder.addPoint(100, 50);
+  encoder.end();
+
+  char path[] = "/tmp/TestDbWireXXXXXX";
+  const int fd = mkstemp(path);
+  ASSERT_NE(fd, -1);
+  close(fd);
+  {
+    std::ofstream out(path, std::ios::binary);
+    db_->write(out);
+  }
+
+  OdbUniquePtr<dbDatabase> db(dbDatabase::create(), &dbDatabase::destroy);
+  db->setLogger(&logger_);
+  db->read(path);
+  dbNet* read_net = db->getChip()->getBlock()->findNet("net0");
+  ASSERT_NE(read_net, nullptr);
+
+  // Act
+  // Touching the unloaded wires of a truncated mapping would raise SIGBUS.
+  ASSERT_EQ(truncate(path, 0), 0);
+
+  // Assert
+  EXPECT_EXIT(read_net->getWire(),
+              ::testing::ExitedWithCode(EXIT_FAILURE),
+              "");
+  unlink(path);
+}
+
+TEST_F(OdbMultiPatternedTest, WriteDbReplacesItsMappedFile)
+{
+  // Arrange
+  block_->setCornerCount(1);
+  dbNet* net0 = dbNet::create(block_.get(), "net0");
+  dbNet* net1 = dbNet::create(block_.get(), "net1");
+  dbTechLayer* met1 = lib_->getTech()->findLayer("met1");
+  dbWire* wire = dbWire::create(net0);
+
+  dbWireEncoder encoder;
+  encoder.begin(wire);
+  encoder.newPath(met1, dbWireType::ROUTED);
+  encoder.addPoint(50, 50);
+  encoder.addPoint(100, 50);
+  encoder.end();
+
+  dbCapNode* node0 = dbCapNode::create(net0, 1, /*foreign=*/true);
+  node0->setInternalFlag();
+  node0->setCapacitance(1.5);
+  dbCapNode* node1 = dbCapNode::create(net1, 1, /*foreign=*/true);
+  node1->setInternalFlag();
+  dbRSeg* rseg = dbRSeg::create(net0, 50, 50, 0, /*allocate_cap=*/true);
+  rseg->setTargetNode(node0->getId());
+  rseg->setResistance(2.5);
+  // getRSegs skips the last created segment, which is the zero segment at the
+  // head of the list, as in dbNet::createZeroRc.
+  dbRSeg* zero_rseg = dbRSeg::create(net0, 0, 0, 0, /*allocate_cap=*/true);
+  zero_rseg->setTargetNode(rseg->getSourceNode());
+  dbCCSeg* ccseg = dbCCSeg::create(node0, node1);
+  ccseg->setCapacitance(0.25);
+
+  char path[] = "/tmp/TestDbWireXXXXXX";
+  const int fd = mkstemp(path);
+  ASSERT_NE(fd, -1);
+  close(fd);
+  {
+    std::ofstream out(path, std::ios::binary);
+    db_->write(out);
+  }
+
+  // Act
+  // The wires and parasitics of the first read are still deferred in the
+  // mapping of path when it is written over.
+  OdbUniquePtr<dbDatabase> mapped_db(dbDatabase::create(),
+                                     &dbDatabase::destroy);
+  mapped_db->setLogger(&logger_);
+  read_db(mapped_db.get(), path);
+  write_db(mapped_db.get(), path);
+  OdbUniquePtr<dbDatabase> db(dbDatabase::create(), &dbDatabase::destroy);
+  read_db(db.get(), path);
+  unlink(path);
+
+  // Assert
+  dbBlock* block = db->getChip()->getBlock();
+  dbNet* read_net0 = block->findNet("net0");
+  ASSERT_NE(read_net0, nullptr);
+  dbWire* read_wire = read_net0->getWire();
+  ASSERT_NE(read_wire, nullptr);
+  EXPECT_EQ(read_wire->length(), wire->length());
+  EXPECT_EQ(read_wire->getBBox(), wire->getBBox());
+
+  ASSERT_EQ(read_net0->getCapNodes().size(), 1);
+  dbCapNode* read_node0 = *read_net0->getCapNodes().begin();
+  EXPECT_DOUBLE_EQ(read_node0->getCapacitance(), 1.5);
+  ASSERT_EQ(read_net0->getRSegs().size(), 1);
+  dbRSeg* read_rseg = *read_net0->getRSegs().begin();
+  EXPECT_DOUBLE_EQ(read_rseg->getResistance(), 2.5);
+  EXPECT_EQ(read_rseg->getTargetNode(), read_node0->getId());
+  ASSERT_EQ(read_node0->getCCSegs().size(), 1);
+  dbCCSeg* read_ccseg = *read_node0->getCCSegs().begin();
+  EXPECT_DOUBLE_EQ(read_ccseg->getCapacitance(), 0.25);
+  uint other_cid;
+  EXPECT_EQ(
+      read_ccseg->getTheOtherCapn(read_node0, other_cid)->getNet()->getName(),
+      "net1");
+}
+
 }  // namespace odb
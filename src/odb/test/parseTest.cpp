@@ -41,6 +41,11 @@
 #include <boost/test/included/unit_test.hpp>
 #endif
 
+#include <unistd.h>
+
+#include <cstdlib>
+#include <string>
+
 #include "odb/parse.h"
 #include "utl/CFileUtils.h"
 #include "utl/Logger.h"
@@ -87,4 +92,71 @@ BOOST_AUTO_TEST_CASE(parser_init_and_parse_line_with_integers)
   parser.setInputFP(nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(parser_mapped_input_matches_stream_input)
+{
+  utl::Logger logger;
+
+  char path[] = "/tmp/parseTestXXXXXX";
+  const int fd = mkstemp(path);
+  BOOST_TEST_REQUIRE(fd >= 0);
+  const std::string kContents
+      = "*D_NET *1 0.5\n# comment\n\n\t1 *1:2  *2:1 0.25 #tail\nlast";
+  BOOST_TEST_REQUIRE(write(fd, kContents.data(), kContents.size())
+                     == (ssize_t) kContents.size());
+  close(fd);
+
+  Ath__parser stream_parser(&logger);
+  stream_parser.openFile(path);
+  Ath__parser mapped_parser(&logger);
+  mapped_parser.enableMappedInput(2);
+  mapped_parser.openFile(path);
+
+  int lines = 0;
+  int cnt;
+  while ((cnt = stream_parser.parseNextLine()) > 0) {
+    BOOST_TEST(mapped_parser.parseNextLine() == cnt);
+    BOOST_TEST(mapped_parser.getLineNum() == stream_parser.getLineNum());
+    for (int ii = 0; ii < cnt; ii++) {
+      BOOST_TEST(std::string(mapped_parser.get(ii)) == stream_parser.get(ii));
+    }
+    lines++;
+  }
+  BOOST_TEST(lines == 3);
+  BOOST_TEST(mapped_parser.parseNextLine() == cnt);
+
+  unlink(path);
+}
+
+BOOST_AUTO_TEST_CASE(parser_mapped_input_then_gzip_input)
+{
+  utl::Logger logger;
+
+  char path[] = "/tmp/parseTestXXXXXX";
+  const int fd = mkstemp(path);
+  BOOST_TEST_REQUIRE(fd >= 0);
+  const std::string kContents = "*D_NET *1 0.5\n*END\n";
+  BOOST_TEST_REQUIRE(write(fd, kContents.data(), kContents.size())
+                     == (ssize_t) kContents.size());
+  close(fd);
+  const std::string gz_path = std::string(path) + ".gz";
+  const std::string cmd = "gzip -c " + std::string(path) + " > " + gz_path;
+  BOOST_TEST_REQUIRE(system(cmd.c_str()) == 0);
+
+  // A mapped file followed by a compressed one, as in
+  // read_spef a.spef b.spef.gz
+  Ath__parser parser(&logger);
+  parser.enableMappedInput(2);
+  for (const char* name : {path, gz_path.c_str()}) {
+    parser.openFile(name);
+    BOOST_TEST(parser.parseNextLine() == 3);
+    BOOST_TEST(std::string(parser.get(0)) == "*D_NET");
+    BOOST_TEST(parser.parseNextLine() == 1);
+    BOOST_TEST(std::string(parser.get(0)) == "*END");
+    BOOST_TEST(parser.parseNextLine() < 0);
+  }
+
+  unlink(path);
+  unlink(gz_path.c_str());
+}
+
 }  // namespace odb
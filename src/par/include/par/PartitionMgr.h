@@ -87,6 +87,9 @@ class PartitionMgr
             sta::dbSta* sta,
             utl::Logger* logger);
 
+  // The number of threads used by TritonPart coarsening
+  void setNumThreads(int num_threads) { num_threads_ = num_threads; }
+
   // The function for partitioning a hypergraph
   // This is used for replacing hMETIS
   // Key supports:
@@ -276,6 +279,7 @@ class PartitionMgr
   sta::dbNetwork* db_network_ = nullptr;
   sta::dbSta* sta_ = nullptr;
   utl::Logger* logger_ = nullptr;
+  int num_threads_ = 1;
 };
 
 }  // namespace par
@@ -40,9 +40,11 @@
 
 #include "Coarsener.h"
 
+#include <algorithm>
 #include <numeric>
 #include <random>
 #include <set>
+#include <thread>
 
 #include "Evaluator.h"
 #include "Hypergraph.h"
@@ -52,6 +54,49 @@ using utl::PAR;
 
 namespace par {
 
+// Row of a flat row-major array
+static FloatSpan Row(const std::vector<float>& flat,
+                     const int row,
+                     const int dimensions)
+{
+  return {flat.data() + row * dimensions, dimensions};
+}
+
+static void AppendRow(std::vector<float>& flat, const FloatSpan row)
+{
+  flat.insert(flat.end(), row.begin(), row.end());
+}
+
+static void SetRow(std::vector<float>& flat,
+                   const int row,
+                   const std::vector<float>& value)
+{
+  std::copy(value.begin(), value.end(), flat.begin() + row * value.size());
+}
+
+// Split [0, size) into num_threads contiguous chunks and run
+// func(chunk_id, begin, end) on each chunk in its own thread.
+// Chunk chunk_id always covers the same range for a given num_threads,
+// so per-chunk results can be merged in order deterministically.
+template <typename Func>
+static void ParallelForChunks(const int num_threads,
+                              const int size,
+                              const Func& func)
+{
+  const int chunk_size = (size + num_threads - 1) / num_threads;
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (int chunk_id = 1; chunk_id < num_threads; chunk_id++) {
+    const int begin = std::min(size, chunk_id * chunk_size);
+    const int end = std::min(size, begin + chunk_size);
+    threads.emplace_back(func, chunk_id, begin, end);
+  }
+  func(0, 0, std::min(size, chunk_size));  // the first chunk runs here
+  for (auto& t : threads) {
+    t.join();  // wait for all threads to finish
+  }
+}
+
 Coarsener::Coarsener(const int num_parts,
                      const int thr_coarsen_hyperedge_size_skip,
                      const int thr_coarsen_vertices,
@@ -169,6 +214,16 @@ CoarseGraphPtrs Coarsener::LazyFirstChoice(const HGraphPtr& hgraph) const
              1,
              "Hierarchical coarsening time {} seconds",
              time_taken);
+  size_t hierarchy_bytes = 0;
+  for (const auto& hg : hierarchy) {
+    hierarchy_bytes += hg->GetMemoryBytes();
+  }
+  debugPrint(logger_,
+             PAR,
+             "coarsening",
+             1,
+             "Hierarchy memory {:.1f} MB",
+             hierarchy_bytes / 1e6);
   return hierarchy;
 }
 
@@ -187,10 +242,10 @@ HGraphPtr Coarsener::GroupVertices(
 {
   std::vector<int>
       vertex_cluster_id_vec;          // map current vertex_id to cluster_id
-  Matrix<float> vertex_weights_c;     // cluster weight
+  std::vector<float> vertex_weights_c;  // cluster weight
   std::vector<int> community_attr_c;  // cluster community information
   std::vector<int> fixed_attr_c;      // cluster fixed attribute
-  Matrix<float> placement_attr_c;     // cluster placement attribute
+  std::vector<float> placement_attr_c;  // cluster placement attribute
 
   // Cluster based group information
   ClusterBasedGroupInfo(hgraph,
@@ -233,10 +288,10 @@ HGraphPtr Coarsener::GroupVertices(
 HGraphPtr Coarsener::Aggregate(const HGraphPtr& hgraph) const
 {
   std::vector<int> vertex_cluster_id_vec;
-  Matrix<float> vertex_weights_c;
+  std::vector<float> vertex_weights_c;
   std::vector<int> community_attr_c;
   std::vector<int> fixed_attr_c;
-  Matrix<float> placement_attr_c;
+  std::vector<float> placement_attr_c;
 
   // find the vertex matching scheme
   VertexMatching(hgraph,
@@ -278,10 +333,10 @@ void Coarsener::VertexMatching(
     std::vector<int>&
         vertex_cluster_id_vec,  // map current vertex_id to cluster_id
     // the remaining arguments are related to clusters
-    Matrix<float>& vertex_weights_c,
+    std::vector<float>& vertex_weights_c,
     std::vector<int>& community_attr_c,
     std::vector<int>& fixed_attr_c,
-    Matrix<float>& placement_attr_c) const
+    std::vector<float>& placement_attr_c) const
 {
   // vertex_cluster_map_vec has the size of the number of vertices of hgraph
   vertex_cluster_id_vec.clear();
@@ -306,13 +361,13 @@ void Coarsener::VertexMatching(
       // mark fixed vertices as single-vertex clusters
       if (hgraph->GetFixedAttr(v) > -1) {
         vertex_cluster_id_vec[v] = cluster_id++;
-        vertex_weights_c.push_back(hgraph->GetVertexWeights(v));
+        AppendRow(vertex_weights_c, hgraph->GetVertexWeights(v));
         fixed_attr_c.push_back(hgraph->GetFixedAttr(v));
         if (hgraph->HasCommunity()) {
           community_attr_c.push_back(hgraph->GetCommunity(v));
         }
         if (hgraph->HasPlacement()) {
-          placement_attr_c.push_back(hgraph->GetPlacement(v));
+          AppendRow(placement_attr_c, hgraph->GetPlacement(v));
         }
       } else {
         unvisited.push_back(v);  // this vertex is not fixed
@@ -321,184 +376,236 @@ void Coarsener::VertexMatching(
   }
   // shuffle the remaining vertices based on user-specified options
   OrderVertices(hgraph, unvisited);
-  // calculate the best vertex to cluster for current vertex
-  // if the number of visited vertices is larger than
-  // num_early_stop_visited_vertices, then stop the coarsening process
-  const int num_early_stop_visited_vertices
-      = static_cast<int>(unvisited.size()) / coarsening_ratio_;
-  int num_visited_vertices = 0;
-  for (auto v_iter = unvisited.begin(); v_iter != unvisited.end(); v_iter++) {
-    const int v = *v_iter;  // here we should use iterator to enable early-stop
-                            // mechanism
-    if (vertex_cluster_id_vec[v] > -1) {
-      continue;  // this vertex has been mapped
+  ParallelVertexMatching(hgraph,
+                         unvisited,
+                         cluster_id,
+                         vertex_cluster_id_vec,
+                         vertex_weights_c,
+                         community_attr_c,
+                         fixed_attr_c,
+                         placement_attr_c);
+}
+
+// Greedy matching of the vertices in visiting order, with the scoring of
+// the neighbors done in parallel.  It has two phases:
+// (1) every unvisited vertex finds its best neighbor in parallel, before any
+//     vertex is clustered.
+// (2) the vertices are clustered in visiting order.  The proposal of a
+//     vertex still holds unless its best neighbor has grown too heavy or
+//     several neighbors share the best score, as the tie is broken on
+//     whether they are clustered.  In these cases the best neighbor is found
+//     again from the current clusters.
+// A vertex then gets the same neighbor as if the vertices were matched one
+// at a time, so the result does not depend on the number of threads.
+void Coarsener::ParallelVertexMatching(
+    const HGraphPtr& hgraph,
+    const std::vector<int>& unvisited,
+    int cluster_id,
+    std::vector<int>&
+        vertex_cluster_id_vec,  // map current vertex_id to cluster_id
+    // the remaining arguments are related to clusters
+    std::vector<float>& vertex_weights_c,
+    std::vector<int>& community_attr_c,
+    std::vector<int>& fixed_attr_c,
+    std::vector<float>& placement_attr_c) const
+{
+  const int num_vertices = hgraph->GetNumVertices();
+  const int vertex_dims = hgraph->GetVertexDimensions();
+  const int placement_dims = hgraph->GetPlacementDimensions();
+  // map v as a single-vertex cluster
+  auto add_single_vertex_cluster = [&](const int v) {
+    vertex_cluster_id_vec[v] = cluster_id++;
+    AppendRow(vertex_weights_c, hgraph->GetVertexWeights(v));
+    if (hgraph->HasPlacement()) {
+      AppendRow(placement_attr_c, hgraph->GetPlacement(v));
     }
+    if (hgraph->HasCommunity()) {
+      community_attr_c.push_back(hgraph->GetCommunity(v));
+    }
+    if (hgraph->HasFixedVertices()) {
+      fixed_attr_c.push_back(hgraph->GetFixedAttr(v));
+    }
+  };
+  // the current weight of the cluster containing u (or of u itself)
+  auto cluster_weight = [&](const int u) -> FloatSpan {
+    return vertex_cluster_id_vec[u] > -1
+               ? Row(vertex_weights_c, vertex_cluster_id_vec[u], vertex_dims)
+               : hgraph->GetVertexWeights(u);
+  };
+
+  // sparse score buffers of each thread: (neighbor, score) pairs sorted by
+  // neighbor, so the memory only grows with the degree of the vertices
+  using ScoreBuffer = std::vector<std::pair<int, float>>;
+  std::vector<ScoreBuffer> buffers(num_threads_);
 
-    // initialize the score for neighbors
-    std::map<int, float> score_map;
-    // traverse all its neighbors
+  // find the best neighbor of v (-1 if there is no valid neighbor) from the
+  // current clusters.  The scores are summed up in the order of the
+  // hyperedges of v, and ties are broken in favor of the last unclustered
+  // neighbor, as when the neighbors are scored in a map.  tied is set if
+  // several neighbors have the best score.
+  auto find_best_neighbor
+      = [&](const int v, ScoreBuffer& scores, bool& tied) -> int {
+    scores.clear();
     for (const int he : hgraph->Edges(v)) {
       const auto edge_range = hgraph->Vertices(he);
       const int he_size = edge_range.size();
       if (he_size <= 1 || he_size > thr_coarsen_hyperedge_size_skip_) {
         continue;
       }
-      // get the normalized score
       const float he_score = evaluator_->GetNormEdgeScore(he, hgraph);
-      // check the vertices in this hyperedge
       for (const int nbr_v : edge_range) {
-        if (nbr_v == v) {
-          continue;  // ignore the vertex v itself
+        if (nbr_v != v) {
+          scores.emplace_back(nbr_v, he_score);
         }
-        // if the nbr_v has been identified
-        if (score_map.find(nbr_v) != score_map.end()) {
-          score_map[nbr_v] += he_score;
-          continue;
-        }
-        // if the nbr_v is a new neighbor
-        //
-        // check if the merging conditions are satisfied
-        // we do not allow the weight of cluster exceed the weight threshold
-        // we do not allow the merging of non-fixed vertices with fixed-vertices
-        // we do not allow the merging between vertices in different communities
-        if ((hgraph->HasFixedVertices() && hgraph->GetFixedAttr(nbr_v) > -1)
-            || (hgraph->HasCommunity()
-                && hgraph->GetCommunity(v) != hgraph->GetCommunity(nbr_v))) {
-          continue;
-        }
-        // check the vertex weight constraint
-        const std::vector<float>& nbr_v_weight
-            = vertex_cluster_id_vec[nbr_v] > -1
-                  ? vertex_weights_c[vertex_cluster_id_vec[nbr_v]]
-                  : hgraph->GetVertexWeights(nbr_v);
-        // This line needs to be updated
-        if (hgraph->GetVertexWeights(v) + nbr_v_weight > thr_cluster_weight_) {
-          continue;  // cannot satisfy the vertex weight constraint
-        }
-        score_map[nbr_v] = he_score;
-      }
-    }  // finish traversing all the neighbors
-
-    // if there is no neighbor, map current vertex as a single-vertex cluster
-    if (score_map.empty()) {
-      num_visited_vertices++;
-      vertex_cluster_id_vec[v] = cluster_id++;
-      vertex_weights_c.push_back(hgraph->GetVertexWeights(v));
-      if (hgraph->HasPlacement()) {
-        placement_attr_c.push_back(hgraph->GetPlacement(v));
       }
-      if (hgraph->HasCommunity()) {
-        community_attr_c.push_back(hgraph->GetCommunity(v));
+    }
+    // sum up the scores of each neighbor and drop the neighbors which
+    // violate the merging conditions:
+    // we do not allow the weight of cluster exceed the weight threshold
+    // we do not allow the merging of non-fixed vertices with fixed-vertices
+    // we do not allow the merging between vertices in different communities
+    std::stable_sort(
+        scores.begin(), scores.end(), [](const auto& a, const auto& b) {
+          return a.first < b.first;
+        });
+    int num_scores = 0;
+    for (int i = 0; i < static_cast<int>(scores.size());) {
+      const int nbr_v = scores[i].first;
+      float score = scores[i++].second;
+      for (; i < static_cast<int>(scores.size()) && scores[i].first == nbr_v;
+           i++) {
+        score += scores[i].second;
       }
-      if (hgraph->HasFixedVertices()) {
-        fixed_attr_c.push_back(hgraph->GetFixedAttr(v));
+      if ((hgraph->HasFixedVertices() && hgraph->GetFixedAttr(nbr_v) > -1)
+          || (hgraph->HasCommunity()
+              && hgraph->GetCommunity(v) != hgraph->GetCommunity(nbr_v))
+          || hgraph->GetVertexWeights(v) + cluster_weight(nbr_v)
+                 > thr_cluster_weight_) {
+        continue;
       }
-      continue;
+      scores[num_scores++] = {nbr_v, score};
     }
+    scores.resize(num_scores);
     // update the score based on critical timing paths
-    // Here we do not need to traverse the entire paths
-    // we just need to check the neighbors of the path
-    // because if there is a path, the most important neighbors
-    // must have been counter when traversing hyperedges before
     // We just consider the direct neighbors of the vertex
     // i.e., left neighbor and right neighbor
-    // TODO: 20230409:
-    // Exploration that if we can further improve the results by considering
-    // more neighbors on timing-critical paths
-    // No idea yet.
+    auto add_score = [&scores](const int u, const float score) {
+      auto iter = std::lower_bound(
+          scores.begin(), scores.end(), u, [](const auto& entry, const int w) {
+            return entry.first < w;
+          });
+      if (iter != scores.end() && iter->first == u) {
+        iter->second += score;
+      }
+    };
     if (hgraph->HasTiming() && hgraph->GetNumTimingPaths() > 0) {
       for (const int p : hgraph->TimingPathsThrough(v)) {
         const float path_timing_score
             = evaluator_->GetPathTimingScore(p, hgraph);
-        // traverse the current path
         auto path_range = hgraph->PathVertices(p);
         for (auto iter = path_range.begin(); iter != path_range.end(); ++iter) {
-          const int vertex_id = *iter;
-          if (vertex_id != v) {
-            continue;  // we need to find the neighbors of v, so continue here
+          if (*iter != v) {
+            continue;
           }
-          std::vector<int> neighbors;
           if (iter != path_range.begin()) {
-            neighbors.push_back(*(iter - 1));  // left neighbor
+            add_score(*(iter - 1), path_timing_score);
           }
           if (iter + 1 != path_range.end()) {
-            neighbors.push_back(*(iter + 1));  // right neighbor
-          }
-          // add the score.
-          // If the neighbor not found by connectivity, which means the balance
-          // constraint cannot be statisfied
-          for (const auto& nbr_v : neighbors) {
-            if (score_map.find(nbr_v) != score_map.end()) {
-              score_map[nbr_v] += path_timing_score;
-            }
+            add_score(*(iter + 1), path_timing_score);
           }
-        }  // finish traversing current paths
-      }    // finish current nbr_v
-    }
-    // update the score based on physical location information
-    if (hgraph->HasPlacement()) {
-      for (auto& [u, score] : score_map) {  // the score will be updated
-        score += evaluator_->GetPlacementScore(v, u, hgraph);
+        }
       }
     }
-    // find the best neighbor vertex
-    float best_score = -std::numeric_limits<float>::max();
     int best_vertex = -1;
-    for (const auto& [u, score] : score_map) {
+    float best_score = -std::numeric_limits<float>::max();
+    int num_best = 0;
+    for (auto& [u, score] : scores) {
+      if (hgraph->HasPlacement()) {
+        score += evaluator_->GetPlacementScore(v, u, hgraph);
+      }
       if (score > best_score) {
         best_vertex = u;
         best_score = score;
-      } else if (score == best_score && vertex_cluster_id_vec[u] == -1) {
-        best_vertex = u;
+        num_best = 1;
+      } else if (score == best_score) {
+        num_best++;
+        if (vertex_cluster_id_vec[u] == -1) {
+          best_vertex = u;
+        }
       }
     }
+    tied = num_best > 1;
+    return best_vertex;
+  };
 
+  // phase 1: find the best neighbor of each vertex in parallel
+  const int num_unvisited = unvisited.size();
+  std::vector<int> best_neighbor(num_unvisited, -1);
+  std::vector<char> tied(num_unvisited, false);
+  ParallelForChunks(
+      num_threads_,
+      num_unvisited,
+      [&](const int chunk_id, const int begin, const int end) {
+        ScoreBuffer& buffer = buffers[chunk_id];
+        for (int i = begin; i < end; i++) {
+          bool is_tied = false;
+          best_neighbor[i] = find_best_neighbor(unvisited[i], buffer, is_tied);
+          tied[i] = is_tied;
+        }
+      });
+
+  // phase 2: cluster the vertices in visiting order
+  // if the number of visited vertices is larger than
+  // num_early_stop_visited_vertices, then stop the coarsening process
+  const int num_early_stop_visited_vertices = num_unvisited / coarsening_ratio_;
+  int num_visited_vertices = 0;
+  for (int i = 0; i < num_unvisited; i++) {
+    const int v = unvisited[i];
+    if (vertex_cluster_id_vec[v] > -1) {
+      continue;  // v has been mapped
+    }
+    int best_vertex = best_neighbor[i];
+    if (tied[i]
+        || (best_vertex > -1
+            && hgraph->GetVertexWeights(v) + cluster_weight(best_vertex)
+                   > thr_cluster_weight_)) {
+      bool is_tied = false;
+      best_vertex = find_best_neighbor(v, buffers[0], is_tied);
+    }
     if (best_vertex == -1) {
-      num_visited_vertices += 1;
-      vertex_cluster_id_vec[v] = cluster_id;
-      cluster_id++;
-      vertex_weights_c.push_back(hgraph->GetVertexWeights(v));
-      if (hgraph->HasPlacement()) {
-        placement_attr_c.push_back(hgraph->GetPlacement(v));
-      }
-      if (hgraph->HasCommunity()) {
-        community_attr_c.push_back(hgraph->GetCommunity(v));
-      }
-      if (hgraph->HasFixedVertices()) {
-        fixed_attr_c.push_back(hgraph->GetFixedAttr(v));
-      }
+      num_visited_vertices++;
+      add_single_vertex_cluster(v);
       continue;
     }
-
-    // cluster best_vertex and v
-    // Case 1 : best_vertex has been clustered with other vertices, add v to
-    // that cluster Case 2 : best_vertex and v both are not clustered
     if (vertex_cluster_id_vec[best_vertex] > -1) {
+      // add v to the cluster of best_vertex
       num_visited_vertices++;
       const int best_cluster_id = vertex_cluster_id_vec[best_vertex];
       vertex_cluster_id_vec[v] = best_cluster_id;
       // you cannot change the order here
-      // update the placement location
       if (hgraph->HasPlacement()) {
-        placement_attr_c[best_cluster_id]
-            = evaluator_->GetAvgPlacementLoc(vertex_weights_c[best_cluster_id],
-                                             hgraph->GetVertexWeights(v),
-                                             placement_attr_c[best_cluster_id],
-                                             hgraph->GetPlacement(v));
+        SetRow(placement_attr_c,
+               best_cluster_id,
+               evaluator_->GetAvgPlacementLoc(
+                   Row(vertex_weights_c, best_cluster_id, vertex_dims),
+                   hgraph->GetVertexWeights(v),
+                   Row(placement_attr_c, best_cluster_id, placement_dims),
+                   hgraph->GetPlacement(v)));
       }
-      // update the weight of cluster
-      vertex_weights_c[best_cluster_id]
-          = vertex_weights_c[best_cluster_id] + hgraph->GetVertexWeights(v);
+      Accumulate(vertex_weights_c.data() + best_cluster_id * vertex_dims,
+                 hgraph->GetVertexWeights(v));
     } else {
+      // cluster best_vertex and v
       num_visited_vertices += 2;
       vertex_cluster_id_vec[best_vertex] = cluster_id;
       vertex_cluster_id_vec[v] = cluster_id;
       cluster_id++;
-      vertex_weights_c.push_back(hgraph->GetVertexWeights(best_vertex)
-                                 + hgraph->GetVertexWeights(v));
+      AppendRow(vertex_weights_c,
+                hgraph->GetVertexWeights(best_vertex)
+                    + hgraph->GetVertexWeights(v));
       if (hgraph->HasPlacement()) {
-        placement_attr_c.push_back(
-            evaluator_->GetAvgPlacementLoc(v, best_vertex, hgraph));
+        AppendRow(placement_attr_c,
+                  evaluator_->GetAvgPlacementLoc(v, best_vertex, hgraph));
       }
       if (hgraph->HasCommunity()) {
         community_attr_c.push_back(hgraph->GetCommunity(v));
@@ -507,38 +614,19 @@ void Coarsener::VertexMatching(
         fixed_attr_c.push_back(hgraph->GetFixedAttr(v));
       }
     }
-    const int remaining_vertices
-        = hgraph->GetNumVertices() + cluster_id - num_visited_vertices;
     // check the early-stop condition
+    const int remaining_vertices
+        = num_vertices + cluster_id - num_visited_vertices;
     if (remaining_vertices <= num_early_stop_visited_vertices) {
-      int num_visited_vertices_new = 0;
-      for (auto flag_new : vertex_cluster_id_vec) {
-        if (flag_new > -1) {
-          num_visited_vertices_new++;
-        }
-      }
-      v_iter++;
-      while (v_iter != unvisited.end()) {
-        const int cur_vertex = *v_iter;
-        // increasr the pointer
-        v_iter++;
-        if (vertex_cluster_id_vec[cur_vertex] > -1) {
-          continue;  // this vertex has been visited
-        }
-        vertex_cluster_id_vec[cur_vertex] = cluster_id++;
-        vertex_weights_c.push_back(hgraph->GetVertexWeights(cur_vertex));
-        if (hgraph->HasPlacement()) {
-          placement_attr_c.push_back(hgraph->GetPlacement(cur_vertex));
-        }
-        if (hgraph->HasCommunity()) {
-          community_attr_c.push_back(hgraph->GetCommunity(cur_vertex));
-        }
-        if (hgraph->HasFixedVertices()) {
-          fixed_attr_c.push_back(hgraph->GetFixedAttr(cur_vertex));
-        }
-      }
-      return;  // exit the coarsening process
-    }          // early exit
+      break;
+    }
+  }
+
+  // map all the remaining vertices as single-vertex clusters
+  for (const int v : unvisited) {
+    if (vertex_cluster_id_vec[v] == -1) {
+      add_single_vertex_cluster(v);
+    }
   }
 }
 
@@ -556,10 +644,10 @@ void Coarsener::ClusterBasedGroupInfo(
     std::vector<int>&
         vertex_cluster_id_vec,  // map current vertex_id to cluster_id
     // the remaining arguments are related to clusters
-    Matrix<float>& vertex_weights_c,
+    std::vector<float>& vertex_weights_c,
     std::vector<int>& community_attr_c,
     std::vector<int>& fixed_attr_c,
-    Matrix<float>& placement_attr_c) const
+    std::vector<float>& placement_attr_c) const
 {
   // convert group_attr to vertex_cluster_id_vec
   if (group_attr.empty() == true && hgraph->GetFixedAttrSize() == 0) {
@@ -630,11 +718,9 @@ void Coarsener::ClusterBasedGroupInfo(
   fixed_attr_c.clear();
   placement_attr_c.clear();
   // update vertex weights
-  vertex_weights_c.clear();
-  for (int v = 0; v < num_clusters; v++) {
-    std::vector<float> v_wt(hgraph->GetVertexDimensions(), 0.0);
-    vertex_weights_c.push_back(v_wt);
-  }
+  const int vertex_dims = hgraph->GetVertexDimensions();
+  const int placement_dims = hgraph->GetPlacementDimensions();
+  vertex_weights_c.assign(num_clusters * vertex_dims, 0.0);
   if (hgraph->HasCommunity()) {
     community_attr_c.clear();
     community_attr_c.resize(num_clusters);
@@ -646,11 +732,7 @@ void Coarsener::ClusterBasedGroupInfo(
     std::fill(fixed_attr_c.begin(), fixed_attr_c.end(), -1);
   }
   if (hgraph->HasPlacement()) {
-    placement_attr_c.clear();
-    for (int v = 0; v < num_clusters; v++) {
-      std::vector<float> v_placement(hgraph->GetPlacementDimensions(), 0.0);
-      placement_attr_c.push_back(v_placement);
-    }
+    placement_attr_c.assign(num_clusters * placement_dims, 0.0);
   }
 
   // Update the attributes of clusters
@@ -665,14 +747,16 @@ void Coarsener::ClusterBasedGroupInfo(
           = std::max(fixed_attr_c[cluster_id], hgraph->GetFixedAttr(v));
     }
     if (hgraph->HasPlacement()) {
-      placement_attr_c[cluster_id]
-          = evaluator_->GetAvgPlacementLoc(vertex_weights_c[cluster_id],
-                                           hgraph->GetVertexWeights(v),
-                                           placement_attr_c[cluster_id],
-                                           hgraph->GetPlacement(v));
-    }
-    vertex_weights_c[cluster_id]
-        = vertex_weights_c[cluster_id] + hgraph->GetVertexWeights(v);
+      SetRow(placement_attr_c,
+             cluster_id,
+             evaluator_->GetAvgPlacementLoc(
+                 Row(vertex_weights_c, cluster_id, vertex_dims),
+                 hgraph->GetVertexWeights(v),
+                 Row(placement_attr_c, cluster_id, placement_dims),
+                 hgraph->GetPlacement(v)));
+    }
+    Accumulate(vertex_weights_c.data() + cluster_id * vertex_dims,
+               hgraph->GetVertexWeights(v));
   }
 }
 
@@ -738,121 +822,168 @@ HGraphPtr Coarsener::Contraction(
     const std::vector<int>&
         vertex_cluster_id_vec,  // map current vertex_id to cluster_id
     // the remaining arguments are related to clusters
-    const Matrix<float>& vertex_weights_c,
+    const std::vector<float>& vertex_weights_c,
     const std::vector<int>& community_attr_c,
     const std::vector<int>& fixed_attr_c,
-    const Matrix<float>& placement_attr_c) const
+    const std::vector<float>& placement_attr_c) const
 {
   // Step 1:  identify the contracted hyperedges
+  const int num_hyperedges = hgraph->GetNumHyperedges();
   std::vector<int> hyperedge_cluster_id_vec;  // map the hyperedge to hyperedge
                                               // in clustered hypergraph
-  hyperedge_cluster_id_vec.resize(hgraph->GetNumHyperedges());
+  hyperedge_cluster_id_vec.resize(num_hyperedges);
   // -1 means the hyperedge is fully within one cluster
   std::fill(
       hyperedge_cluster_id_vec.begin(), hyperedge_cluster_id_vec.end(), -1);
-  Matrix<int> hyperedges_c;  // represent each hyperedge as a set of clusters
-  Matrix<float> hyperedges_weights_c;  // each element represents the weight of
-                                       // the clustered hyperedge
+
+  // (a) map each hyperedge to its sorted set of clusters in parallel.
+  // The single-vertex hyperedges, the large hyperedges and the hyperedges
+  // fully within one cluster get an empty set.
+  std::vector<std::vector<int>> chunk_eind(num_threads_);
+  std::vector<int> set_size(num_hyperedges, 0);
+  std::vector<size_t> set_hash(num_hyperedges, 0);
+  ParallelForChunks(
+      num_threads_,
+      num_hyperedges,
+      [&](const int chunk_id, const int begin, const int end) {
+        std::vector<int>& eind = chunk_eind[chunk_id];
+        for (int e = begin; e < end; e++) {
+          const auto range = hgraph->Vertices(e);
+          const int he_size = range.size();
+          if (he_size <= 1 || he_size > thr_coarsen_hyperedge_size_skip_) {
+            continue;  // ignore the single-vertex hyperedge and large hyperedge
+          }
+          const int start = static_cast<int>(eind.size());
+          for (const int vertex_id : range) {
+            eind.push_back(vertex_cluster_id_vec[vertex_id]);  // get cluster id
+          }
+          std::sort(eind.begin() + start, eind.end());
+          eind.erase(std::unique(eind.begin() + start, eind.end()), eind.end());
+          if (static_cast<int>(eind.size()) - start <= 1) {
+            eind.resize(start);  // ignore the single-vertex hyperedge
+            continue;
+          }
+          set_size[e] = static_cast<int>(eind.size()) - start;
+          set_hash[e] = std::inner_product(eind.begin() + start,
+                                           eind.end(),
+                                           eind.begin() + start,
+                                           static_cast<size_t>(0));
+        }
+      });
+  // the chunks are contiguous, so concatenating them gives the sets in
+  // hyperedge order
+  std::vector<int> set_ptr(num_hyperedges + 1, 0);
+  for (int e = 0; e < num_hyperedges; e++) {
+    set_ptr[e + 1] = set_ptr[e] + set_size[e];
+  }
+  std::vector<int> set_ind;
+  set_ind.reserve(set_ptr.back());
+  for (auto& eind : chunk_eind) {
+    set_ind.insert(set_ind.end(), eind.begin(), eind.end());
+    std::vector<int>().swap(eind);
+  }
+
+  // (b) detect parallel hyperedges in parallel.
+  // The hyperedges are distributed into one bucket per thread based on the
+  // hash value, so parallel hyperedges always fall into the same bucket.
+  // representative[e] is the first hyperedge with the same set as e.
+  std::vector<std::vector<int>> buckets(num_threads_);
+  for (int e = 0; e < num_hyperedges; e++) {
+    if (set_size[e] > 0) {
+      buckets[set_hash[e] % num_threads_].push_back(e);
+    }
+  }
+  auto set_less = [&](const int e1, const int e2) {
+    if (set_hash[e1] != set_hash[e2]) {
+      return set_hash[e1] < set_hash[e2];
+    }
+    if (set_size[e1] != set_size[e2]) {
+      return set_size[e1] < set_size[e2];
+    }
+    return std::lexicographical_compare(set_ind.begin() + set_ptr[e1],
+                                        set_ind.begin() + set_ptr[e1 + 1],
+                                        set_ind.begin() + set_ptr[e2],
+                                        set_ind.begin() + set_ptr[e2 + 1]);
+  };
+  std::vector<int> representative(num_hyperedges, -1);
+  ParallelForChunks(
+      num_threads_,
+      num_threads_,
+      [&](const int chunk_id, const int begin, const int end) {
+        for (int bucket_id = begin; bucket_id < end; bucket_id++) {
+          std::vector<int>& bucket = buckets[bucket_id];
+          // the hyperedge ids break the ties, so the first hyperedge of
+          // each group of parallel hyperedges is its representative
+          std::sort(bucket.begin(), bucket.end(), [&](int e1, int e2) {
+            if (set_less(e1, e2)) {
+              return true;
+            }
+            return !set_less(e2, e1) && e1 < e2;
+          });
+          for (size_t i = 0; i < bucket.size(); i++) {
+            const int e = bucket[i];
+            representative[e] = (i > 0 && !set_less(bucket[i - 1], e))
+                                    ? representative[bucket[i - 1]]
+                                    : e;
+          }
+        }
+      });
+
+  // (c) create the clustered hyperedges in hyperedge order
+  // represent each hyperedge as a set of clusters in CSR form
+  std::vector<int> eind_c;
+  std::vector<int> eptr_c(1, 0);
+  // flat array of the weights of the clustered hyperedges
+  std::vector<float> hyperedges_weights_c;
+  const int hyperedge_dims = hgraph->GetHyperedgeDimensions();
   std::vector<float> hyperedge_slack_c;  // the slack for clustered hyperedge.
   std::vector<std::set<int>>
       hyperedge_arc_set_c;  // map current hyperedge into arcs in timing graph.
                             // We need this for propagation
-  std::map<size_t, int>
-      hash_map;  // store the hash value of each contracted hyperedge
-  std::map<size_t, std::vector<int>>
-      parallel_hash_map;  // store the hyperedges_c with the same hash_value
-                          // (candidate)
-  for (int e = 0; e < hgraph->GetNumHyperedges(); e++) {
-    const auto range = hgraph->Vertices(e);
-    const int he_size = range.size();
-    if (he_size <= 1 || he_size > thr_coarsen_hyperedge_size_skip_) {
-      continue;  // ignore the single-vertex hyperedge and large hyperedge
-    }
-    std::set<int> hyperedge_c;
-    for (const int vertex_id : range) {
-      hyperedge_c.insert(vertex_cluster_id_vec[vertex_id]);  // get cluster id
-    }
-    if (hyperedge_c.size() <= 1) {
-      continue;  // ignore the single-vertex hyperedge
-    }
-    size_t hash_value = std::inner_product(hyperedge_c.begin(),
-                                           hyperedge_c.end(),
-                                           hyperedge_c.begin(),
-                                           static_cast<size_t>(0));
-    // check if the hash value has been used
-    // for detecting parallel hyperedge
-    // hyperedge_slack_c[e] = min_slack(hyperedge_arc_set_c[e])
-    if (hash_map.find(hash_value) == hash_map.end()) {
-      const int hyperedge_c_id = static_cast<int>(hyperedges_c.size());
-      hyperedge_cluster_id_vec[e] = hyperedge_c_id;
-      hash_map[hash_value] = hyperedge_c_id;
-      hyperedges_c.push_back(
-          std::vector<int>(hyperedge_c.begin(), hyperedge_c.end()));
-      hyperedges_weights_c.push_back(hgraph->GetHyperedgeWeights(e));
-      if (hgraph->HasTiming()) {
-        hyperedge_slack_c.push_back(
-            hgraph->GetHyperedgeTimingAttr(e));  // the slack of hyperedge
-        hyperedge_arc_set_c.push_back(
-            hgraph->GetHyperedgeArcSet(e));  // map the hyperedge to timing arcs
-      }
+  for (int e = 0; e < num_hyperedges; e++) {
+    if (set_size[e] == 0) {
       continue;
     }
-
-    // there may be parallel hyperedges
-    const int hash_hyperedge_c_id
-        = hash_map[hash_value];  // the hyperedge_c has been found
-    std::vector<int> hyperedge_vec(hyperedge_c.begin(), hyperedge_c.end());
-    // check the representative hyperedge_c
-    int parallel_hyperedge_c_id
-        = -1;  // the hyperedge_c_id of parallel hyperedge
-    // find the parallel_hyperedge_c_id
-    if (hyperedge_vec == hyperedges_c[hash_hyperedge_c_id]) {
-      // check the representative hyperedge_c
-      parallel_hyperedge_c_id = hash_hyperedge_c_id;
-    } else {
-      // check the parallel hyperedge_c_id
-      for (const auto& candidate_id : parallel_hash_map[hash_value]) {
-        if (hyperedge_vec == hyperedges_c[candidate_id]) {
-          parallel_hyperedge_c_id = candidate_id;
-          break;  // found the same hyperedge_c
-        }
-      }
-    }
-    // check if the hyperedge has been existed
-    if (parallel_hyperedge_c_id == -1) {
-      // not existed
-      const int hyperedge_c_id = static_cast<int>(hyperedges_c.size());
+    if (representative[e] == e) {
+      const int hyperedge_c_id = static_cast<int>(eptr_c.size()) - 1;
       hyperedge_cluster_id_vec[e] = hyperedge_c_id;
-      parallel_hash_map[hash_value].push_back(hyperedge_c_id);
-      hyperedges_c.push_back(hyperedge_vec);
-      hyperedges_weights_c.push_back(hgraph->GetHyperedgeWeights(e));
+      eind_c.insert(eind_c.end(),
+                    set_ind.begin() + set_ptr[e],
+                    set_ind.begin() + set_ptr[e + 1]);
+      eptr_c.push_back(static_cast<int>(eind_c.size()));
+      AppendRow(hyperedges_weights_c, hgraph->GetHyperedgeWeights(e));
       if (hgraph->HasTiming()) {
         hyperedge_slack_c.push_back(
             hgraph->GetHyperedgeTimingAttr(e));  // the slack of hyperedge
         hyperedge_arc_set_c.push_back(
             hgraph->GetHyperedgeArcSet(e));  // map the hyperedge to timing arcs
       }
-    } else {
-      // existed
-      hyperedges_weights_c[parallel_hyperedge_c_id]
-          = hyperedges_weights_c[parallel_hyperedge_c_id]
-            + hgraph->GetHyperedgeWeights(e);
-      hyperedge_cluster_id_vec[e] = parallel_hyperedge_c_id;
-      if (hgraph->HasTiming()) {
-        hyperedge_slack_c[parallel_hyperedge_c_id]
-            = std::min(hyperedge_slack_c[parallel_hyperedge_c_id],
-                       hgraph->GetHyperedgeTimingAttr(e));
-        hyperedge_arc_set_c[parallel_hyperedge_c_id].insert(
-            hgraph->GetHyperedgeArcSet(e).begin(),
-            hgraph->GetHyperedgeArcSet(e).end());
-      }
+      continue;
+    }
+    // merge e into its parallel hyperedge
+    // hyperedge_slack_c[e] = min_slack(hyperedge_arc_set_c[e])
+    const int parallel_hyperedge_c_id
+        = hyperedge_cluster_id_vec[representative[e]];
+    Accumulate(
+        hyperedges_weights_c.data() + parallel_hyperedge_c_id * hyperedge_dims,
+        hgraph->GetHyperedgeWeights(e));
+    hyperedge_cluster_id_vec[e] = parallel_hyperedge_c_id;
+    if (hgraph->HasTiming()) {
+      hyperedge_slack_c[parallel_hyperedge_c_id]
+          = std::min(hyperedge_slack_c[parallel_hyperedge_c_id],
+                     hgraph->GetHyperedgeTimingAttr(e));
+      hyperedge_arc_set_c[parallel_hyperedge_c_id].insert(
+          hgraph->GetHyperedgeArcSet(e).begin(),
+          hgraph->GetHyperedgeArcSet(e).end());
     }
   }
 
   // Step 2: identify all the timing paths
   std::vector<TimingPath> timing_paths_c;
-  hash_map.clear();           // used to detect parallel timing path
-  parallel_hash_map.clear();  // used to detect parallel timing path
+  std::map<size_t, int>
+      hash_map;  // used to detect parallel timing path
+  std::map<size_t, std::vector<int>>
+      parallel_hash_map;  // used to detect parallel timing path
   if (hgraph->HasTiming() && hgraph->GetNumTimingPaths() > 0) {
     for (int p = 0; p < hgraph->GetNumTimingPaths(); ++p) {
       // check vertex representation
@@ -943,9 +1074,10 @@ HGraphPtr Coarsener::Contraction(
       = std::make_shared<Hypergraph>(hgraph->GetVertexDimensions(),
                                      hgraph->GetHyperedgeDimensions(),
                                      hgraph->GetPlacementDimensions(),
-                                     hyperedges_c,
+                                     std::move(eind_c),
+                                     std::move(eptr_c),
                                      vertex_weights_c,
-                                     hyperedges_weights_c,
+                                     std::move(hyperedges_weights_c),
                                      // vertex attributes
                                      fixed_attr_c,
                                      community_attr_c,
@@ -960,10 +1092,7 @@ HGraphPtr Coarsener::Contraction(
   // fill vertex_c_attr which maps the vertex to its corresponding cluster
   // To simpify the implementation, the vertex_c_attr maps the original larger
   // hypergraph
-  clustered_hgraph->ResetVertexCAttr();
-  for (int v = 0; v < hgraph->GetNumVertices(); v++) {
-    clustered_hgraph->AddVertexCAttr(vertex_cluster_id_vec[v], v);
-  }
+  clustered_hgraph->SetVertexCAttr(vertex_cluster_id_vec);
 
   return clustered_hgraph;
 }
@@ -124,6 +124,10 @@ class Coarsener
 
   void IncreaseRandomSeed() { random_seed_++; }
 
+  // Set the number of threads used by vertex matching and contraction
+  // The clusters do not depend on the number of threads
+  void SetNumThreads(int num_threads) { num_threads_ = num_threads; }
+
  private:
   // private functions (utilities)
 
@@ -138,15 +142,32 @@ class Coarsener
   // the lazy update means that we do not change the hgraph itself,
   // but during the matching process, we do dynamically update
   // placement_attr_c. vertex_weights_c, fixed_attr_c and community_attr_c
+  // vertex_weights_c and placement_attr_c are flat row-major arrays with
+  // one row per cluster
   void VertexMatching(
       const HGraphPtr& hgraph,
       std::vector<int>&
           vertex_cluster_id_vec,  // map current vertex_id to cluster_id
       // the remaining arguments are related to clusters
-      Matrix<float>& vertex_weights_c,
+      std::vector<float>& vertex_weights_c,
+      std::vector<int>& community_attr_c,
+      std::vector<int>& fixed_attr_c,
+      std::vector<float>& placement_attr_c) const;
+
+  // match the vertices in unvisited (in visiting order), finding their
+  // best neighbors in parallel before clustering them in visiting order.
+  // cluster_id is the number of clusters that already exist
+  void ParallelVertexMatching(
+      const HGraphPtr& hgraph,
+      const std::vector<int>& unvisited,
+      int cluster_id,
+      std::vector<int>&
+          vertex_cluster_id_vec,  // map current vertex_id to cluster_id
+      // the remaining arguments are related to clusters
+      std::vector<float>& vertex_weights_c,
       std::vector<int>& community_attr_c,
       std::vector<int>& fixed_attr_c,
-      Matrix<float>& placement_attr_c) const;
+      std::vector<float>& placement_attr_c) const;
 
   // order the vertices based on user-specified parameters
   void OrderVertices(const HGraphPtr& hgraph, std::vector<int>& vertices) const;
@@ -163,10 +184,10 @@ class Coarsener
       std::vector<int>&
           vertex_cluster_id_vec,  // map current vertex_id to cluster_id
       // the remaining arguments are related to clusters
-      Matrix<float>& vertex_weights_c,
+      std::vector<float>& vertex_weights_c,
       std::vector<int>& community_attr_c,
       std::vector<int>& fixed_attr_c,
-      Matrix<float>& placement_attr_c) const;
+      std::vector<float>& placement_attr_c) const;
 
   // create the contracted hypergraph based on the vertex matching in
   // vertex_cluster_id_vec
@@ -175,10 +196,10 @@ class Coarsener
       const std::vector<int>&
           vertex_cluster_id_vec,  // map current vertex_id to cluster_id
       // the remaining arguments are related to clusters
-      const Matrix<float>& vertex_weights_c,
+      const std::vector<float>& vertex_weights_c,
       const std::vector<int>& community_attr_c,
       const std::vector<int>& fixed_attr_c,
-      const Matrix<float>& placement_attr_c) const;
+      const std::vector<float>& placement_attr_c) const;
 
   const int num_parts_ = 2;
   // coarsening related parameters (stop conditions)
@@ -210,6 +231,7 @@ class Coarsener
   std::vector<float> thr_cluster_weight_;  // the maximum weight of a cluster
   int random_seed_ = 0;
   CoarsenOrder vertex_order_choice_ = CoarsenOrder::RANDOM;
+  int num_threads_ = 1;  // the number of threads for matching and contraction
   EvaluatorPtr evaluator_ = nullptr;
   utl::Logger* logger_ = nullptr;
 };
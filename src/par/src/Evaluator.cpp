@@ -403,10 +403,10 @@ GoldenEvaluator::GetAvgPlacementLoc(int v, int u, const HGraphPtr& hgraph) const
 
 // calculate the average placement location
 std::vector<float> GoldenEvaluator::GetAvgPlacementLoc(
-    const std::vector<float>& vertex_weight_a,
-    const std::vector<float>& vertex_weight_b,
-    const std::vector<float>& placement_loc_a,
-    const std::vector<float>& placement_loc_b) const
+    const FloatSpan vertex_weight_a,
+    const FloatSpan vertex_weight_b,
+    const FloatSpan placement_loc_a,
+    const FloatSpan placement_loc_b) const
 {
   const float a_weight = std::inner_product(vertex_weight_a.begin(),
                                             vertex_weight_a.end(),
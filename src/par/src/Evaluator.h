@@ -169,11 +169,10 @@ class GoldenEvaluator
                                         const HGraphPtr& hgraph) const;
 
   // calculate the average placement location
-  std::vector<float> GetAvgPlacementLoc(
-      const std::vector<float>& vertex_weight_a,
-      const std::vector<float>& vertex_weight_b,
-      const std::vector<float>& placement_loc_a,
-      const std::vector<float>& placement_loc_b) const;
+  std::vector<float> GetAvgPlacementLoc(FloatSpan vertex_weight_a,
+                                        FloatSpan vertex_weight_b,
+                                        FloatSpan placement_loc_a,
+                                        FloatSpan placement_loc_b) const;
 
   // calculate the hyperedges being cut
   std::vector<int> GetCutHyperedges(const HGraphPtr& hgraph,
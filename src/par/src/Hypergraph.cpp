@@ -35,7 +35,9 @@
 
 #include "Hypergraph.h"
 
+#include <algorithm>
 #include <iostream>
+#include <numeric>
 #include <string>
 
 #include "Utilities.h"
@@ -43,6 +45,59 @@
 
 namespace par {
 
+// Flatten a matrix into a row-major array
+template <typename T>
+static std::vector<T> Flatten(const Matrix<T>& matrix)
+{
+  size_t size = 0;
+  for (const auto& row : matrix) {
+    size += row.size();
+  }
+  std::vector<T> flat;
+  flat.reserve(size);
+  for (const auto& row : matrix) {
+    flat.insert(flat.end(), row.begin(), row.end());
+  }
+  return flat;
+}
+
+// The row offsets of a matrix flattened by Flatten
+static std::vector<int> RowOffsets(const Matrix<int>& matrix)
+{
+  std::vector<int> ptr;
+  ptr.reserve(matrix.size() + 1);
+  ptr.push_back(0);
+  for (const auto& row : matrix) {
+    ptr.push_back(ptr.back() + static_cast<int>(row.size()));
+  }
+  return ptr;
+}
+
+// Transpose a CSR incidence of num_cols columns with a counting pass, so
+// that each row of the result lists its entries in increasing order.
+static void Transpose(const std::vector<int>& ind,
+                      const std::vector<int>& ptr,
+                      const int num_cols,
+                      std::vector<int>& ind_t,
+                      std::vector<int>& ptr_t)
+{
+  ptr_t.assign(num_cols + 1, 0);
+  for (const int col : ind) {
+    ptr_t[col + 1]++;
+  }
+  for (int col = 0; col < num_cols; col++) {
+    ptr_t[col + 1] += ptr_t[col];
+  }
+  ind_t.resize(ind.size());
+  std::vector<int> next(ptr_t.begin(), ptr_t.end() - 1);
+  const int num_rows = static_cast<int>(ptr.size()) - 1;
+  for (int row = 0; row < num_rows; row++) {
+    for (int i = ptr[row]; i < ptr[row + 1]; i++) {
+      ind_t[next[ind[i]]++] = row;
+    }
+  }
+}
+
 Hypergraph::Hypergraph(
     const int vertex_dimensions,
     const int hyperedge_dimensions,
@@ -57,59 +112,20 @@ Hypergraph::Hypergraph(
     // placement information
     const std::vector<std::vector<float>>& placement_attr,
     utl::Logger* logger)
-    : num_vertices_(static_cast<int>(vertex_weights.size())),
-      num_hyperedges_(static_cast<int>(hyperedge_weights.size())),
-      vertex_dimensions_(vertex_dimensions),
-      hyperedge_dimensions_(hyperedge_dimensions),
-      vertex_weights_(vertex_weights),
-      hyperedge_weights_(hyperedge_weights)
+    : Hypergraph(vertex_dimensions,
+                 hyperedge_dimensions,
+                 placement_dimensions,
+                 Flatten(hyperedges),
+                 RowOffsets(hyperedges),
+                 Flatten(vertex_weights),
+                 Flatten(hyperedge_weights),
+                 fixed_attr,
+                 community_attr,
+                 placement_attr.size() == vertex_weights.size()
+                     ? Flatten(placement_attr)
+                     : std::vector<float>(),
+                 logger)
 {
-  // add hyperedge
-  // hyperedges: each hyperedge is a set of vertices
-  eptr_.push_back(0);
-  for (const auto& hyperedge : hyperedges) {
-    eind_.insert(eind_.end(), hyperedge.begin(), hyperedge.end());
-    eptr_.push_back(static_cast<int>(eind_.size()));
-  }
-
-  // add vertex
-  // create vertices from hyperedges
-  std::vector<std::vector<int>> vertices(num_vertices_);
-  for (int e = 0; e < num_hyperedges_; e++) {
-    for (auto v : hyperedges[e]) {
-      vertices[v].push_back(e);  // e is the hyperedge id
-    }
-  }
-
-  vptr_.push_back(0);
-  for (const auto& vertex : vertices) {
-    vind_.insert(vind_.end(), vertex.begin(), vertex.end());
-    vptr_.push_back(static_cast<int>(vind_.size()));
-  }
-
-  // fixed vertices
-  fixed_vertex_flag_ = (fixed_attr.size() == num_vertices_);
-  if (fixed_vertex_flag_) {
-    fixed_attr_ = fixed_attr;
-  }
-
-  // community information
-  community_flag_ = (community_attr.size() == num_vertices_);
-  if (community_flag_) {
-    community_attr_ = community_attr;
-  }
-
-  // placement information
-  placement_flag_
-      = (placement_dimensions > 0 && placement_attr.size() == num_vertices_);
-  if (placement_flag_) {
-    placement_dimensions_ = placement_dimensions;
-    placement_attr_ = placement_attr;
-  } else {
-    placement_dimensions_ = 0;
-  }
-
-  logger_ = logger;
 }
 
 Hypergraph::Hypergraph(
@@ -144,6 +160,96 @@ Hypergraph::Hypergraph(
                  community_attr,
                  placement_attr,
                  logger)
+{
+  InitTiming(vertex_types, hyperedges_slack, hyperedges_arc_set, timing_paths);
+}
+
+Hypergraph::Hypergraph(const int vertex_dimensions,
+                       const int hyperedge_dimensions,
+                       const int placement_dimensions,
+                       std::vector<int> eind,
+                       std::vector<int> eptr,
+                       std::vector<float> vertex_weights,
+                       std::vector<float> hyperedge_weights,
+                       std::vector<int> fixed_attr,
+                       std::vector<int> community_attr,
+                       std::vector<float> placement_attr,
+                       utl::Logger* logger)
+    : num_vertices_(static_cast<int>(vertex_weights.size())
+                    / std::max(vertex_dimensions, 1)),
+      num_hyperedges_(static_cast<int>(eptr.size()) - 1),
+      vertex_dimensions_(vertex_dimensions),
+      hyperedge_dimensions_(hyperedge_dimensions),
+      vertex_weights_(std::move(vertex_weights)),
+      hyperedge_weights_(std::move(hyperedge_weights)),
+      eind_(std::move(eind)),
+      eptr_(std::move(eptr))
+{
+  // vertices: each vertex is a set of hyperedges
+  Transpose(eind_, eptr_, num_vertices_, vind_, vptr_);
+
+  // fixed vertices
+  fixed_vertex_flag_ = (fixed_attr.size() == num_vertices_);
+  if (fixed_vertex_flag_) {
+    fixed_attr_ = std::move(fixed_attr);
+  }
+
+  // community information
+  community_flag_ = (community_attr.size() == num_vertices_);
+  if (community_flag_) {
+    community_attr_ = std::move(community_attr);
+  }
+
+  // placement information
+  placement_flag_ = (placement_dimensions > 0
+                     && placement_attr.size()
+                            == static_cast<size_t>(num_vertices_)
+                                   * placement_dimensions);
+  if (placement_flag_) {
+    placement_dimensions_ = placement_dimensions;
+    placement_attr_ = std::move(placement_attr);
+  } else {
+    placement_dimensions_ = 0;
+  }
+
+  logger_ = logger;
+}
+
+Hypergraph::Hypergraph(const int vertex_dimensions,
+                       const int hyperedge_dimensions,
+                       const int placement_dimensions,
+                       std::vector<int> eind,
+                       std::vector<int> eptr,
+                       std::vector<float> vertex_weights,
+                       std::vector<float> hyperedge_weights,
+                       std::vector<int> fixed_attr,
+                       std::vector<int> community_attr,
+                       std::vector<float> placement_attr,
+                       const std::vector<VertexType>& vertex_types,
+                       const std::vector<float>& hyperedges_slack,
+                       const std::vector<std::set<int>>& hyperedges_arc_set,
+                       const std::vector<TimingPath>& timing_paths,
+                       utl::Logger* logger)
+    : Hypergraph(vertex_dimensions,
+                 hyperedge_dimensions,
+                 placement_dimensions,
+                 std::move(eind),
+                 std::move(eptr),
+                 std::move(vertex_weights),
+                 std::move(hyperedge_weights),
+                 std::move(fixed_attr),
+                 std::move(community_attr),
+                 std::move(placement_attr),
+                 logger)
+{
+  InitTiming(vertex_types, hyperedges_slack, hyperedges_arc_set, timing_paths);
+}
+
+void Hypergraph::InitTiming(
+    const std::vector<VertexType>& vertex_types,
+    const std::vector<float>& hyperedges_slack,
+    const std::vector<std::set<int>>& hyperedges_arc_set,
+    const std::vector<TimingPath>& timing_paths)
 {
   // add vertex types
   vertex_types_ = vertex_types;
@@ -155,8 +261,6 @@ Hypergraph::Hypergraph(
     num_timing_paths_ = static_cast<int>(timing_paths.size());
     hyperedge_timing_attr_ = hyperedges_slack;
     hyperedge_arc_set_ = hyperedges_arc_set;
-    // create the vertex Matrix which stores the paths incident to vertex
-    std::vector<std::vector<int>> incident_paths(num_vertices_);
     vptr_p_.push_back(0);
     eptr_p_.push_back(0);
     for (int path_id = 0; path_id < num_timing_paths_; path_id++) {
@@ -164,9 +268,6 @@ Hypergraph::Hypergraph(
       const auto& timing_path = timing_paths[path_id].path;
       vind_p_.insert(vind_p_.end(), timing_path.begin(), timing_path.end());
       vptr_p_.push_back(static_cast<int>(vind_p_.size()));
-      for (const int v : timing_path) {
-        incident_paths[v].push_back(path_id);
-      }
       // view each path as a sequence of hyperedge
       const auto& timing_arc = timing_paths[path_id].arcs;
       eind_p_.insert(eind_p_.end(), timing_arc.begin(), timing_arc.end());
@@ -174,19 +275,16 @@ Hypergraph::Hypergraph(
       // add the timing attribute
       path_timing_attr_.push_back(timing_paths[path_id].slack);
     }
-    pptr_v_.push_back(0);
-    for (auto& paths : incident_paths) {
-      pind_v_.insert(pind_v_.end(), paths.begin(), paths.end());
-      pptr_v_.push_back(static_cast<int>(pind_v_.size()));
-    }
+    // the paths incident to each vertex
+    Transpose(vind_p_, vptr_p_, num_vertices_, pind_v_, pptr_v_);
   }
 }
 
 std::vector<float> Hypergraph::GetTotalVertexWeights() const
 {
   std::vector<float> total_weight(vertex_dimensions_, 0.0);
-  for (auto& weight : vertex_weights_) {
-    total_weight = total_weight + weight;
+  for (int v = 0; v < num_vertices_; v++) {
+    Accumulate(total_weight, GetVertexWeights(v));
   }
   return total_weight;
 }
@@ -230,10 +328,30 @@ std::vector<std::vector<float>> Hypergraph::GetLowerVertexBalance(
   return lower_block_balance;
 }
 
-void Hypergraph::ResetVertexCAttr()
+void Hypergraph::SetVertexCAttr(const std::vector<int>& vertex_cluster_id)
+{
+  std::vector<int> cluster_ptr(vertex_cluster_id.size() + 1);
+  std::iota(cluster_ptr.begin(), cluster_ptr.end(), 0);
+  Transpose(vertex_cluster_id,
+            cluster_ptr,
+            num_vertices_,
+            vertex_c_attr_,
+            vertex_c_attr_ptr_);
+}
+
+template <typename T>
+static size_t VectorBytes(const std::vector<T>& vec)
+{
+  return vec.capacity() * sizeof(T);
+}
+
+size_t Hypergraph::GetMemoryBytes() const
 {
-  vertex_c_attr_.clear();
-  vertex_c_attr_.resize(GetNumVertices());
+  return VectorBytes(eind_) + VectorBytes(eptr_) + VectorBytes(vind_)
+         + VectorBytes(vptr_) + VectorBytes(vertex_weights_)
+         + VectorBytes(hyperedge_weights_) + VectorBytes(placement_attr_)
+         + VectorBytes(fixed_attr_) + VectorBytes(community_attr_)
+         + VectorBytes(vertex_c_attr_) + VectorBytes(vertex_c_attr_ptr_);
 }
 
 void Hypergraph::ResetHyperedgeTimingAttr()
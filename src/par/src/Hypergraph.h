@@ -41,6 +41,10 @@
 //         cluster_id (c), vertex_id (v), hyperedge_id (e)
 //         are all in int type.
 // Rule2 : Each hyperedge can include a vertex at most once.
+// Rule3 : Hyperedges and incidence lists are stored in compressed sparse
+//         row form (ind / ptr arrays).  Vertex weights, hyperedge weights
+//         and placement are flat row-major arrays with one row of
+//         dimensions values per vertex or hyperedge.
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include <boost/range/iterator_range.hpp>
@@ -125,6 +129,38 @@ class Hypergraph
       const std::vector<TimingPath>& timing_paths,
       utl::Logger* logger);
 
+  // Compressed sparse row construction. Hyperedge e holds the vertices
+  // eind[eptr[e]] .. eind[eptr[e + 1] - 1]. The weights and placement are
+  // flat row-major arrays. The arrays are moved in, so no per-vertex or
+  // per-hyperedge storage is allocated.
+  Hypergraph(int vertex_dimensions,
+             int hyperedge_dimensions,
+             int placement_dimensions,
+             std::vector<int> eind,
+             std::vector<int> eptr,
+             std::vector<float> vertex_weights,
+             std::vector<float> hyperedge_weights,
+             std::vector<int> fixed_attr,
+             std::vector<int> community_attr,
+             std::vector<float> placement_attr,
+             utl::Logger* logger);
+
+  Hypergraph(int vertex_dimensions,
+             int hyperedge_dimensions,
+             int placement_dimensions,
+             std::vector<int> eind,
+             std::vector<int> eptr,
+             std::vector<float> vertex_weights,
+             std::vector<float> hyperedge_weights,
+             std::vector<int> fixed_attr,
+             std::vector<int> community_attr,
+             std::vector<float> placement_attr,
+             const std::vector<VertexType>& vertex_types,
+             const std::vector<float>& hyperedges_slack,
+             const std::vector<std::set<int>>& hyperedges_arc_set,
+             const std::vector<TimingPath>& timing_paths,
+             utl::Logger* logger);
+
   int GetNumVertices() const { return num_vertices_; }
   int GetNumHyperedges() const { return num_hyperedges_; }
   int GetNumTimingPaths() const { return num_timing_paths_; }
@@ -134,15 +170,18 @@ class Hypergraph
 
   std::vector<float> GetTotalVertexWeights() const;
 
-  const std::vector<float>& GetVertexWeights(const int vertex_id) const
+  FloatSpan GetVertexWeights(const int vertex_id) const
   {
-    return vertex_weights_[vertex_id];
+    return {vertex_weights_.data() + vertex_id * vertex_dimensions_,
+            vertex_dimensions_};
   }
-  const Matrix<float>& GetVertexWeights() const { return vertex_weights_; }
+  // Flat row-major array of all the vertex weights
+  const std::vector<float>& GetVertexWeights() const { return vertex_weights_; }
 
-  const std::vector<float>& GetHyperedgeWeights(const int edge_id) const
+  FloatSpan GetHyperedgeWeights(const int edge_id) const
   {
-    return hyperedge_weights_[edge_id];
+    return {hyperedge_weights_.data() + edge_id * hyperedge_dimensions_,
+            hyperedge_dimensions_};
   }
 
   float GetHyperedgeTimingAttr(const int edge_id) const
@@ -182,16 +221,17 @@ class Hypergraph
     hyperedge_timing_cost_ = costs;
   }
 
-  void ResetVertexCAttr();
-
-  void AddVertexCAttr(int vertex_id, int v)
-  {
-    vertex_c_attr_[vertex_id].push_back(v);
-  }
+  // Fill vertex_c_attr from the cluster id of each vertex of the
+  // finer hypergraph
+  void SetVertexCAttr(const std::vector<int>& vertex_cluster_id);
 
-  const std::vector<int>& GetVertexCAttr(int vertex_id) const
+  // Returns the vertices of the finer hypergraph in the given cluster
+  auto GetVertexCAttr(int vertex_id) const
   {
-    return vertex_c_attr_[vertex_id];
+    auto begin_iter = vertex_c_attr_.cbegin();
+    return boost::make_iterator_range(
+        begin_iter + vertex_c_attr_ptr_[vertex_id],
+        begin_iter + vertex_c_attr_ptr_[vertex_id + 1]);
   }
 
   const std::set<int>& GetHyperedgeArcSet(const int edge_id) const
@@ -231,12 +271,13 @@ class Hypergraph
 
   bool HasTiming() const { return timing_flag_; }
 
-  const std::vector<float>& GetPlacement(const int vertex_id) const
+  FloatSpan GetPlacement(const int vertex_id) const
   {
-    return placement_attr_[vertex_id];
+    return {placement_attr_.data() + vertex_id * placement_dimensions_,
+            placement_dimensions_};
   }
 
-  void CopyPlacement(Matrix<float>& attr) const { attr = placement_attr_; }
+  void CopyPlacement(std::vector<float>& attr) const { attr = placement_attr_; }
   float PathTimingCost(const int path_id) const
   {
     return path_timing_cost_[path_id];
@@ -316,15 +357,26 @@ class Hypergraph
       float ub_factor,
       std::vector<float> base_balance) const;
 
+  // Bytes held by the hypergraph arrays
+  size_t GetMemoryBytes() const;
+
  private:
+  // Builds the CSR timing path arrays
+  void InitTiming(const std::vector<VertexType>& vertex_types,
+                  const std::vector<float>& hyperedges_slack,
+                  const std::vector<std::set<int>>& hyperedges_arc_set,
+                  const std::vector<TimingPath>& timing_paths);
+
   // basic hypergraph
   const int num_vertices_ = 0;
   const int num_hyperedges_ = 0;
   const int vertex_dimensions_ = 1;
   const int hyperedge_dimensions_ = 1;
 
-  const Matrix<float> vertex_weights_;
-  const Matrix<float> hyperedge_weights_;  // weights can be negative
+  // num_vertices_ x vertex_dimensions_
+  const std::vector<float> vertex_weights_;
+  // num_hyperedges_ x hyperedge_dimensions_, weights can be negative
+  const std::vector<float> hyperedge_weights_;
 
   // slack for hyperedge
   std::vector<float> hyperedge_timing_attr_;
@@ -348,7 +400,8 @@ class Hypergraph
   // To simpify the implementation, the vertex_c_attr maps the original larger
   // hypergraph vertex_c_attr has hgraph->num_vertices_ elements. This is used
   // during coarsening phase similar to hyperedge_arc_set_
-  std::vector<std::vector<int>> vertex_c_attr_;
+  std::vector<int> vertex_c_attr_;
+  std::vector<int> vertex_c_attr_ptr_;
 
   // fixed vertices.  If fixed_vertex_flag_ = false, fixed_attr_ is empty
   bool fixed_vertex_flag_ = false;  // If there are fixed vertices
@@ -370,8 +423,8 @@ class Hypergraph
   // If placement_flag = false, placement_attr_ is empty
   bool placement_flag_ = false;
   int placement_dimensions_ = 0;
-  // the embedding for vertices
-  std::vector<std::vector<float>> placement_attr_;
+  // the embedding for vertices, num_vertices_ x placement_dimensions_
+  std::vector<float> placement_attr_;
 
   // Timing information
   bool timing_flag_ = false;
@@ -79,7 +79,8 @@ float IlpRefine::Pass(
   for (const auto& v : boundary_vertices) {
     vertices_extracted.push_back(v);
     vertices_extracted_map[v] = vertex_id++;
-    vertices_weight_extracted.push_back(hgraph->GetVertexWeights(v));
+    vertices_weight_extracted.push_back(
+        hgraph->GetVertexWeights(v).ToVector());
     const int block_id = solution[v];
     block_balance[block_id]
         = block_balance[block_id] - hgraph->GetVertexWeights(v);
@@ -151,6 +151,7 @@ void PartitionMgr::tritonPartHypergraph(
   // Thus users can use this function to partition the input hypergraph
   auto triton_part
       = std::make_unique<TritonPart>(db_network_, db_, sta_, logger_);
+  triton_part->SetNumThreads(num_threads_);
   // Convert the string e_wt_factors_str to vector
   triton_part->SetNetWeight(e_wt_factors);
   triton_part->SetVertexWeight(v_wt_factors);
@@ -292,6 +293,7 @@ void PartitionMgr::tritonPartDesign(
 {
   auto triton_part
       = std::make_unique<TritonPart>(db_network_, db_, sta_, logger_);
+  triton_part->SetNumThreads(num_threads_);
   // Convert the string e_wt_factors_str to vector
   triton_part->SetNetWeight(e_wt_factors);
   triton_part->SetVertexWeight(v_wt_factors);
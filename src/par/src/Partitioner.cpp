@@ -227,7 +227,7 @@ void Partitioner::ILPPart(const HGraphPtr& hgraph,
   std::vector<float> hyperedge_weights;  // one-dimensional
   // set vertices
   for (int v = 0; v < hgraph->GetNumVertices(); v++) {
-    vertex_weights.push_back(hgraph->GetVertexWeights(v));
+    vertex_weights.push_back(hgraph->GetVertexWeights(v).ToVector());
   }
   // check fixed vertices
   if (hgraph->HasFixedVertices()) {
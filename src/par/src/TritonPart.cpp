@@ -944,33 +944,34 @@ std::vector<int> TritonPart::PartitionKWaySimpleMode(
   placement_flag_ = false;
   placement_dimensions_ = 0;
   fence_flag_ = false;
-  hyperedges_ = hyperedges;
+  eind_.clear();
+  eptr_.assign(1, 0);
+  for (const auto& hyperedge : hyperedges) {
+    eind_.insert(eind_.end(), hyperedge.begin(), hyperedge.end());
+    eptr_.push_back(static_cast<int>(eind_.size()));
+  }
   fixed_attr_.clear();
   community_attr_.clear();
   group_attr_.clear();
+  placement_attr_.clear();
 
-  // convert vertex and hyperedge weights
-  for (const auto& weight : vertex_weights) {
-    std::vector<float> v_wt{weight};
-    vertex_weights_.push_back(v_wt);
-  }
-
-  for (const auto& weight : hyperedge_weights) {
-    std::vector<float> e_wt{weight};
-    hyperedge_weights_.push_back(e_wt);
-  }
+  // both weights have a single dimension, so they are already flat
+  vertex_weights_ = vertex_weights;
+  hyperedge_weights_ = hyperedge_weights;
 
   // Build the original hypergraph first
-  original_hypergraph_ = std::make_shared<Hypergraph>(vertex_dimensions_,
-                                                      hyperedge_dimensions_,
-                                                      placement_dimensions_,
-                                                      hyperedges_,
-                                                      vertex_weights_,
-                                                      hyperedge_weights_,
-                                                      fixed_attr_,
-                                                      community_attr_,
-                                                      placement_attr_,
-                                                      logger_);
+  original_hypergraph_
+      = std::make_shared<Hypergraph>(vertex_dimensions_,
+                                     hyperedge_dimensions_,
+                                     placement_dimensions_,
+                                     std::move(eind_),
+                                     std::move(eptr_),
+                                     std::move(vertex_weights_),
+                                     std::move(hyperedge_weights_),
+                                     fixed_attr_,
+                                     community_attr_,
+                                     std::move(placement_attr_),
+                                     logger_);
 
   // call the multilevel partitioner to partition hypergraph_
   // but the evaluation is the original_hypergraph_
@@ -1017,43 +1018,40 @@ void TritonPart::ReadHypergraph(const std::string& hypergraph_file,
   }
 
   // clear the related vectors
-  hyperedges_.clear();
+  eind_.clear();
+  eptr_.clear();
   hyperedge_weights_.clear();
   vertex_weights_.clear();
-  hyperedges_.reserve(num_hyperedges_);
-  hyperedge_weights_.reserve(num_hyperedges_);
-  vertex_weights_.reserve(num_vertices_);
+  eptr_.reserve(num_hyperedges_ + 1);
+  eptr_.push_back(0);
+  hyperedge_weights_.reserve(static_cast<size_t>(num_hyperedges_)
+                             * hyperedge_dimensions_);
+  vertex_weights_.reserve(static_cast<size_t>(num_vertices_)
+                          * vertex_dimensions_);
 
   // Read hyperedge information
   for (int i = 0; i < num_hyperedges_; i++) {
     std::getline(hypergraph_file_input, cur_line);
+    std::istringstream cur_line_buf(cur_line);
     if (hyperedge_weight_flag == true) {
-      std::istringstream cur_line_buf(cur_line);
-      std::vector<float> hvec{std::istream_iterator<float>(cur_line_buf),
-                              std::istream_iterator<float>()};
-      std::vector<float>::iterator breakpoint{hvec.begin()
-                                              + hyperedge_dimensions_};
       // read first hyperedge_dimensions_ elements as hyperege weights
-      std::vector<float> hwts(hvec.begin(), breakpoint);
-      // read remaining elements as hyperedge
-      std::vector<int> hyperedge(breakpoint, hvec.end());
-      for (auto& value : hyperedge) {
-        value--;  // the vertex id starts from 1 in the hypergraph file
+      for (int j = 0; j < hyperedge_dimensions_; j++) {
+        float hwt = 0.0;
+        cur_line_buf >> hwt;
+        hyperedge_weights_.push_back(hwt);
       }
-      hyperedge_weights_.push_back(hwts);
-      hyperedges_.push_back(hyperedge);
     } else {
-      std::istringstream cur_line_buf(cur_line);
-      std::vector<int> hyperedge{std::istream_iterator<int>(cur_line_buf),
-                                 std::istream_iterator<int>()};
-      for (auto& value : hyperedge) {
-        value--;  // the vertex id starts from 1 in the hypergraph file
-      }
-      std::vector<float> hwts(hyperedge_dimensions_,
-                              1.0);  // each dimension has the same weight
-      hyperedge_weights_.push_back(hwts);
-      hyperedges_.push_back(hyperedge);
+      // each dimension has the same weight
+      hyperedge_weights_.insert(
+          hyperedge_weights_.end(), hyperedge_dimensions_, 1.0);
+    }
+    // read remaining elements as hyperedge
+    int vertex = 0;
+    while (cur_line_buf >> vertex) {
+      eind_.push_back(vertex - 1);  // the vertex id starts from 1 in the
+                                    // hypergraph file
     }
+    eptr_.push_back(static_cast<int>(eind_.size()));
   }
 
   // Read weight for vertices
@@ -1061,12 +1059,11 @@ void TritonPart::ReadHypergraph(const std::string& hypergraph_file,
     if (vertex_weight_flag == true) {
       std::getline(hypergraph_file_input, cur_line);
       std::istringstream cur_line_buf(cur_line);
-      std::vector<float> vwts{std::istream_iterator<float>(cur_line_buf),
-                              std::istream_iterator<float>()};
-      vertex_weights_.push_back(vwts);
+      vertex_weights_.insert(vertex_weights_.end(),
+                             std::istream_iterator<float>(cur_line_buf),
+                             std::istream_iterator<float>());
     } else {
-      std::vector<float> vwts(vertex_dimensions_, 1.0);
-      vertex_weights_.push_back(vwts);
+      vertex_weights_.insert(vertex_weights_.end(), vertex_dimensions_, 1.0);
     }
   }
 
@@ -1152,7 +1149,8 @@ void TritonPart::ReadHypergraph(const std::string& hypergraph_file,
                   // larger than invalid_placement_thr, we think the placement
                   // is invalid
     const float default_placement_value = 0.0;  // default placement value
-    std::vector<std::vector<float>> temp_placement_attr;
+    int num_placement_rows = 0;
+    placement_attr_.clear();
     while (std::getline(placement_file_input, cur_line)) {
       std::vector<std::string> elements = SplitLine(
           cur_line);  // split the line based on deliminator empty space, ','
@@ -1169,7 +1167,12 @@ void TritonPart::ReadHypergraph(const std::string& hypergraph_file,
           }
         }
       }
-      temp_placement_attr.push_back(vertex_placement);
+      // keep placement_dimensions_ values for each vertex
+      vertex_placement.resize(placement_dimensions_, default_placement_value);
+      placement_attr_.insert(placement_attr_.end(),
+                             vertex_placement.begin(),
+                             vertex_placement.end());
+      num_placement_rows++;
     }
     placement_file_input.close();
     // Here comes the very important part for placement-driven clustering
@@ -1178,20 +1181,25 @@ void TritonPart::ReadHypergraph(const std::string& hypergraph_file,
     // placement embedding based on average distance again Here we randomly
     // sample num_vertices of pairs to compute the average norm
     std::vector<float> mean_placement_value_list(placement_dimensions_, 0.0f);
-    for (auto& attr : temp_placement_attr) {
+    for (int i = 0; i < num_placement_rows; i++) {
       for (int j = 0; j < placement_dimensions_; j++) {
-        mean_placement_value_list[j] += attr[j];
+        mean_placement_value_list[j]
+            += placement_attr_[i * placement_dimensions_ + j];
       }
     }
-    mean_placement_value_list = DivideFactor(mean_placement_value_list,
-                                             temp_placement_attr.size() * 1.0);
+    mean_placement_value_list
+        = DivideFactor(mean_placement_value_list, num_placement_rows * 1.0);
     // perform normalization
-    for (auto& emb : temp_placement_attr) {
-      placement_attr_.push_back(
-          DivideVectorElebyEle(emb, mean_placement_value_list));
+    for (int i = 0; i < num_placement_rows; i++) {
+      for (int j = 0; j < placement_dimensions_; j++) {
+        if (mean_placement_value_list[j] != 0.0) {
+          placement_attr_[i * placement_dimensions_ + j]
+              /= mean_placement_value_list[j];
+        }
+      }
     }
 
-    if (static_cast<int>(placement_attr_.size()) != num_vertices_) {
+    if (num_placement_rows != num_vertices_) {
       debugPrint(logger_,
                  PAR,
                  "hypergraph",
@@ -1202,16 +1210,18 @@ void TritonPart::ReadHypergraph(const std::string& hypergraph_file,
   }
 
   // Build the original hypergraph first
-  original_hypergraph_ = std::make_shared<Hypergraph>(vertex_dimensions_,
-                                                      hyperedge_dimensions_,
-                                                      placement_dimensions_,
-                                                      hyperedges_,
-                                                      vertex_weights_,
-                                                      hyperedge_weights_,
-                                                      fixed_attr_,
-                                                      community_attr_,
-                                                      placement_attr_,
-                                                      logger_);
+  original_hypergraph_
+      = std::make_shared<Hypergraph>(vertex_dimensions_,
+                                     hyperedge_dimensions_,
+                                     placement_dimensions_,
+                                     std::move(eind_),
+                                     std::move(eptr_),
+                                     std::move(vertex_weights_),
+                                     std::move(hyperedge_weights_),
+                                     fixed_attr_,
+                                     community_attr_,
+                                     std::move(placement_attr_),
+                                     logger_);
 
   logger_->info(PAR,
                 17,
@@ -1249,15 +1259,14 @@ void TritonPart::ReadNetlist(const std::string& fixed_file,
       if (box.xMin() >= fence_.lx && box.xMax() <= fence_.ux
           && box.yMin() >= fence_.ly && box.yMax() <= fence_.uy) {
         odb::dbIntProperty::create(term, "vertex_id", vertex_id++);
-        std::vector<float> vwts(vertex_dimensions_,
-                                0.0);  // IO port has no area
-        vertex_weights_.emplace_back(vwts);
+        vertex_weights_.insert(vertex_weights_.end(),
+                               vertex_dimensions_,
+                               0.0);  // IO port has no area
         vertex_types_.emplace_back(PORT);
         odb::dbIntProperty::find(term, "vertex_id")->setValue(vertex_id++);
         if (placement_flag_ == true) {
-          std::vector<float> loc{(box.xMin() + box.xMax()) / 2.0f,
-                                 (box.yMin() + box.yMax()) / 2.0f};
-          placement_attr_.emplace_back(loc);
+          placement_attr_.push_back((box.xMin() + box.xMax()) / 2.0f);
+          placement_attr_.push_back((box.yMin() + box.yMax()) / 2.0f);
         }
       }
     }
@@ -1279,8 +1288,8 @@ void TritonPart::ReadNetlist(const std::string& fixed_file,
       if (box->xMin() >= fence_.lx && box->xMax() <= fence_.ux
           && box->yMin() >= fence_.ly && box->yMax() <= fence_.uy) {
         const float area = computeMicronArea(inst);
-        std::vector<float> vwts(vertex_dimensions_, area);
-        vertex_weights_.emplace_back(vwts);
+        vertex_weights_.insert(
+            vertex_weights_.end(), vertex_dimensions_, area);
         if (master->isBlock()) {
           vertex_types_.emplace_back(MACRO);
         } else if (liberty_cell->hasSequentials()) {
@@ -1289,9 +1298,8 @@ void TritonPart::ReadNetlist(const std::string& fixed_file,
           vertex_types_.emplace_back(COMB_STD_CELL);
         }
         if (placement_flag_ == true) {
-          std::vector<float> loc{(box->xMin() + box->xMax()) / 2.0f,
-                                 (box->yMin() + box->yMax()) / 2.0f};
-          placement_attr_.emplace_back(loc);
+          placement_attr_.push_back((box->xMin() + box->xMax()) / 2.0f);
+          placement_attr_.push_back((box->yMin() + box->yMax()) / 2.0f);
         }
         odb::dbIntProperty::find(inst, "vertex_id")->setValue(vertex_id++);
       }
@@ -1300,13 +1308,11 @@ void TritonPart::ReadNetlist(const std::string& fixed_file,
     for (auto term : block_->getBTerms()) {
       odb::dbIntProperty::create(term, "vertex_id", vertex_id++);
       vertex_types_.emplace_back(PORT);
-      std::vector<float> vwts(vertex_dimensions_, 0.0);
-      vertex_weights_.push_back(vwts);
+      vertex_weights_.insert(vertex_weights_.end(), vertex_dimensions_, 0.0);
       if (placement_flag_ == true) {
         odb::Rect box = term->getBBox();
-        std::vector<float> loc{(box.xMin() + box.xMax()) / 2.0f,
-                               (box.yMin() + box.yMax()) / 2.0f};
-        placement_attr_.emplace_back(loc);
+        placement_attr_.push_back((box.xMin() + box.xMax()) / 2.0f);
+        placement_attr_.push_back((box.yMin() + box.yMax()) / 2.0f);
       }
     }
 
@@ -1323,8 +1329,7 @@ void TritonPart::ReadNetlist(const std::string& fixed_file,
         continue;
       }
       const float area = computeMicronArea(inst);
-      std::vector<float> vwts(vertex_dimensions_, area);
-      vertex_weights_.emplace_back(vwts);
+      vertex_weights_.insert(vertex_weights_.end(), vertex_dimensions_, area);
       if (master->isBlock()) {
         vertex_types_.emplace_back(MACRO);
       } else if (liberty_cell->hasSequentials()) {
@@ -1335,9 +1340,8 @@ void TritonPart::ReadNetlist(const std::string& fixed_file,
       odb::dbIntProperty::find(inst, "vertex_id")->setValue(vertex_id++);
       if (placement_flag_ == true) {
         odb::dbBox* box = inst->getBBox();
-        std::vector<float> loc{(box->xMin() + box->xMax()) / 2.0f,
-                               (box->yMin() + box->yMax()) / 2.0f};
-        placement_attr_.emplace_back(loc);
+        placement_attr_.push_back((box->xMin() + box->xMax()) / 2.0f);
+        placement_attr_.push_back((box->yMin() + box->yMax()) / 2.0f);
       }
     }
   }
@@ -1429,7 +1433,8 @@ void TritonPart::ReadNetlist(const std::string& fixed_file,
   // Check all the hyperedges,
   // we do not check the parallel hyperedges
   // because we need to consider timing graph
-  hyperedges_.clear();
+  eind_.clear();
+  eptr_.assign(1, 0);
   hyperedge_weights_.clear();
   // Each net correponds to an hyperedge
   // Traverse the hyperedge and assign hyperedge_id to each net
@@ -1484,12 +1489,14 @@ void TritonPart::ReadNetlist(const std::string& fixed_file,
     // Ignore all the single-vertex hyperedge and large global netthreshold
     // if (hyperedge.size() > 1 && hyperedge.size() <= global_net_threshold_) {
     if (hyperedge.size() > 1) {
-      hyperedges_.push_back(hyperedge);
-      hyperedge_weights_.emplace_back(hyperedge_dimensions_, 1.0);
+      eind_.insert(eind_.end(), hyperedge.begin(), hyperedge.end());
+      eptr_.push_back(static_cast<int>(eind_.size()));
+      hyperedge_weights_.insert(
+          hyperedge_weights_.end(), hyperedge_dimensions_, 1.0);
       odb::dbIntProperty::find(net, "hyperedge_id")->setValue(hyperedge_id++);
     }
   }  // finish hyperedge
-  num_hyperedges_ = static_cast<int>(hyperedges_.size());
+  num_hyperedges_ = static_cast<int>(eptr_.size()) - 1;
 
   // add timing features
   if (timing_aware_flag_ == true) {
@@ -1509,20 +1516,22 @@ void TritonPart::ReadNetlist(const std::string& fixed_file,
     hyperedges_arc_set.push_back(arc_set);
   }
 
-  original_hypergraph_ = std::make_shared<Hypergraph>(vertex_dimensions_,
-                                                      hyperedge_dimensions_,
-                                                      placement_dimensions_,
-                                                      hyperedges_,
-                                                      vertex_weights_,
-                                                      hyperedge_weights_,
-                                                      fixed_attr_,
-                                                      community_attr_,
-                                                      placement_attr_,
-                                                      vertex_types_,
-                                                      hyperedge_slacks_,
-                                                      hyperedges_arc_set,
-                                                      timing_paths_,
-                                                      logger_);
+  original_hypergraph_
+      = std::make_shared<Hypergraph>(vertex_dimensions_,
+                                     hyperedge_dimensions_,
+                                     placement_dimensions_,
+                                     std::move(eind_),
+                                     std::move(eptr_),
+                                     std::move(vertex_weights_),
+                                     std::move(hyperedge_weights_),
+                                     fixed_attr_,
+                                     community_attr_,
+                                     std::move(placement_attr_),
+                                     vertex_types_,
+                                     hyperedge_slacks_,
+                                     hyperedges_arc_set,
+                                     timing_paths_,
+                                     logger_);
 
   logger_->info(
       PAR,
@@ -1915,6 +1924,7 @@ void TritonPart::MultiLevelPartition()
                                     coarsen_order_,
                                     tritonpart_evaluator,
                                     logger_);
+  tritonpart_coarsener->SetNumThreads(num_threads_);
 
   // create the initial partitioning class
   auto tritonpart_partitioner = std::make_shared<Partitioner>(
@@ -211,6 +211,9 @@ class TritonPart
     placement_wt_factors_ = placement_wt_factors;
   }
 
+  // The number of threads used by coarsening
+  void SetNumThreads(int num_threads) { num_threads_ = num_threads; }
+
   // Set detailed parameters
   // There parameters only used by users who want to exploit the performance
   // limits of TritonPart
@@ -284,13 +287,16 @@ class TritonPart
   // random seed
   int seed_ = 0;
 
+  int num_threads_ = 1;  // the number of threads used by coarsening
+
   // ---- support for partitioning design with placed information
   // ---- for example, pin-3D flow
   bool placement_flag_
       = false;  // if use placement information to guide partitioning
   int placement_dimensions_ = 2;  // by default, we are working on 2D canvas
-  std::vector<std::vector<float>>
-      placement_attr_;  // (internal representation, size is num_vertices_)
+  std::vector<float> placement_attr_;  // (internal representation, row-major,
+                                       // size is num_vertices_ *
+                                       // placement_dimensions_)
 
   bool fence_flag_ = false;  // if use fence constraint
   Rect fence_{0, 0, 0, 0};   // only consider the netlist within the fence
@@ -416,14 +422,18 @@ class TritonPart
   int num_vertices_threshold_ilp_ = 50;
 
   // Hypergraph information
-  // basic information
-  std::vector<std::vector<int>> hyperedges_;
+  // basic information, in the compressed sparse row form of Hypergraph:
+  // hyperedge e holds the vertices eind_[eptr_[e]] .. eind_[eptr_[e + 1] - 1]
+  // and the weights are flat row-major arrays. The readers fill them and
+  // move them into original_hypergraph_.
+  std::vector<int> eind_;
+  std::vector<int> eptr_;
   int num_vertices_ = 0;
   int num_hyperedges_ = 0;
   int vertex_dimensions_ = 1;     // specified in the hypergraph
   int hyperedge_dimensions_ = 1;  // specified in the hypergraph
-  std::vector<std::vector<float>> vertex_weights_;
-  std::vector<std::vector<float>> hyperedge_weights_;
+  std::vector<float> vertex_weights_;
+  std::vector<float> hyperedge_weights_;
   // When we create the hypergraph, we ignore all the hyperedges with vertices
   // more than global_net_threshold_
   HGraphPtr hypergraph_
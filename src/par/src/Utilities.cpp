@@ -133,12 +133,17 @@ std::vector<std::string> SplitLine(const std::string& line)
 }
 
 // Add right vector to left vector
-void Accumulate(std::vector<float>& a, const std::vector<float>& b)
+void Accumulate(std::vector<float>& a, const FloatSpan b)
 {
-  assert(a.size() == b.size());
+  assert(a.size() == static_cast<size_t>(b.size()));
   std::transform(a.begin(), a.end(), b.begin(), a.begin(), std::plus<float>());
 }
 
+void Accumulate(float* a, const FloatSpan b)
+{
+  std::transform(b.begin(), b.end(), a, a, std::plus<float>());
+}
+
 // weighted sum
 std::vector<float> WeightedSum(const std::vector<float>& a,
                                const float a_factor,
@@ -168,10 +173,9 @@ std::vector<float> DivideFactor(const std::vector<float>& a, const float factor)
 }
 
 // multiply the vector
-std::vector<float> MultiplyFactor(const std::vector<float>& a,
-                                  const float factor)
+std::vector<float> MultiplyFactor(const FloatSpan a, const float factor)
 {
-  std::vector<float> result = a;
+  std::vector<float> result = a.ToVector();
   for (auto& value : result) {
     value *= factor;
   }
@@ -198,8 +202,7 @@ std::vector<float> DivideVectorElebyEle(const std::vector<float>& emb,
 }
 
 // operation for two vectors +, -, *,  ==, <
-std::vector<float> operator+(const std::vector<float>& a,
-                             const std::vector<float>& b)
+std::vector<float> operator+(const FloatSpan a, const FloatSpan b)
 {
   assert(a.size() == b.size());
   std::vector<float> result;
@@ -212,8 +215,7 @@ std::vector<float> operator+(const std::vector<float>& a,
   return result;
 }
 
-std::vector<float> operator-(const std::vector<float>& a,
-                             const std::vector<float>& b)
+std::vector<float> operator-(const FloatSpan a, const FloatSpan b)
 {
   assert(a.size() == b.size());
   std::vector<float> result;
@@ -251,6 +253,11 @@ std::vector<float> operator*(const std::vector<float>& a, const float factor)
 }
 
 bool operator<(const std::vector<float>& a, const std::vector<float>& b)
+{
+  return FloatSpan(a) < FloatSpan(b);
+}
+
+bool operator<(const FloatSpan a, const FloatSpan b)
 {
   assert(a.size() == b.size());
   auto a_iter = a.begin();
@@ -293,14 +300,14 @@ std::vector<float> abs(const std::vector<float>& a)
   return result;
 }
 
-float norm2(const std::vector<float>& a)
+float norm2(const FloatSpan a)
 {
   float result{0};
   result = std::inner_product(a.begin(), a.end(), a.begin(), result);
   return std::sqrt(result);
 }
 
-float norm2(const std::vector<float>& a, const std::vector<float>& factor)
+float norm2(const FloatSpan a, const FloatSpan factor)
 {
   float result{0};
   assert(a.size() <= factor.size());
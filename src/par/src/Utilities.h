@@ -52,6 +52,29 @@ namespace par {
 template <typename T>
 using Matrix = std::vector<std::vector<T>>;
 
+// Read-only view of a contiguous row of floats, such as the weights of one
+// vertex in the flat weight array of a hypergraph. A std::vector<float>
+// converts to it implicitly. The view does not own the data.
+class FloatSpan
+{
+ public:
+  FloatSpan(const float* data, int size) : data_(data), size_(size) {}
+  FloatSpan(const std::vector<float>& vec)
+      : data_(vec.data()), size_(static_cast<int>(vec.size()))
+  {
+  }
+
+  const float* begin() const { return data_; }
+  const float* end() const { return data_ + size_; }
+  int size() const { return size_; }
+  float operator[](int i) const { return data_[i]; }
+  std::vector<float> ToVector() const { return {begin(), end()}; }
+
+ private:
+  const float* data_ = nullptr;
+  int size_ = 0;
+};
+
 struct Rect
 {
   // all the values are in db unit
@@ -92,7 +115,10 @@ std::string GetVectorString(const std::vector<float>& vec);
 std::vector<std::string> SplitLine(const std::string& line);
 
 // Add right vector to left vector
-void Accumulate(std::vector<float>& a, const std::vector<float>& b);
+void Accumulate(std::vector<float>& a, FloatSpan b);
+
+// Add b to the row of a flat row-major array that starts at a
+void Accumulate(float* a, FloatSpan b);
 
 // weighted sum
 std::vector<float> WeightedSum(const std::vector<float>& a,
@@ -108,22 +134,22 @@ std::vector<float> DivideVectorElebyEle(const std::vector<float>& emb,
                                         const std::vector<float>& factor);
 
 // multiplty the vector
-std::vector<float> MultiplyFactor(const std::vector<float>& a, float factor);
+std::vector<float> MultiplyFactor(FloatSpan a, float factor);
 
 // operation for two vectors +, -, *,  ==, <
-std::vector<float> operator+(const std::vector<float>& a,
-                             const std::vector<float>& b);
+std::vector<float> operator+(FloatSpan a, FloatSpan b);
 
 std::vector<float> operator*(const std::vector<float>& a, float factor);
 
-std::vector<float> operator-(const std::vector<float>& a,
-                             const std::vector<float>& b);
+std::vector<float> operator-(FloatSpan a, FloatSpan b);
 
 std::vector<float> operator*(const std::vector<float>& a,
                              const std::vector<float>& b);
 
 bool operator<(const std::vector<float>& a, const std::vector<float>& b);
 
+bool operator<(FloatSpan a, FloatSpan b);
+
 bool operator<=(const Matrix<float>& a, const Matrix<float>& b);
 
 bool operator==(const std::vector<float>& a, const std::vector<float>& b);
@@ -131,9 +157,9 @@ bool operator==(const std::vector<float>& a, const std::vector<float>& b);
 // Basic functions for a vector
 std::vector<float> abs(const std::vector<float>& a);
 
-float norm2(const std::vector<float>& a);
+float norm2(FloatSpan a);
 
-float norm2(const std::vector<float>& a, const std::vector<float>& factor);
+float norm2(FloatSpan a, FloatSpan factor);
 
 // ILP-based Partitioning Instance
 // Call ILP Solver to partition the design
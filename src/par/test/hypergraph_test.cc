@@ -0,0 +1,208 @@
+#include <set>
+#include <vector>
+
+#include "Hypergraph.h"
+#include "Utilities.h"
+#include "gtest/gtest.h"
+#include "utl/Logger.h"
+
+namespace par {
+
+class HypergraphTest : public ::testing::Test
+{
+ protected:
+  // 5 vertices with 2 weight dimensions, 4 hyperedges with 1 weight
+  // dimension and 2 placement dimensions.
+  static constexpr int vertex_dimensions_ = 2;
+  static constexpr int hyperedge_dimensions_ = 1;
+  static constexpr int placement_dimensions_ = 2;
+
+  const Matrix<int> hyperedges_{{0, 1, 2}, {1, 3}, {2, 3, 4}, {0, 4}};
+  const Matrix<float> vertex_weights_{
+      {1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}, {7.0, 8.0}, {9.0, 10.0}};
+  const Matrix<float> hyperedge_weights_{{1.5}, {2.5}, {3.5}, {4.5}};
+  const std::vector<int> fixed_attr_{-1, 0, -1, 1, -1};
+  const std::vector<int> community_attr_{0, 0, 1, 1, 2};
+  const Matrix<float> placement_attr_{
+      {0.0, 1.0}, {2.0, 3.0}, {4.0, 5.0}, {6.0, 7.0}, {8.0, 9.0}};
+
+  const std::vector<VertexType> vertex_types_{
+      PORT, COMB_STD_CELL, SEQ_STD_CELL, COMB_STD_CELL, PORT};
+  const std::vector<float> hyperedges_slack_{0.1, 0.2, 0.3, 0.4};
+  const std::vector<std::set<int>> hyperedges_arc_set_{{0}, {1}, {2}, {3}};
+  const std::vector<TimingPath> timing_paths_{
+      TimingPath({0, 1, 3}, {0, 1}, 0.5),
+      TimingPath({2, 4}, {2}, 0.7)};
+
+  HGraphPtr MakeMatrixHypergraph()
+  {
+    return std::make_shared<Hypergraph>(vertex_dimensions_,
+                                        hyperedge_dimensions_,
+                                        placement_dimensions_,
+                                        hyperedges_,
+                                        vertex_weights_,
+                                        hyperedge_weights_,
+                                        fixed_attr_,
+                                        community_attr_,
+                                        placement_attr_,
+                                        vertex_types_,
+                                        hyperedges_slack_,
+                                        hyperedges_arc_set_,
+                                        timing_paths_,
+                                        &logger_);
+  }
+
+  HGraphPtr MakeCsrHypergraph()
+  {
+    std::vector<int> eind;
+    std::vector<int> eptr{0};
+    for (const auto& hyperedge : hyperedges_) {
+      eind.insert(eind.end(), hyperedge.begin(), hyperedge.end());
+      eptr.push_back(eind.size());
+    }
+    return std::make_shared<Hypergraph>(vertex_dimensions_,
+                                        hyperedge_dimensions_,
+                                        placement_dimensions_,
+                                        std::move(eind),
+                                        std::move(eptr),
+                                        Flatten(vertex_weights_),
+                                        Flatten(hyperedge_weights_),
+                                        fixed_attr_,
+                                        community_attr_,
+                                        Flatten(placement_attr_),
+                                        vertex_types_,
+                                        hyperedges_slack_,
+                                        hyperedges_arc_set_,
+                                        timing_paths_,
+                                        &logger_);
+  }
+
+  static std::vector<float> Flatten(const Matrix<float>& matrix)
+  {
+    std::vector<float> flat;
+    for (const auto& row : matrix) {
+      flat.insert(flat.end(), row.begin(), row.end());
+    }
+    return flat;
+  }
+
+  template <typename Range>
+  static std::vector<int> ToVector(const Range& range)
+  {
+    return {range.begin(), range.end()};
+  }
+
+  utl::Logger logger_;
+};
+
+TEST_F(HypergraphTest, CsrConstructorMatchesMatrixConstructor)
+{
+  // Arrange
+  HGraphPtr matrix_graph = MakeMatrixHypergraph();
+  HGraphPtr csr_graph = MakeCsrHypergraph();
+
+  // Assert
+  ASSERT_EQ(csr_graph->GetNumVertices(), 5);
+  ASSERT_EQ(csr_graph->GetNumHyperedges(), 4);
+  EXPECT_EQ(csr_graph->GetNumVertices(), matrix_graph->GetNumVertices());
+  EXPECT_EQ(csr_graph->GetNumHyperedges(), matrix_graph->GetNumHyperedges());
+  EXPECT_EQ(csr_graph->GetPlacementDimensions(),
+            matrix_graph->GetPlacementDimensions());
+  EXPECT_TRUE(csr_graph->HasPlacement());
+  EXPECT_TRUE(csr_graph->HasFixedVertices());
+  EXPECT_TRUE(csr_graph->HasCommunity());
+  EXPECT_TRUE(csr_graph->HasTiming());
+
+  for (int e = 0; e < csr_graph->GetNumHyperedges(); e++) {
+    EXPECT_EQ(ToVector(csr_graph->Vertices(e)), hyperedges_[e]);
+    EXPECT_EQ(ToVector(csr_graph->Vertices(e)),
+              ToVector(matrix_graph->Vertices(e)));
+    EXPECT_EQ(csr_graph->GetHyperedgeWeights(e).ToVector(),
+              hyperedge_weights_[e]);
+    EXPECT_EQ(csr_graph->GetHyperedgeWeights(e).ToVector(),
+              matrix_graph->GetHyperedgeWeights(e).ToVector());
+  }
+
+  for (int v = 0; v < csr_graph->GetNumVertices(); v++) {
+    // the hyperedges of each vertex in increasing order
+    std::vector<int> edges;
+    for (int e = 0; e < static_cast<int>(hyperedges_.size()); e++) {
+      for (const int vertex : hyperedges_[e]) {
+        if (vertex == v) {
+          edges.push_back(e);
+        }
+      }
+    }
+    EXPECT_EQ(ToVector(csr_graph->Edges(v)), edges);
+    EXPECT_EQ(ToVector(csr_graph->Edges(v)),
+              ToVector(matrix_graph->Edges(v)));
+    EXPECT_EQ(csr_graph->GetVertexWeights(v).ToVector(), vertex_weights_[v]);
+    EXPECT_EQ(csr_graph->GetVertexWeights(v).ToVector(),
+              matrix_graph->GetVertexWeights(v).ToVector());
+    EXPECT_EQ(csr_graph->GetPlacement(v).ToVector(), placement_attr_[v]);
+    EXPECT_EQ(csr_graph->GetPlacement(v).ToVector(),
+              matrix_graph->GetPlacement(v).ToVector());
+    EXPECT_EQ(csr_graph->GetFixedAttr(v), matrix_graph->GetFixedAttr(v));
+    EXPECT_EQ(csr_graph->GetCommunity(v), matrix_graph->GetCommunity(v));
+    EXPECT_EQ(csr_graph->GetVertexType(v), matrix_graph->GetVertexType(v));
+    EXPECT_EQ(ToVector(csr_graph->TimingPathsThrough(v)),
+              ToVector(matrix_graph->TimingPathsThrough(v)));
+  }
+  EXPECT_EQ(csr_graph->GetVertexWeights(), matrix_graph->GetVertexWeights());
+  EXPECT_EQ(csr_graph->GetTotalVertexWeights(),
+            (std::vector<float>{25.0, 30.0}));
+
+  ASSERT_EQ(csr_graph->GetNumTimingPaths(), 2);
+  for (int p = 0; p < csr_graph->GetNumTimingPaths(); p++) {
+    EXPECT_EQ(ToVector(csr_graph->PathVertices(p)), timing_paths_[p].path);
+    EXPECT_EQ(ToVector(csr_graph->PathEdges(p)), timing_paths_[p].arcs);
+    EXPECT_EQ(csr_graph->PathTimingSlack(p), matrix_graph->PathTimingSlack(p));
+  }
+}
+
+TEST_F(HypergraphTest, ClusterMembershipMatchesClusterIds)
+{
+  // Arrange
+  // A coarser graph of 3 clusters over the 5 vertices of the finer one.
+  const std::vector<int> vertex_cluster_id{2, 0, 2, 1, 0};
+  const Matrix<int> hyperedges{{0, 1}, {1, 2}};
+  const Matrix<float> vertex_weights{{1.0}, {1.0}, {1.0}};
+  const Matrix<float> hyperedge_weights{{1.0}, {1.0}};
+  Hypergraph matrix_graph(1,
+                          1,
+                          0,
+                          hyperedges,
+                          vertex_weights,
+                          hyperedge_weights,
+                          {},
+                          {},
+                          {},
+                          &logger_);
+  Hypergraph csr_graph(1,
+                       1,
+                       0,
+                       std::vector<int>{0, 1, 1, 2},
+                       std::vector<int>{0, 2, 4},
+                       std::vector<float>{1.0, 1.0, 1.0},
+                       std::vector<float>{1.0, 1.0},
+                       {},
+                       {},
+                       {},
+                       &logger_);
+
+  // Act
+  matrix_graph.SetVertexCAttr(vertex_cluster_id);
+  csr_graph.SetVertexCAttr(vertex_cluster_id);
+
+  // Assert
+  const Matrix<int> members{{1, 4}, {3}, {0, 2}};
+  for (int c = 0; c < csr_graph.GetNumVertices(); c++) {
+    EXPECT_EQ(ToVector(csr_graph.GetVertexCAttr(c)), members[c]);
+    EXPECT_EQ(ToVector(csr_graph.GetVertexCAttr(c)),
+              ToVector(matrix_graph.GetVertexCAttr(c)));
+  }
+  EXPECT_FALSE(csr_graph.HasPlacement());
+  EXPECT_FALSE(csr_graph.HasFixedVertices());
+}
+
+}  // namespace par
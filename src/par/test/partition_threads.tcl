@@ -0,0 +1,13 @@
+# The coarsening must give the same partition for any number of threads.
+source "helpers.tcl"
+
+file mkdir results
+foreach threads {1 4} {
+  set hypergraph_file results/partition_threads_$threads.hgr
+  file copy -force partition_gcd.graphok $hypergraph_file
+  set_thread_count $threads
+  triton_part_hypergraph -hypergraph_file $hypergraph_file -num_parts 2
+}
+
+diff_files results/partition_threads_1.hgr.part.2 \
+  results/partition_threads_4.hgr.part.2
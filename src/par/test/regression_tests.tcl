@@ -1,6 +1,7 @@
 record_tests {
   read_part
   partition_gcd
+  partition_threads
   #par_man_tcl_check
   #par_readme_msgs_check
 }
@@ -164,7 +164,8 @@ class IOPlacer
   void setAnnealingConfig(float temperature,
                           int max_iterations,
                           int perturb_per_iter,
-                          float alpha);
+                          float alpha,
+                          int num_starts);
   void checkPinPlacement();
 
   void setRenderer(std::unique_ptr<AbstractIOPlacerRenderer> ioplacer_renderer);
@@ -325,6 +326,7 @@ class IOPlacer
   int max_iterations_ = 0;
   int perturb_per_iter_ = 0;
   float alpha_ = 0;
+  int num_starts_ = 1;
 
   // simulated annealing debugger variables
   bool annealing_debug_mode_ = false;
@@ -112,6 +112,12 @@ class Parameters
   }
   std::string getPinPlacementFile() const { return pin_placement_file_; }
 
+  void setNumThreads(int num_threads) { num_threads_ = num_threads; }
+  int getNumThreads() const { return num_threads_; }
+
+  void setSparseAssignment(bool sparse) { sparse_assignment_ = sparse; }
+  bool getSparseAssignment() const { return sparse_assignment_; }
+
  private:
   bool report_hpwl_ = false;
   int num_slots_ = -1;
@@ -128,6 +134,8 @@ class Parameters
   int min_dist_ = 0;
   bool distance_in_tracks_ = false;
   std::string pin_placement_file_;
+  int num_threads_ = 1;
+  bool sparse_assignment_ = false;
 };
 
 }  // namespace ppl
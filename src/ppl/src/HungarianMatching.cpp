@@ -35,6 +35,9 @@
 
 #include "HungarianMatching.h"
 
+#include <chrono>
+
+#include "SparseAssignment.h"
 #include "utl/Logger.h"
 
 namespace ppl {
@@ -44,13 +47,15 @@ HungarianMatching::HungarianMatching(const Section& section,
                                      Core* core,
                                      std::vector<Slot>& slots,
                                      Logger* logger,
-                                     odb::dbDatabase* db)
+                                     odb::dbDatabase* db,
+                                     bool sparse_assignment)
     : netlist_(netlist),
       core_(core),
       pin_indices_(section.pin_indices),
       pin_groups_(section.pin_groups),
       slots_(slots),
-      db_(db)
+      db_(db),
+      sparse_assignment_(sparse_assignment)
 {
   num_io_pins_ = section.pin_indices.size();
   num_pin_groups_ = netlist_->numIOGroups();
@@ -65,10 +70,75 @@ HungarianMatching::HungarianMatching(const Section& section,
 
 void HungarianMatching::findAssignment()
 {
-  createMatrix();
-  if (!hungarian_matrix_.empty()) {
-    hungarian_solver_.solve(hungarian_matrix_, assignment_);
+  const auto start = std::chrono::steady_clock::now();
+  used_sparse_assignment_ = sparse_assignment_ && findSparseAssignment();
+  if (!used_sparse_assignment_) {
+    createMatrix();
+    if (!hungarian_matrix_.empty()) {
+      hungarian_solver_.solve(hungarian_matrix_, assignment_);
+    }
+    assignment_memory_ = 0;
+    for (const std::vector<int>& row : hungarian_matrix_) {
+      assignment_memory_ += row.capacity() * sizeof(int);
+    }
+  }
+  const std::chrono::duration<double> elapsed
+      = std::chrono::steady_clock::now() - start;
+  assignment_runtime_ = elapsed.count();
+}
+
+// Assigns the pins outside groups without building the dense matrix. Rows
+// of assignment_ are the non-blocked slots and its values the pin columns,
+// as produced by the Hungarian solver. Returns false when there are more
+// pins than slots, which is left to the dense solver.
+bool HungarianMatching::findSparseAssignment()
+{
+  std::vector<int> pins;
+  for (int idx : pin_indices_) {
+    if (!netlist_->getIoPin(idx).isInGroup()) {
+      pins.push_back(idx);
+    }
   }
+  std::vector<int> slots;
+  for (int i = begin_slot_; i <= end_slot_; ++i) {
+    if (!slots_[i].blocked) {
+      slots.push_back(i);
+    }
+  }
+  if (pins.size() > slots.size()) {
+    return false;
+  }
+
+  SparseAssignment solver(pins.size(), slots.size(), [&](int pin, int slot) {
+    return netlist_->computeIONetHPWL(pins[pin], slots_[slots[slot]].pos);
+  });
+  const std::vector<int> pin_to_slot = solver.solve();
+
+  hungarian_matrix_.clear();
+  assignment_.assign(slots.size(), -1);
+  for (int pin = 0; pin < pin_to_slot.size(); pin++) {
+    assignment_[pin_to_slot[pin]] = pin;
+  }
+  assignment_memory_ = solver.getMemoryBytes();
+
+  return true;
+}
+
+void HungarianMatching::reportAssignmentStats() const
+{
+  debugPrint(logger_,
+             utl::PPL,
+             "assignment",
+             1,
+             "Section slots [{}, {}]: {} pins, {} free slots, {:.3f}s, {} KB "
+             "({} solver).",
+             begin_slot_,
+             end_slot_,
+             num_io_pins_,
+             non_blocked_slots_,
+             assignment_runtime_,
+             assignment_memory_ / 1024,
+             used_sparse_assignment_ ? "sparse" : "dense");
 }
 
 void HungarianMatching::createMatrix()
@@ -120,7 +190,8 @@ void HungarianMatching::getFinalAssignment(std::vector<IOPin>& assignment,
           slot_index++;
           continue;
         }
-        if (hungarian_matrix_[row][col] == hungarian_fail) {
+        if (!hungarian_matrix_.empty()
+            && hungarian_matrix_[row][col] == hungarian_fail) {
           logger_->warn(utl::PPL,
                         33,
                         "I/O pin {} cannot be placed in the specified region. "
@@ -66,9 +66,11 @@ class HungarianMatching
                     Core* core,
                     std::vector<Slot>& slots,
                     Logger* logger,
-                    odb::dbDatabase* db);
+                    odb::dbDatabase* db,
+                    bool sparse_assignment = false);
   virtual ~HungarianMatching() = default;
   void findAssignment();
+  void reportAssignmentStats() const;
   void findAssignmentForGroups();
   void getFinalAssignment(std::vector<IOPin>& assignment,
                           MirroredPins& mirrored_pins,
@@ -98,8 +100,14 @@ class HungarianMatching
   const int hungarian_fail = std::numeric_limits<int>::max();
   Logger* logger_;
   odb::dbDatabase* db_;
+  bool sparse_assignment_;
+  // True when the last findAssignment ran the sparse solver.
+  bool used_sparse_assignment_ = false;
+  double assignment_runtime_ = 0;
+  size_t assignment_memory_ = 0;
 
   void createMatrix();
+  bool findSparseAssignment();
   void createMatrixForGroups();
   void assignMirroredPins(IOPin& io_pin,
                           MirroredPins& mirrored_pins,
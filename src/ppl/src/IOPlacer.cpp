@@ -1993,11 +1993,17 @@ void IOPlacer::findPinAssignment(std::vector<Section>& sections,
                              core_.get(),
                              top_layer_slots_,
                              logger_,
-                             db_);
+                             db_,
+                             parms_->getSparseAssignment());
         hg_vec.push_back(hg);
       } else {
-        HungarianMatching hg(
-            section, netlist_io_pins_.get(), core_.get(), slots_, logger_, db_);
+        HungarianMatching hg(section,
+                             netlist_io_pins_.get(),
+                             core_.get(),
+                             slots_,
+                             logger_,
+                             db_,
+                             parms_->getSparseAssignment());
         hg_vec.push_back(hg);
       }
     }
@@ -2018,8 +2024,15 @@ void IOPlacer::findPinAssignment(std::vector<Section>& sections,
     updateSection(sec, slots);
   }
 
-  for (auto& match : hg_vec) {
-    match.findAssignment();
+  // Sections only read the netlist and their own range of slots here, so
+  // they are solved independently.
+#pragma omp parallel for schedule(dynamic) num_threads(parms_->getNumThreads())
+  for (int i = 0; i < hg_vec.size(); i++) {
+    hg_vec[i].findAssignment();
+  }
+
+  for (const auto& match : hg_vec) {
+    match.reportAssignmentStats();
   }
 
   if (!mirrored_pins_.empty()) {
@@ -2148,12 +2161,14 @@ void IOPlacer::run(bool random_mode)
 void IOPlacer::setAnnealingConfig(float temperature,
                                   int max_iterations,
                                   int perturb_per_iter,
-                                  float alpha)
+                                  float alpha,
+                                  int num_starts)
 {
   init_temperature_ = temperature;
   max_iterations_ = max_iterations;
   perturb_per_iter_ = perturb_per_iter;
   alpha_ = alpha;
+  num_starts_ = num_starts;
 }
 
 void IOPlacer::setRenderer(
@@ -2209,8 +2224,13 @@ void IOPlacer::runAnnealing(bool random)
 
   printConfig(true);
 
-  annealing.run(
-      init_temperature_, max_iterations_, perturb_per_iter_, alpha_, random);
+  annealing.run(init_temperature_,
+                max_iterations_,
+                perturb_per_iter_,
+                alpha_,
+                random,
+                num_starts_,
+                parms_->getNumThreads());
   annealing.getAssignment(assignment_);
 
   for (auto& pin : assignment_) {
@@ -232,6 +232,8 @@ add_pin_group(PinList *pin_list, bool order)
 void
 run_io_placement(bool randomMode)
 {
+  getIOPlacer()->getParameters()->setNumThreads(
+      ord::OpenRoad::openRoad()->getThreadCount());
   getIOPlacer()->run(randomMode);
 }
 
@@ -283,6 +285,12 @@ set_min_distance_in_tracks(bool in_tracks)
   getIOPlacer()->getParameters()->setMinDistanceInTracks(in_tracks);
 }
 
+void
+set_sparse_assignment(bool sparse)
+{
+  getIOPlacer()->getParameters()->setSparseAssignment(sparse);
+}
+
 void set_pin_placement_file(const char* file_name)
 {
   getIOPlacer()->getParameters()->setPinPlacementFile(file_name);
@@ -327,9 +335,10 @@ void
 set_simulated_annealing(float temperature,
                         int max_iterations,
                         int perturb_per_iter,
-                        float alpha)
+                        float alpha,
+                        int num_starts)
 {
-  getIOPlacer()->setAnnealingConfig(temperature, max_iterations, perturb_per_iter, alpha);
+  getIOPlacer()->setAnnealingConfig(temperature, max_iterations, perturb_per_iter, alpha, num_starts);
 }
 
 void
@@ -353,6 +362,8 @@ simulated_annealing_debug(int iters_between_paintings,
 void
 run_annealing(bool random)
 {
+  getIOPlacer()->getParameters()->setNumThreads(
+      ord::OpenRoad::openRoad()->getThreadCount());
   getIOPlacer()->runAnnealing(random);
 }
 
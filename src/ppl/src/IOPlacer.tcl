@@ -316,12 +316,13 @@ proc set_pin_thick_multiplier { args } {
 sta::define_cmd_args "set_simulated_annealing" {[-temperature temperature]\
                                                 [-max_iterations iters]\
                                                 [-perturb_per_iter perturbs]\
-                                                [-alpha alpha]
+                                                [-alpha alpha]\
+                                                [-num_starts starts]
 }
 
 proc set_simulated_annealing { args } {
   sta::parse_key_args "set_simulated_annealing" args \
-    keys {-temperature -max_iterations -perturb_per_iter -alpha} flags {}
+    keys {-temperature -max_iterations -perturb_per_iter -alpha -num_starts} flags {}
 
   set temperature 0
   if {[info exists keys(-temperature)]} {
@@ -347,7 +348,13 @@ proc set_simulated_annealing { args } {
     sta::check_positive_float "-alpha" $alpha
   }
 
-  ppl::set_simulated_annealing $temperature $max_iterations $perturb_per_iter $alpha
+  set num_starts 1
+  if {[info exists keys(-num_starts)]} {
+    set num_starts $keys(-num_starts)
+    sta::check_positive_int "-num_starts" $num_starts
+  }
+
+  ppl::set_simulated_annealing $temperature $max_iterations $perturb_per_iter $alpha $num_starts
 }
 
 sta::define_cmd_args "simulated_annealing_debug" {
@@ -451,6 +458,7 @@ sta::define_cmd_args "place_pins" {[-hor_layers h_layers]\
                                   [-exclude region]\
                                   [-group_pins pin_list]\
                                   [-annealing] \
+                                  [-sparse_assignment] \
                                   [-write_pin_placement file_name]
 }; # checker off
 
@@ -459,7 +467,7 @@ proc place_pins { args } {
   sta::parse_key_args "place_pins" args \
     keys {-hor_layers -ver_layers -random_seed -corner_avoidance \
           -min_distance -write_pin_placement} \
-    flags {-random -min_distance_in_tracks -annealing}; # checker off
+    flags {-random -min_distance_in_tracks -annealing -sparse_assignment}; # checker off
 
   sta::check_argc_eq0 "place_pins" $args
 
@@ -532,6 +540,7 @@ proc place_pins { args } {
     ppl::set_min_distance 0
   }
   ppl::set_min_distance_in_tracks $dist_in_tracks
+  ppl::set_sparse_assignment [info exists flags(-sparse_assignment)]
 
   set bterms_cnt [llength [$dbBlock getBTerms]]
 
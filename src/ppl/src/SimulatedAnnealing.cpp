@@ -38,6 +38,7 @@
 #include "ppl/AbstractIOPlacerRenderer.h"
 #include "utl/Logger.h"
 #include "utl/algorithms.h"
+#include "utl/exception.h"
 
 namespace ppl {
 
@@ -68,78 +69,145 @@ void SimulatedAnnealing::run(float init_temperature,
                              int max_iterations,
                              int perturb_per_iter,
                              float alpha,
-                             bool random)
+                             bool random,
+                             int num_starts,
+                             int num_threads)
 {
   init(init_temperature, max_iterations, perturb_per_iter, alpha);
+  if (!random && num_starts > 1 && !debug_->isOn()) {
+    runMultiStart(num_starts, num_threads);
+    return;
+  }
   randomAssignment();
   if (!random) {
-    int64 pre_cost = 0;
-    pre_cost = getAssignmentCost();
-    float temperature = init_temperature_;
-    odb::dbBlock* block = db_->getChip()->getBlock();
+    anneal();
+  }
+}
 
-    boost::random::uniform_real_distribution<float> distribution;
-    for (int iter = 0; iter < max_iterations_; iter++) {
-      for (int perturb = 0; perturb < perturb_per_iter_; perturb++) {
-        int prev_cost;
-        perturbAssignment(prev_cost);
-
-        const int64 cost = pre_cost + getDeltaCost(prev_cost);
-        const int delta_cost = cost - pre_cost;
-        debugPrint(
-            logger_,
-            utl::PPL,
-            "annealing",
-            2,
-            "iteration: {}; temperature: {}; assignment cost: {}um; delta "
-            "cost: {}um",
-            iter,
-            temperature,
-            block->dbuToMicrons(cost),
-            block->dbuToMicrons(delta_cost));
-
-        const float rand_float = distribution(generator_);
-        const float accept_prob = std::exp((-1) * delta_cost / temperature);
-        if (delta_cost <= 0 || accept_prob > rand_float) {
-          // accept new solution, update cost and slots
-          pre_cost = cost;
-          if (!prev_slots_.empty() && !new_slots_.empty()) {
-            for (int prev_slot : prev_slots_) {
-              slots_[prev_slot].used = false;
-            }
-            for (int new_slot : new_slots_) {
-              slots_[new_slot].used = true;
-            }
+// Runs independent chains, each from its own random assignment on a copy of
+// the slots, and keeps the cheapest one. The first chain uses the default
+// seed, so the result is never worse than a single chain run.
+void SimulatedAnnealing::runMultiStart(int num_starts, int num_threads)
+{
+  std::vector<std::vector<Slot>> chain_slots(num_starts, slots_);
+  std::vector<std::unique_ptr<SimulatedAnnealing>> chains;
+  for (int i = 0; i < num_starts; i++) {
+    auto chain = std::make_unique<SimulatedAnnealing>(
+        netlist_, core_, chain_slots[i], constraints_, logger_, db_);
+    chain->init_temperature_ = init_temperature_;
+    chain->max_iterations_ = max_iterations_;
+    chain->perturb_per_iter_ = perturb_per_iter_;
+    chain->alpha_ = alpha_;
+    chain->pin_assignment_ = pin_assignment_;
+    chain->slot_indices_ = slot_indices_;
+    chain->net_boxes_ = net_boxes_;
+    chain->seed_ = seed_ + i;
+    chain->generator_.seed(chain->seed_);
+    chains.push_back(std::move(chain));
+  }
+
+  std::vector<int64> costs(num_starts);
+  utl::ThreadException exception;
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+  for (int i = 0; i < num_starts; i++) {
+    try {
+      chains[i]->randomAssignment();
+      costs[i] = chains[i]->anneal();
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  exception.rethrow();
+
+  const int best = std::min_element(costs.begin(), costs.end()) - costs.begin();
+  odb::dbBlock* block = db_->getChip()->getBlock();
+  for (int i = 0; i < num_starts; i++) {
+    debugPrint(logger_,
+               utl::PPL,
+               "annealing",
+               1,
+               "start {}: seed {}; assignment cost: {}um{}",
+               i,
+               chains[i]->seed_,
+               block->dbuToMicrons(costs[i]),
+               i == best ? " (best)" : "");
+  }
+
+  pin_assignment_ = std::move(chains[best]->pin_assignment_);
+  pin_groups_ = std::move(chains[best]->pin_groups_);
+  slots_ = std::move(chain_slots[best]);
+}
+
+int64 SimulatedAnnealing::anneal()
+{
+  int64 pre_cost = 0;
+  pre_cost = getAssignmentCost();
+  float temperature = init_temperature_;
+  odb::dbBlock* block = db_->getChip()->getBlock();
+
+  boost::random::uniform_real_distribution<float> distribution;
+  for (int iter = 0; iter < max_iterations_; iter++) {
+    for (int perturb = 0; perturb < perturb_per_iter_; perturb++) {
+      int prev_cost;
+      perturbAssignment(prev_cost);
+
+      const int64 cost = pre_cost + getDeltaCost(prev_cost);
+      const int delta_cost = cost - pre_cost;
+      debugPrint(
+          logger_,
+          utl::PPL,
+          "annealing",
+          2,
+          "iteration: {}; temperature: {}; assignment cost: {}um; delta "
+          "cost: {}um",
+          iter,
+          temperature,
+          block->dbuToMicrons(cost),
+          block->dbuToMicrons(delta_cost));
+
+      const float rand_float = distribution(generator_);
+      const float accept_prob = std::exp((-1) * delta_cost / temperature);
+      if (delta_cost <= 0 || accept_prob > rand_float) {
+        // accept new solution, update cost and slots
+        pre_cost = cost;
+        if (!prev_slots_.empty() && !new_slots_.empty()) {
+          for (int prev_slot : prev_slots_) {
+            slots_[prev_slot].used = false;
           }
-        } else {
-          for (int i = 0; i < prev_slots_.size(); i++) {
-            slots_[prev_slots_[i]].used = true;
+          for (int new_slot : new_slots_) {
+            slots_[new_slot].used = true;
           }
-          restorePreviousAssignment();
         }
-        prev_slots_.clear();
-        new_slots_.clear();
-        pins_.clear();
+      } else {
+        for (int i = 0; i < prev_slots_.size(); i++) {
+          slots_[prev_slots_[i]].used = true;
+        }
+        restorePreviousAssignment();
       }
+      prev_slots_.clear();
+      new_slots_.clear();
+      pins_.clear();
+    }
 
-      temperature *= alpha_;
-
-      if (debug_->isOn()) {
-        std::vector<ppl::IOPin> pins;
-        getAssignment(pins);
+    temperature *= alpha_;
 
-        std::vector<std::vector<ppl::InstancePin>> all_sinks;
+    if (debug_->isOn()) {
+      std::vector<ppl::IOPin> pins;
+      getAssignment(pins);
 
-        for (int pin_idx = 0; pin_idx < pins.size(); pin_idx++) {
-          std::vector<ppl::InstancePin> pin_sinks;
-          netlist_->getSinksOfIO(pin_idx, pin_sinks);
-          all_sinks.push_back(pin_sinks);
-        }
+      std::vector<std::vector<ppl::InstancePin>> all_sinks;
 
-        annealingStateVisualization(pins, all_sinks, iter);
+      for (int pin_idx = 0; pin_idx < pins.size(); pin_idx++) {
+        std::vector<ppl::InstancePin> pin_sinks;
+        netlist_->getSinksOfIO(pin_idx, pin_sinks);
+        all_sinks.push_back(pin_sinks);
       }
+
+      annealingStateVisualization(pins, all_sinks, iter);
     }
   }
+
+  return pre_cost;
 }
 
 void SimulatedAnnealing::getAssignment(std::vector<IOPin>& assignment)
@@ -197,6 +265,7 @@ void SimulatedAnnealing::init(float init_temperature,
   pin_assignment_.resize(num_pins_);
   slot_indices_.resize(num_slots_);
   std::iota(slot_indices_.begin(), slot_indices_.end(), 0);
+  initNetBoxes();
 
   debugPrint(logger_,
              utl::PPL,
@@ -212,6 +281,22 @@ void SimulatedAnnealing::init(float init_temperature,
   generator_.seed(seed_);
 }
 
+void SimulatedAnnealing::initNetBoxes()
+{
+  net_boxes_.resize(num_pins_);
+  std::vector<InstancePin> sinks;
+  for (int i = 0; i < num_pins_; i++) {
+    odb::Rect& box = net_boxes_[i];
+    box.mergeInit();
+    sinks.clear();
+    netlist_->getSinksOfIO(i, sinks);
+    for (const InstancePin& sink : sinks) {
+      const odb::Point pos = sink.getPos();
+      box.merge(odb::Rect(pos, pos));
+    }
+  }
+}
+
 void SimulatedAnnealing::randomAssignment()
 {
   std::mt19937 g;
@@ -358,16 +443,19 @@ int SimulatedAnnealing::getPinCost(int pin_idx)
 {
   int slot_idx = pin_assignment_[pin_idx];
   const odb::Point& position = slots_[slot_idx].pos;
-  return netlist_->computeIONetHPWL(pin_idx, position);
+  const odb::Rect& box = net_boxes_[pin_idx];
+  const int x = std::max(box.xMax(), position.x())
+                - std::min(box.xMin(), position.x());
+  const int y = std::max(box.yMax(), position.y())
+                - std::min(box.yMin(), position.y());
+  return x + y;
 }
 
 int64 SimulatedAnnealing::getGroupCost(int group_idx)
 {
   int64 cost = 0;
   for (int pin_idx : pin_groups_[group_idx].pin_indices) {
-    int slot_idx = pin_assignment_[pin_idx];
-    const odb::Point& position = slots_[slot_idx].pos;
-    cost += netlist_->computeIONetHPWL(pin_idx, position);
+    cost += getPinCost(pin_idx);
   }
 
   return cost;
@@ -565,7 +653,7 @@ int SimulatedAnnealing::moveGroupToFreeSlots(const int group_idx)
   }
 
   if (free_slot && same_edge_slot) {
-    netlist_->sortPinsFromGroup(group_idx, slots_[new_slot].edge);
+    sortPinsFromGroup(group_idx, slots_[new_slot].edge);
     updateGroupSlots(group.pin_indices, new_slot);
   } else {
     prev_slots_.clear();
@@ -700,7 +788,7 @@ int SimulatedAnnealing::rearrangeConstrainedGroups(int constraint_idx)
     for (int idx : aux_indices) {
       int group_idx = group_indices[idx];
       const PinGroupByIndex& group = pin_groups_[group_idx];
-      netlist_->sortPinsFromGroup(group_idx, slots_[new_slot].edge);
+      sortPinsFromGroup(group_idx, slots_[new_slot].edge);
       updateGroupSlots(group.pin_indices, new_slot);
       cnt++;
       if (cnt < group_limits_list.size()) {
@@ -902,6 +990,15 @@ void SimulatedAnnealing::updateGroupSlots(const std::vector<int>& pin_indices,
   }
 }
 
+void SimulatedAnnealing::sortPinsFromGroup(int group_idx, Edge edge)
+{
+  PinGroupByIndex& group = pin_groups_[group_idx];
+  std::vector<int>& pin_indices = group.pin_indices;
+  if (group.order && (edge == Edge::top || edge == Edge::left)) {
+    std::reverse(pin_indices.begin(), pin_indices.end());
+  }
+}
+
 void SimulatedAnnealing::countLonePins()
 {
   int pins_in_groups = 0;
@@ -79,7 +79,9 @@ class SimulatedAnnealing
            int max_iterations,
            int perturb_per_iter,
            float alpha,
-           bool random);
+           bool random,
+           int num_starts = 1,
+           int num_threads = 1);
   void getAssignment(std::vector<IOPin>& assignment);
 
   // debug functions
@@ -97,6 +99,9 @@ class SimulatedAnnealing
             int max_iterations,
             int perturb_per_iter,
             float alpha);
+  void initNetBoxes();
+  int64 anneal();
+  void runMultiStart(int num_starts, int num_threads);
   void randomAssignment();
   int randomAssignmentForGroups(std::set<int>& placed_pins,
                                 const std::vector<int>& slot_indices);
@@ -124,6 +129,7 @@ class SimulatedAnnealing
   void updateSlotsFromGroup(const std::vector<int>& prev_slots_, bool block);
   int computeGroupPrevCost(int group_idx);
   void updateGroupSlots(const std::vector<int>& pin_indices, int& new_slot);
+  void sortPinsFromGroup(int group_idx, Edge edge);
   void countLonePins();
 
   // [pin] -> slot
@@ -132,7 +138,8 @@ class SimulatedAnnealing
   Netlist* netlist_;
   Core* core_;
   std::vector<Slot>& slots_;
-  const std::vector<PinGroupByIndex>& pin_groups_;
+  // Copied from the netlist so that each chain orders its groups on its own.
+  std::vector<PinGroupByIndex> pin_groups_;
   const std::vector<Constraint>& constraints_;
   int num_slots_;
   int num_pins_;
@@ -143,6 +150,10 @@ class SimulatedAnnealing
   std::vector<int> new_slots_;
   std::vector<int> pins_;
 
+  // [pin] -> bounding box of the instance pins of its net. They don't move
+  // during annealing, so a pin cost is the box extended to the pin slot.
+  std::vector<odb::Rect> net_boxes_;
+
   // annealing variables
   float init_temperature_ = 1.0;
   int max_iterations_ = 2000;
@@ -160,7 +171,7 @@ class SimulatedAnnealing
   Logger* logger_ = nullptr;
   odb::dbDatabase* db_;
   const int fail_cost_ = std::numeric_limits<int>::max();
-  const int seed_ = 42;
+  int seed_ = 42;
 
   // debug variables
   std::unique_ptr<DebugSettings> debug_;
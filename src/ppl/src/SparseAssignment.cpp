@@ -0,0 +1,241 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "SparseAssignment.h"
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <utility>
+
+namespace ppl {
+
+static constexpr int64_t inf = std::numeric_limits<int64_t>::max();
+
+SparseAssignment::SparseAssignment(int num_rows, int num_cols, CostFn cost)
+    : num_rows_(num_rows), num_cols_(num_cols), cost_(std::move(cost))
+{
+}
+
+void SparseAssignment::addCandidates(int row)
+{
+  std::vector<Edge>& edges = edges_[row];
+  edges.reserve(num_cols_);
+  for (int col = 0; col < num_cols_; col++) {
+    edges.push_back({col, cost_(row, col)});
+  }
+  if (edges.size() > candidates_per_row_) {
+    // Ties go to the lower column so the result is deterministic.
+    auto cheaper = [](const Edge& a, const Edge& b) {
+      return a.cost < b.cost || (a.cost == b.cost && a.col < b.col);
+    };
+    std::nth_element(edges.begin(),
+                     edges.begin() + candidates_per_row_ - 1,
+                     edges.end(),
+                     cheaper);
+    edges.resize(candidates_per_row_);
+    edges.shrink_to_fit();
+  }
+}
+
+void SparseAssignment::densifyRow(int row)
+{
+  std::vector<Edge>& edges = edges_[row];
+  edges.clear();
+  for (int col = 0; col < num_cols_; col++) {
+    edges.push_back({col, cost_(row, col)});
+  }
+}
+
+// Finds a shortest augmenting path from the unmatched row to a free column
+// on the reduced costs and flips it. The potentials are updated so that
+// every reduced cost stays non-negative and the matched edges have zero
+// reduced cost.
+bool SparseAssignment::augment(int row)
+{
+  int64_t min_cost = inf;
+  for (const Edge& edge : edges_[row]) {
+    min_cost = std::min(min_cost, edge.cost - col_potential_[edge.col]);
+  }
+  row_potential_[row] = min_cost;
+
+  using Entry = std::pair<int64_t, int>;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+  std::vector<int> touched_cols;
+  std::vector<std::pair<int, int64_t>> reached_rows;
+  reached_rows.emplace_back(row, 0);
+
+  auto relax = [&](int from_row, int64_t from_dist) {
+    for (const Edge& edge : edges_[from_row]) {
+      const int col = edge.col;
+      if (scanned_[col]) {
+        continue;
+      }
+      const int64_t reduced
+          = edge.cost - row_potential_[from_row] - col_potential_[col];
+      const int64_t dist = from_dist + reduced;
+      if (dist < dist_[col]) {
+        if (dist_[col] == inf) {
+          touched_cols.push_back(col);
+        }
+        dist_[col] = dist;
+        pred_row_[col] = from_row;
+        queue.emplace(dist, col);
+      }
+    }
+  };
+
+  relax(row, 0);
+  int free_col = -1;
+  std::vector<int> scanned_cols;
+  while (!queue.empty()) {
+    const auto [dist, col] = queue.top();
+    queue.pop();
+    if (scanned_[col] || dist > dist_[col]) {
+      continue;
+    }
+    scanned_[col] = true;
+    scanned_cols.push_back(col);
+    if (col_to_row_[col] == -1) {
+      free_col = col;
+      break;
+    }
+    const int next_row = col_to_row_[col];
+    reached_rows.emplace_back(next_row, dist);
+    relax(next_row, dist);
+  }
+
+  if (free_col != -1) {
+    const int64_t path_dist = dist_[free_col];
+    for (const auto& [reached_row, dist] : reached_rows) {
+      row_potential_[reached_row] += path_dist - dist;
+    }
+    for (int col : scanned_cols) {
+      col_potential_[col] -= path_dist - dist_[col];
+    }
+    for (int col = free_col; col != -1;) {
+      const int pred = pred_row_[col];
+      const int prev_col = row_to_col_[pred];
+      row_to_col_[pred] = col;
+      col_to_row_[col] = pred;
+      col = (pred == row) ? -1 : prev_col;
+    }
+  }
+
+  for (int col : touched_cols) {
+    dist_[col] = inf;
+    pred_row_[col] = -1;
+    scanned_[col] = false;
+  }
+
+  return free_col != -1;
+}
+
+// Adds every edge missing from the candidate lists whose reduced cost is
+// negative, i.e. that could improve the assignment.
+bool SparseAssignment::addViolatedEdges()
+{
+  bool added = false;
+  std::vector<bool> present(num_cols_, false);
+  for (int row = 0; row < num_rows_; row++) {
+    std::vector<Edge>& edges = edges_[row];
+    if (edges.size() == static_cast<size_t>(num_cols_)) {
+      continue;
+    }
+    for (const Edge& edge : edges) {
+      present[edge.col] = true;
+    }
+    const size_t num_edges = edges.size();
+    for (int col = 0; col < num_cols_; col++) {
+      if (present[col]) {
+        continue;
+      }
+      const int64_t cost = cost_(row, col);
+      if (cost - row_potential_[row] - col_potential_[col] < 0) {
+        edges.push_back({col, cost});
+        added = true;
+      }
+    }
+    for (size_t i = 0; i < num_edges; i++) {
+      present[edges[i].col] = false;
+    }
+  }
+  return added;
+}
+
+std::vector<int> SparseAssignment::solve()
+{
+  edges_.assign(num_rows_, {});
+  for (int row = 0; row < num_rows_; row++) {
+    addCandidates(row);
+  }
+
+  dist_.assign(num_cols_, inf);
+  pred_row_.assign(num_cols_, -1);
+  scanned_.assign(num_cols_, false);
+
+  do {
+    rounds_++;
+    row_potential_.assign(num_rows_, 0);
+    col_potential_.assign(num_cols_, 0);
+    row_to_col_.assign(num_rows_, -1);
+    col_to_row_.assign(num_cols_, -1);
+    for (int row = 0; row < num_rows_; row++) {
+      if (!augment(row)) {
+        // The candidates of the matched rows block this one; with all
+        // columns available it always reaches a free one.
+        densifyRow(row);
+        augment(row);
+      }
+    }
+  } while (addViolatedEdges());
+
+  return row_to_col_;
+}
+
+size_t SparseAssignment::getMemoryBytes() const
+{
+  size_t bytes = 0;
+  for (const std::vector<Edge>& edges : edges_) {
+    bytes += edges.capacity() * sizeof(Edge);
+  }
+  bytes += (row_potential_.size() + col_potential_.size() + dist_.size())
+           * sizeof(int64_t);
+  bytes += (row_to_col_.size() + col_to_row_.size() + pred_row_.size())
+           * sizeof(int);
+  return bytes;
+}
+
+}  // namespace ppl
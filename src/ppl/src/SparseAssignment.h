@@ -0,0 +1,97 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace ppl {
+
+// Min-cost assignment of every row to a distinct column, computed on a
+// sparse set of candidate edges with successive shortest augmenting paths
+// (Dijkstra on reduced costs, as in Jonker-Volgenant). Each row starts
+// with its cheapest candidates. Once all rows are matched, the full cost
+// function is checked against the final potentials. Any edge with a
+// negative reduced cost is added and the problem is solved again, so the
+// result is optimal for the dense problem while memory stays proportional
+// to the candidate edges.
+class SparseAssignment
+{
+ public:
+  using CostFn = std::function<int64_t(int row, int col)>;
+
+  // Requires num_rows <= num_cols.
+  SparseAssignment(int num_rows, int num_cols, CostFn cost);
+
+  // Returns the column assigned to each row.
+  std::vector<int> solve();
+
+  size_t getMemoryBytes() const;
+  int getRounds() const { return rounds_; }
+
+ private:
+  struct Edge
+  {
+    int col;
+    int64_t cost;
+  };
+
+  void addCandidates(int row);
+  void densifyRow(int row);
+  bool augment(int row);
+  bool addViolatedEdges();
+
+  static constexpr int candidates_per_row_ = 32;
+
+  int num_rows_;
+  int num_cols_;
+  CostFn cost_;
+  int rounds_ = 0;
+
+  std::vector<std::vector<Edge>> edges_;
+  std::vector<int64_t> row_potential_;
+  std::vector<int64_t> col_potential_;
+  std::vector<int> row_to_col_;
+  std::vector<int> col_to_row_;
+
+  // Dijkstra state, reset after each augmentation.
+  std::vector<int64_t> dist_;
+  std::vector<int> pred_row_;
+  std::vector<bool> scanned_;
+};
+
+}  // namespace ppl
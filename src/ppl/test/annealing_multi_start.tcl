@@ -0,0 +1,37 @@
+# multi-start IO pin annealing is reproducible across thread counts and
+# no worse than a single start
+source "helpers.tcl"
+read_lef Nangate45/Nangate45.lef
+read_def gcd.def
+
+# design__io__hpwl is logged in DBU by every run
+set metrics_file [make_result_file annealing_multi_start.json]
+utl::open_metrics $metrics_file
+
+set_thread_count 4
+place_pins -hor_layers metal3 -ver_layers metal4 -annealing
+
+# the HPWL of the multi-start runs is compared below
+suppress_message PPL 12
+
+set_simulated_annealing -num_starts 4
+place_pins -hor_layers metal3 -ver_layers metal4 -annealing
+set def_file1 [make_result_file annealing_multi_start1.def]
+write_def $def_file1
+
+set_thread_count 2
+place_pins -hor_layers metal3 -ver_layers metal4 -annealing
+set def_file2 [make_result_file annealing_multi_start2.def]
+write_def $def_file2
+
+utl::close_metrics $metrics_file
+
+set stream [open $metrics_file r]
+set metrics [read $stream]
+close $stream
+set hpwls [regexp -all -inline {"design__io__hpwl": (\d+)} $metrics]
+lassign $hpwls - hpwl_single - hpwl_multi1 - hpwl_multi2
+
+puts "multi-start HPWL no worse: [expr { $hpwl_multi1 <= $hpwl_single }]"
+puts "multi-start HPWL reproducible: [expr { $hpwl_multi2 == $hpwl_multi1 }]"
+diff_files $def_file1 $def_file2
@@ -0,0 +1,140 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// BSD 3-Clause License
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "Hungarian.h"
+#include "SparseAssignment.h"
+#include "gtest/gtest.h"
+
+namespace ppl {
+
+// Builds a slots x pins cost matrix like the IO placer does: pins and slots
+// at random points, cost is the distance between a slot and the pin's net.
+static std::vector<std::vector<int>> makeCosts(int num_slots,
+                                               int num_pins,
+                                               unsigned seed)
+{
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> coord(0, 1000);
+  std::vector<std::pair<int, int>> pins(num_pins);
+  for (auto& [x, y] : pins) {
+    x = coord(rng);
+    y = coord(rng);
+  }
+  std::vector<std::vector<int>> costs(num_slots, std::vector<int>(num_pins));
+  for (int slot = 0; slot < num_slots; slot++) {
+    const int x = coord(rng);
+    const int y = coord(rng);
+    for (int pin = 0; pin < num_pins; pin++) {
+      costs[slot][pin]
+          = std::abs(x - pins[pin].first) + std::abs(y - pins[pin].second);
+    }
+  }
+  return costs;
+}
+
+// Returns the cost of the sparse assignment and checks that every pin gets
+// a distinct slot.
+static int64_t sparseCost(const std::vector<std::vector<int>>& costs,
+                          int num_pins)
+{
+  const int num_slots = costs.size();
+  SparseAssignment solver(num_pins, num_slots, [&](int pin, int slot) {
+    return costs[slot][pin];
+  });
+  const std::vector<int> pin_to_slot = solver.solve();
+
+  EXPECT_EQ(pin_to_slot.size(), num_pins);
+  std::vector<bool> used(num_slots, false);
+  int64_t cost = 0;
+  for (int pin = 0; pin < num_pins; pin++) {
+    const int slot = pin_to_slot[pin];
+    EXPECT_GE(slot, 0);
+    EXPECT_LT(slot, num_slots);
+    EXPECT_FALSE(used[slot]);
+    used[slot] = true;
+    cost += costs[slot][pin];
+  }
+  return cost;
+}
+
+static int64_t denseCost(std::vector<std::vector<int>> costs)
+{
+  std::vector<int> assignment;
+  HungarianAlgorithm hungarian;
+  hungarian.solve(costs, assignment);
+  int64_t cost = 0;
+  for (int slot = 0; slot < assignment.size(); slot++) {
+    if (assignment[slot] >= 0) {
+      cost += costs[slot][assignment[slot]];
+    }
+  }
+  return cost;
+}
+
+TEST(SparseAssignment, matches_hungarian_cost)
+{
+  // Sizes above the 32 candidates per row exercise the added edges.
+  const std::vector<std::pair<int, int>> sizes{
+      {10, 10}, {40, 25}, {100, 100}, {150, 120}, {300, 200}};
+  unsigned seed = 1;
+  for (const auto& [num_slots, num_pins] : sizes) {
+    for (int i = 0; i < 3; i++) {
+      const std::vector<std::vector<int>> costs
+          = makeCosts(num_slots, num_pins, seed++);
+      EXPECT_EQ(sparseCost(costs, num_pins), denseCost(costs))
+          << num_slots << " slots, " << num_pins << " pins";
+    }
+  }
+}
+
+TEST(SparseAssignment, matches_hungarian_cost_with_ties)
+{
+  // All pins share one net location, so most costs tie.
+  const int num_slots = 80;
+  const int num_pins = 60;
+  std::vector<std::vector<int>> costs(num_slots, std::vector<int>(num_pins));
+  for (int slot = 0; slot < num_slots; slot++) {
+    for (int pin = 0; pin < num_pins; pin++) {
+      costs[slot][pin] = std::abs(slot - 40) + pin % 3;
+    }
+  }
+  EXPECT_EQ(sparseCost(costs, num_pins), denseCost(costs));
+}
+
+}  // namespace ppl
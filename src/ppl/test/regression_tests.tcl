@@ -27,6 +27,7 @@ record_tests {
   annealing2
   annealing3
   annealing4
+  annealing_multi_start
   annealing_constraint1
   annealing_constraint2
   annealing_constraint3
@@ -32,7 +32,9 @@
 
 #include "ir_solver.h"
 
-#include <Eigen/SparseLU>
+#include <sys/resource.h>
+
+#include <algorithm>
 #include <fstream>
 #include <list>
 #include <queue>
@@ -52,6 +54,44 @@
 
 namespace psm {
 
+namespace {
+
+// Both matrices must be compressed.
+template <typename Matrix>
+bool isSamePattern(const Matrix& a, const Matrix& b)
+{
+  return a.rows() == b.rows() && a.cols() == b.cols()
+         && a.nonZeros() == b.nonZeros()
+         && std::equal(a.outerIndexPtr(),
+                       a.outerIndexPtr() + a.outerSize() + 1,
+                       b.outerIndexPtr())
+         && std::equal(a.innerIndexPtr(),
+                       a.innerIndexPtr() + a.nonZeros(),
+                       b.innerIndexPtr());
+}
+
+template <typename Matrix>
+bool isSameMatrix(const Matrix& a, const Matrix& b)
+{
+  return isSamePattern(a, b)
+         && std::equal(
+             a.valuePtr(), a.valuePtr() + a.nonZeros(), b.valuePtr());
+}
+
+// Peak resident set size of the process in MB
+double getPeakMemory()
+{
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+  return usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+  return usage.ru_maxrss / 1024.0;
+#endif
+}
+
+}  // namespace
+
 IRSolver::IRSolver(
     odb::dbNet* net,
     bool floorplanning,
@@ -858,7 +898,8 @@ void IRSolver::addSourcesToMatrixAndVoltages(
 
 void IRSolver::solve(sta::Corner* corner,
                      GeneratedSourceType source_type,
-                     const std::string& source_file)
+                     const std::string& source_file,
+                     bool use_cg)
 {
   const utl::DebugScopedTimer timer(logger_, utl::PSM, "timer", 1, "Solve: {}");
 
@@ -931,26 +972,78 @@ void IRSolver::solve(sta::Corner* corner,
                              J);
   addSourcesToMatrixAndVoltages(src_voltage, src_nodes, node_index, G, J);
 
-  Eigen::SparseLU<Eigen::SparseMatrix<Connection::Conductance>> eigen_solver;
+  G.makeCompressed();
 
-  debugPrint(logger_, utl::PSM, "solve", 1, "Factorizing the G matrix");
-  eigen_solver.compute(G);
-  if (eigen_solver.info() != Eigen::ComputationInfo::Success) {
-    // decomposition failed
-    if (logger_->debugCheck(utl::PSM, "dump", 1)) {
-      network_->dumpNodes(node_index);
-      dumpMatrix(G, "G");
+  const utl::Timer solve_time;
+  const Eigen::VectorXd V
+      = use_cg ? solveIterative(
+            corner, G, J, real_node_index.size(), src_voltage)
+               : solveDirect(corner, G, J, node_index);
+  debugPrint(logger_,
+             utl::PSM,
+             "stats",
+             1,
+             "Solved {} in {:.3f}s using {}, peak memory {:.1f}MB",
+             net_->getName(),
+             solve_time.elapsed(),
+             use_cg ? "conjugate gradient" : "LU",
+             getPeakMemory());
+
+  if (logger_->debugCheck(utl::PSM, "dump", 2)) {
+    network_->dumpNodes(node_index);
+    dumpMatrix(G, "G");
+    dumpVector(J, "J");
+    dumpVector(V, "V");
+  }
+  for (const auto& [node, node_idx] : real_node_index) {
+    voltages[node] = V[node_idx];
+  }
+  solution_voltages_[corner] = src_voltage;
+}
+
+Eigen::VectorXd IRSolver::solveDirect(
+    sta::Corner* corner,
+    const Matrix& G,
+    const Eigen::VectorXd& J,
+    const std::map<Node*, std::size_t>& node_index)
+{
+  auto& solver = direct_solvers_[corner];
+
+  const bool same_pattern
+      = solver.lu != nullptr && isSamePattern(solver.G, G);
+  if (same_pattern && isSameMatrix(solver.G, G)) {
+    debugPrint(
+        logger_, utl::PSM, "solve", 1, "Reusing factorization of the G matrix");
+  } else {
+    if (!same_pattern) {
+      debugPrint(
+          logger_, utl::PSM, "solve", 1, "Analyzing the G matrix pattern");
+      solver.lu = std::make_unique<Eigen::SparseLU<Matrix>>();
+      solver.lu->analyzePattern(G);
     }
-    logger_->error(
-        utl::PSM,
-        10,
-        "LU factorization of the G Matrix failed. SparseLU solver message: {}.",
-        eigen_solver.lastErrorMessage());
+
+    debugPrint(logger_, utl::PSM, "solve", 1, "Factorizing the G matrix");
+    solver.lu->factorize(G);
+    if (solver.lu->info() != Eigen::ComputationInfo::Success) {
+      // decomposition failed
+      const std::string message = solver.lu->lastErrorMessage();
+      solver.lu.reset();
+      if (logger_->debugCheck(utl::PSM, "dump", 1)) {
+        network_->dumpNodes(node_index);
+        dumpMatrix(G, "G");
+      }
+      logger_->error(utl::PSM,
+                     10,
+                     "LU factorization of the G Matrix failed. SparseLU "
+                     "solver message: {}.",
+                     message);
+    }
+    solver.G = G;
   }
 
   debugPrint(logger_, utl::PSM, "solve", 1, "Solving system of equations GV=J");
-  const Eigen::VectorXd V = eigen_solver.solve(J);
-  if (eigen_solver.info() != Eigen::ComputationInfo::Success) {
+  Eigen::VectorXd V = solver.lu->solve(J);
+  if (solver.lu->info() != Eigen::ComputationInfo::Success) {
     // solving failed
     if (logger_->debugCheck(utl::PSM, "dump", 1)) {
       network_->dumpNodes(node_index);
@@ -965,16 +1058,148 @@ void IRSolver::solve(sta::Corner* corner,
              1,
              "Solving system of equations GV=J complete");
 
-  if (logger_->debugCheck(utl::PSM, "dump", 2)) {
-    network_->dumpNodes(node_index);
-    dumpMatrix(G, "G");
-    dumpVector(J, "J");
-    dumpVector(V, "V");
+  return V;
+}
+
+void IRSolver::buildReducedMatrix(const Matrix& G,
+                                  std::size_t num_real_nodes,
+                                  IterativeSolver& solver) const
+{
+  const utl::DebugScopedTimer timer(
+      logger_, utl::PSM, "timer", 1, "Build reduced G: {}");
+
+  const Eigen::Index num_real = num_real_nodes;
+
+  // Nodes attached to a source are held at the source voltage
+  std::vector<bool> fixed(num_real, false);
+  for (Eigen::Index col = num_real; col < G.outerSize(); col++) {
+    for (Matrix::InnerIterator it(G, col); it; ++it) {
+      if (it.row() < num_real) {
+        fixed[it.row()] = true;
+      }
+    }
   }
-  for (const auto& [node, node_idx] : real_node_index) {
-    voltages[node] = V[node_idx];
+
+  solver.reduced_index.assign(num_real, -1);
+  Eigen::Index num_free = 0;
+  for (Eigen::Index idx = 0; idx < num_real; idx++) {
+    if (!fixed[idx]) {
+      solver.reduced_index[idx] = num_free++;
+    }
   }
-  solution_voltages_[corner] = src_voltage;
+
+  std::vector<Eigen::Triplet<Connection::Conductance>> cond_values;
+  solver.source_coupling = Eigen::VectorXd::Zero(num_free);
+  for (Eigen::Index col = 0; col < num_real; col++) {
+    const Eigen::Index reduced_col = solver.reduced_index[col];
+    for (Matrix::InnerIterator it(G, col); it; ++it) {
+      if (it.row() >= num_real) {
+        continue;
+      }
+      const Eigen::Index reduced_row = solver.reduced_index[it.row()];
+      if (reduced_row < 0) {
+        continue;
+      }
+      if (reduced_col < 0) {
+        solver.source_coupling[reduced_row] += it.value();
+      } else {
+        cond_values.emplace_back(reduced_row, reduced_col, it.value());
+      }
+    }
+  }
+
+  solver.reduced_G.resize(num_free, num_free);
+  solver.reduced_G.setFromTriplets(cond_values.begin(), cond_values.end());
+  solver.reduced_V = Eigen::VectorXd::Zero(num_free);
+
+  debugPrint(logger_,
+             utl::PSM,
+             "stats",
+             1,
+             "Nodes in reduced matrix: {}, fixed by sources: {}",
+             num_free,
+             num_real - num_free);
+}
+
+Eigen::VectorXd IRSolver::solveIterative(sta::Corner* corner,
+                                         const Matrix& G,
+                                         const Eigen::VectorXd& J,
+                                         std::size_t num_real_nodes,
+                                         Voltage src_voltage)
+{
+  auto& solver = iterative_solvers_[corner];
+
+  if (solver.cg != nullptr && isSameMatrix(solver.G, G)) {
+    debugPrint(logger_,
+               utl::PSM,
+               "solve",
+               1,
+               "Reusing preconditioner of the G matrix");
+  } else {
+    buildReducedMatrix(G, num_real_nodes, solver);
+
+    debugPrint(logger_, utl::PSM, "solve", 1, "Preconditioning the G matrix");
+    solver.cg = std::make_unique<CGSolver>();
+    solver.cg->setTolerance(cg_tolerance_);
+    solver.cg->compute(solver.reduced_G);
+    if (solver.cg->info() != Eigen::ComputationInfo::Success) {
+      solver.cg.reset();
+      if (logger_->debugCheck(utl::PSM, "dump", 1)) {
+        dumpMatrix(solver.reduced_G, "G_reduced");
+      }
+      logger_->error(utl::PSM,
+                     13,
+                     "Incomplete Cholesky preconditioning of the G matrix "
+                     "failed.");
+    }
+    solver.G = G;
+  }
+
+  Eigen::VectorXd reduced_J(solver.reduced_G.rows());
+  for (std::size_t idx = 0; idx < num_real_nodes; idx++) {
+    const Eigen::Index reduced_idx = solver.reduced_index[idx];
+    if (reduced_idx >= 0) {
+      reduced_J[reduced_idx] = J[idx];
+    }
+  }
+  reduced_J -= src_voltage * solver.source_coupling;
+
+  debugPrint(logger_,
+             utl::PSM,
+             "solve",
+             1,
+             "Solving system of equations GV=J with conjugate gradient");
+  solver.reduced_V = solver.cg->solveWithGuess(reduced_J, solver.reduced_V);
+  if (solver.cg->info() != Eigen::ComputationInfo::Success) {
+    if (logger_->debugCheck(utl::PSM, "dump", 1)) {
+      dumpMatrix(solver.reduced_G, "G_reduced");
+      dumpVector(reduced_J, "J_reduced");
+    }
+    const Eigen::Index iterations = solver.cg->iterations();
+    const double error = solver.cg->error();
+    solver.cg.reset();
+    logger_->error(utl::PSM,
+                   14,
+                   "Conjugate gradient solver did not converge after {} "
+                   "iterations, estimated error {:.3e}.",
+                   iterations,
+                   error);
+  }
+  debugPrint(logger_,
+             utl::PSM,
+             "solve",
+             1,
+             "Conjugate gradient converged after {} iterations, estimated "
+             "error {:.3e}",
+             solver.cg->iterations(),
+             solver.cg->error());
+
+  Eigen::VectorXd V = Eigen::VectorXd::Zero(G.rows());
+  for (std::size_t idx = 0; idx < num_real_nodes; idx++) {
+    const Eigen::Index reduced_idx = solver.reduced_index[idx];
+    V[idx] = reduced_idx < 0 ? src_voltage : solver.reduced_V[reduced_idx];
+  }
+  return V;
 }
 
 std::map<odb::dbInst*, IRSolver::Power> IRSolver::getInstancePower(
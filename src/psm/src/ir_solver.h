@@ -32,7 +32,9 @@
 
 #pragma once
 
+#include <Eigen/IterativeLinearSolvers>
 #include <Eigen/Sparse>
+#include <Eigen/SparseLU>
 #include <boost/geometry.hpp>
 #include <boost/polygon/polygon.hpp>
 #include <map>
@@ -102,7 +104,8 @@ class IRSolver
 
   void solve(sta::Corner* corner,
              GeneratedSourceType source_type,
-             const std::string& source_file);
+             const std::string& source_file,
+             bool use_cg = false);
 
   void report(sta::Corner* corner) const;
   void reportEM(sta::Corner* corner) const;
@@ -148,6 +151,36 @@ class IRSolver
  private:
   template <typename T>
   using ValueNodeMap = std::map<const Node*, T>;
+  using Matrix = Eigen::SparseMatrix<Connection::Conductance>;
+  using CGSolver
+      = Eigen::ConjugateGradient<Matrix,
+                                 Eigen::Lower | Eigen::Upper,
+                                 Eigen::IncompleteCholesky<double>>;
+
+  // LU factorization of G, kept so that a solve with an unchanged G only
+  // needs the forward/backward substitution and a G with an unchanged
+  // pattern can skip the symbolic analysis.
+  struct DirectSolver
+  {
+    Matrix G;
+    std::unique_ptr<Eigen::SparseLU<Matrix>> lu;
+  };
+
+  // Conjugate gradient solver on the conductance matrix with the nodes fixed
+  // by the sources eliminated, which leaves a symmetric positive definite
+  // system.
+  struct IterativeSolver
+  {
+    Matrix G;
+    Matrix reduced_G;
+    // index of each node in reduced_G, -1 if the node is fixed by a source
+    std::vector<Eigen::Index> reduced_index;
+    // conductance from each free node to the fixed nodes
+    Eigen::VectorXd source_coupling;
+    // last solution, used as the initial guess of the next solve
+    Eigen::VectorXd reduced_V;
+    std::unique_ptr<CGSolver> cg;
+  };
 
   odb::dbBlock* getBlock() const;
   odb::dbTech* getTech() const;
@@ -212,6 +245,19 @@ class IRSolver
       Eigen::SparseMatrix<Connection::Conductance>& G,
       Eigen::VectorXd& J) const;
 
+  Eigen::VectorXd solveDirect(sta::Corner* corner,
+                              const Matrix& G,
+                              const Eigen::VectorXd& J,
+                              const std::map<Node*, std::size_t>& node_index);
+  Eigen::VectorXd solveIterative(sta::Corner* corner,
+                                 const Matrix& G,
+                                 const Eigen::VectorXd& J,
+                                 std::size_t num_real_nodes,
+                                 Voltage src_voltage);
+  void buildReducedMatrix(const Matrix& G,
+                          std::size_t num_real_nodes,
+                          IterativeSolver& solver) const;
+
   std::string getMetricKey(const std::string& key, sta::Corner* corner) const;
 
   void dumpVector(const Eigen::VectorXd& vector, const std::string& name) const;
@@ -243,6 +289,11 @@ class IRSolver
   std::map<sta::Corner*, ValueNodeMap<Voltage>> voltages_;
   std::map<sta::Corner*, ValueNodeMap<Current>> currents_;
 
+  std::map<sta::Corner*, DirectSolver> direct_solvers_;
+  std::map<sta::Corner*, IterativeSolver> iterative_solvers_;
+
+  static constexpr double cg_tolerance_ = 1e-10;
+
   static constexpr Current spice_file_min_current_ = 1e-18;
 };
 
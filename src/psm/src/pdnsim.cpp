@@ -102,7 +102,8 @@ void PDNSim::analyzePowerGrid(odb::dbNet* net,
                               bool enable_em,
                               const std::string& em_file,
                               const std::string& error_file,
-                              const std::string& voltage_source_file)
+                              const std::string& voltage_source_file,
+                              bool use_cg)
 {
   if (!checkConnectivity(net, false, error_file)) {
     return;
@@ -110,7 +111,7 @@ void PDNSim::analyzePowerGrid(odb::dbNet* net,
 
   last_corner_ = corner;
   auto* solver = getIRSolver(net, false);
-  solver->solve(corner, source_type, voltage_source_file);
+  solver->solve(corner, source_type, voltage_source_file, use_cg);
   solver->report(corner);
 
   heatmap_->setNet(net);
@@ -66,13 +66,14 @@ sta::define_cmd_args "analyze_power_grid" {
   [-em_outfile em_file]
   [-vsrc voltage_source_file]
   [-source_type FULL|BUMPS|STRAPS]
+  [-use_cg]
 }
 
 proc analyze_power_grid { args } {
   sta::parse_key_args "analyze_power_grid" args \
     keys {-net -corner -voltage_file -error_file -em_outfile -vsrc \
       -source_type} \
-    flags {-enable_em}
+    flags {-enable_em -use_cg}
   if { ![info exists keys(-net)] } {
     utl::error PSM 58 "Argument -net not specified."
   }
@@ -114,7 +115,8 @@ proc analyze_power_grid { args } {
     $enable_em \
     $em_file \
     $voltage_file \
-    $voltage_source_file
+    $voltage_source_file \
+    [info exists flags(-use_cg)]
 }
 
 sta::define_cmd_args "insert_decap" { -target_cap target_cap\
@@ -118,6 +118,7 @@ class Ext
     int context_depth = 5;
     int cc_model = 10;
     bool lef_res = false;
+    int thread_count = 1;
   };
 
   void extract(ExtractOptions options);
@@ -186,6 +187,7 @@ class Ext
     int spef_corner = -1;
     bool m_map = false;
     bool more_to_read = false;
+    int thread_count = 1;
     float length_unit = 1;
     int fix_loop = 0;
     bool no_cap_num_collapse = false;
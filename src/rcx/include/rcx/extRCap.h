@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <map>
 
 #include "ext2dBox.h"
@@ -1253,6 +1254,9 @@ class extMain
   extMain();
   ~extMain();
 
+  void setThreadCount(int threads) { _threads = std::max(1, threads); }
+  int getThreadCount() const { return _threads; }
+
   void set_debug_nets(const char* nets)
   {
     _debug_net_id = 0;
@@ -1336,11 +1340,13 @@ class extMain
                     odb::Rect& maxRectGs,
                     bool* hasSdbWires,
                     bool& hasGsWires);
-  uint addNetShapesGs(odb::dbNet* net,
+  uint addNetShapesGs(gs* seq,
+                      odb::dbNet* net,
                       bool gsRotated,
                       bool swap_coords,
                       int dir);
-  uint addNetSboxesGs(odb::dbNet* net,
+  uint addNetSboxesGs(gs* seq,
+                      odb::dbNet* net,
                       bool gsRotated,
                       bool swap_coords,
                       int dir);
@@ -1351,7 +1357,8 @@ class extMain
                     uint ccFlag,
                     extMeasure* m,
                     CoupleAndCompute coupleAndCompute);
-  uint initPlanes(uint dir,
+  uint initPlanes(gs* seq,
+                  uint dir,
                   int* wLL,
                   int* wUR,
                   uint layerCnt,
@@ -1633,7 +1640,8 @@ class extMain
                                 uint wtype);
 
   //--------------- Window
-  uint addShapeOnGS(odb::dbNet* net,
+  uint addShapeOnGS(gs* seq,
+                    odb::dbNet* net,
                     uint sId,
                     odb::Rect& r,
                     bool plane,
@@ -2095,6 +2103,8 @@ class extMain
   bool _usingMetalPlanes = false;
 
   gs* _geomSeq = nullptr;
+  // threads used to fill _geomSeq and to break SPEF lines into words
+  int _threads = 1;
 
   AthPool<SEQ>* _seqPool = nullptr;
 
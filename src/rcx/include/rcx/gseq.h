@@ -61,6 +61,10 @@ class gs
   // render a rectangle
   int box(int x0, int y0, int x1, int y1, int slice);
 
+  // OR the pixels of other, which must have the same slice configuration,
+  // into this
+  void merge(const gs& other);
+
   // set the number of slices
   int set_slices(int nslices);
 
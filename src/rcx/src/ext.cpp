@@ -239,6 +239,7 @@ void Ext::extract(ExtractOptions options)
 
   _ext->set_debug_nets(options.debug_net);
   _ext->_lef_res = options.lef_res;
+  _ext->setThreadCount(options.thread_count);
 
   _ext->makeBlockRCsegs(options.net,
                         options.cc_up,
@@ -310,6 +311,7 @@ void Ext::write_spef(const SpefOptions& options)
 void Ext::read_spef(ReadSpefOpts& opt)
 {
   _ext->setBlockFromChip();
+  _ext->setThreadCount(opt.thread_count);
   logger_->info(RCX, 1, "Reading SPEF file: {}", opt.file);
 
   bool stampWire = opt.stamp_wire;
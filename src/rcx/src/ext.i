@@ -84,7 +84,8 @@ extract(const char* ext_model_file,
   opts.lef_res = lef_res;
   opts.debug_net = debug_net_id;
   opts.no_merge_via_res = no_merge_via_res;
-  
+  opts.thread_count = ord::OpenRoad::openRoad()->getThreadCount();
+
   ext->extract(opts);
 }
 
@@ -190,7 +191,8 @@ read_spef(const char* file)
   Ext* ext = getOpenRCX();
   Ext::ReadSpefOpts opts;
   opts.file = file;
-  
+  opts.thread_count = ord::OpenRoad::openRoad()->getThreadCount();
+
   ext->read_spef(opts);
 }
 
@@ -30,7 +30,11 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#include <omp.h>
+
+#include <algorithm>
 #include <map>
+#include <memory>
 #include <vector>
 
 #include "rcx/dbUtil.h"
@@ -929,7 +933,8 @@ uint extMain::getDir(int x1, int y1, int x2, int y2)
   return dd;
 }
 
-uint extMain::addShapeOnGS(dbNet* net,
+uint extMain::addShapeOnGS(gs* seq,
+                           dbNet* net,
                            uint sId,
                            Rect& r,
                            bool plane,
@@ -949,12 +954,12 @@ uint extMain::addShapeOnGS(dbNet* net,
   uint level = layer->getRoutingLevel();
   int n = 0;
   if (!gsRotated) {
-    n = _geomSeq->box(r.xMin(), r.yMin(), r.xMax(), r.yMax(), level);
+    n = seq->box(r.xMin(), r.yMin(), r.xMax(), r.yMax(), level);
   } else {
     if (!swap_coords) {  // horizontal
-      n = _geomSeq->box(r.xMin(), r.yMin(), r.xMax(), r.yMax(), level);
+      n = seq->box(r.xMin(), r.yMin(), r.xMax(), r.yMax(), level);
     } else {
-      n = _geomSeq->box(r.yMin(), r.xMin(), r.yMax(), r.xMax(), level);
+      n = seq->box(r.yMin(), r.xMin(), r.yMax(), r.xMax(), level);
     }
   }
   if (n == 0) {
@@ -963,7 +968,8 @@ uint extMain::addShapeOnGS(dbNet* net,
   return 0;
 }
 
-uint extMain::addNetShapesGs(dbNet* net,
+uint extMain::addNetShapesGs(gs* seq,
+                             dbNet* net,
                              bool gsRotated,
                              bool swap_coords,
                              int dir)
@@ -995,13 +1001,21 @@ uint extMain::addNetShapesGs(dbNet* net,
       this->GetDBcoords2(r);
     }
 
-    cnt += addShapeOnGS(
-        net, shapeId, r, plane, s.getTechLayer(), gsRotated, swap_coords, dir);
+    cnt += addShapeOnGS(seq,
+                        net,
+                        shapeId,
+                        r,
+                        plane,
+                        s.getTechLayer(),
+                        gsRotated,
+                        swap_coords,
+                        dir);
   }
   return cnt;
 }
 
-uint extMain::addNetSboxesGs(dbNet* net,
+uint extMain::addNetSboxesGs(gs* seq,
+                             dbNet* net,
                              bool gsRotated,
                              bool swap_coords,
                              int dir)
@@ -1024,7 +1038,8 @@ uint extMain::addNetSboxesGs(dbNet* net,
       }
 
       Rect r = s->getBox();
-      cnt += addShapeOnGS(nullptr,
+      cnt += addShapeOnGS(seq,
+                          nullptr,
                           s->getId(),
                           r,
                           true,
@@ -1044,7 +1059,8 @@ int extMain::getXY_gs(int base, int XY, uint minRes)
   return v;
 }
 
-uint extMain::initPlanes(uint dir,
+uint extMain::initPlanes(gs* seq,
+                         uint dir,
                          int* wLL,
                          int* wUR,
                          uint layerCnt,
@@ -1055,12 +1071,7 @@ uint extMain::initPlanes(uint dir,
 {
   bool rotatedFlag = getRotatedFlag();
 
-  {
-    delete _geomSeq;
-  }
-  _geomSeq = new gs(_seqPool);
-
-  _geomSeq->set_slices(layerCnt);
+  seq->set_slices(layerCnt);
 
   for (uint ii = 1; ii < layerCnt; ii++) {
     uint layerDir = dirTable[ii];
@@ -1082,18 +1093,18 @@ uint extMain::initPlanes(uint dir,
     ur[dir] = getXY_gs(bb_ll[dir], wUR[dir], res[dir]);
 
     if (!rotatedFlag) {
-      _geomSeq->configureSlice(ii, res[0], res[1], ll[0], ll[1], ur[0], ur[1]);
+      seq->configureSlice(ii, res[0], res[1], ll[0], ll[1], ur[0], ur[1]);
     } else {
       if (dir > 0) {  // horizontal segment extraction
-        _geomSeq->configureSlice(
+        seq->configureSlice(
             ii, res[0], res[1], ll[0], ll[1], ur[0], ur[1]);
       } else {
         if (layerDir > 0) {
-          _geomSeq->configureSlice(
+          seq->configureSlice(
               ii, pitchTable[ii], widthTable[ii], ll[1], ll[0], ur[1], ur[0]);
 
         } else {
-          _geomSeq->configureSlice(
+          seq->configureSlice(
               ii, widthTable[ii], pitchTable[ii], ll[1], ll[0], ur[1], ur[0]);
         }
       }
@@ -1126,37 +1137,82 @@ uint extMain::fill_gs4(int dir,
 {
   bool rotatedGs = getRotatedFlag();
 
-  initPlanes(dir, lo_gs, hi_gs, layerCnt, pitchTable, widthTable, dirTable, ll);
+  delete _geomSeq;
+  _geomSeq = new gs(_seqPool);
+  initPlanes(_geomSeq,
+             dir,
+             lo_gs,
+             hi_gs,
+             layerCnt,
+             pitchTable,
+             widthTable,
+             dirTable,
+             ll);
 
   const int gs_dir = dir;
 
-  uint pcnt = 0;
-  dbSet<dbNet> nets = _block->getNets();
-  dbSet<dbNet>::iterator net_itr;
-
-  for (net_itr = nets.begin(); net_itr != nets.end(); ++net_itr) {
-    dbNet* net = *net_itr;
-
-    if (!((net->getSigType().isSupply()))) {
-      continue;
+  // Power nets are added before signal nets
+  std::vector<dbNet*> nets;
+  for (dbNet* net : _block->getNets()) {
+    if (net->getSigType().isSupply()) {
+      nets.push_back(net);
+    }
+  }
+  const int supplyCnt = nets.size();
+  for (dbNet* net : _block->getNets()) {
+    if (!net->getSigType().isSupply()) {
+      nets.push_back(net);
     }
-
-    pcnt += addNetSboxesGs(net, rotatedGs, !dir, gs_dir);
   }
 
-  uint scnt = 0;
+  const int netCnt = nets.size();
+  constexpr int min_nets_per_thread = 128;
+  const int threads
+      = std::min(_threads, std::max(1, netCnt / min_nets_per_thread));
 
-  for (net_itr = nets.begin(); net_itr != nets.end(); ++net_itr) {
-    dbNet* net = *net_itr;
+  // Each thread paints its share of the nets into a private gs that is ORed
+  // into _geomSeq afterwards, so the planes do not depend on the thread count.
+  std::vector<std::unique_ptr<gs>> threadSeqs(threads);
+  std::vector<uint> threadCnt(threads, 0);
+#pragma omp parallel num_threads(threads)
+  {
+    const int tid = omp_get_thread_num();
+    gs* seq = _geomSeq;
+    if (tid > 0) {
+      threadSeqs[tid] = std::make_unique<gs>(_seqPool);
+      seq = threadSeqs[tid].get();
+      initPlanes(seq,
+                 dir,
+                 lo_gs,
+                 hi_gs,
+                 layerCnt,
+                 pitchTable,
+                 widthTable,
+                 dirTable,
+                 ll);
+    }
 
-    if ((net->getSigType().isSupply())) {
-      continue;
+#pragma omp for schedule(dynamic, 64)
+    for (int ii = 0; ii < netCnt; ii++) {
+      if (ii < supplyCnt) {
+        threadCnt[tid]
+            += addNetSboxesGs(seq, nets[ii], rotatedGs, !dir, gs_dir);
+      } else {
+        threadCnt[tid]
+            += addNetShapesGs(seq, nets[ii], rotatedGs, !dir, gs_dir);
+      }
     }
+  }
 
-    scnt += addNetShapesGs(net, rotatedGs, !dir, gs_dir);
+  uint cnt = 0;
+  for (int tid = 0; tid < threads; tid++) {
+    if (threadSeqs[tid] != nullptr) {
+      _geomSeq->merge(*threadSeqs[tid]);
+    }
+    cnt += threadCnt[tid];
   }
 
-  return pcnt + scnt;
+  return cnt;
 }
 
 uint extMain::couplingFlow(Rect& extRect,
@@ -1313,6 +1369,8 @@ uint extMain::couplingFlow(Rect& extRect,
       processWireCnt += addPowerNets(dir, lo_sdb, hi_sdb, pwrtype);
       processWireCnt += addSignalNets(dir, lo_sdb, hi_sdb, sigtype);
 
+      // The measurement stays on one thread: its callbacks create dbCCSegs
+      // and accumulate rseg caps in odb, and they share extMeasure state.
       uint extractedWireCnt = 0;
       int extractLimit = hiXY - ccDist * maxPitch;
       const int minExtracted = _search->couplingCaps(extractLimit,
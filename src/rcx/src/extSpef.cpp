@@ -1226,6 +1226,7 @@ bool extSpef::setInSpef(const char* filename, const bool onlyOpen)
     _nodeParser = new Ath__parser(logger_);
     _parser = new Ath__parser(logger_);
   }
+  _parser->enableMappedInput(_ext != nullptr ? _ext->getThreadCount() : 1);
   _parser->openFile(filename);
 
   return true;
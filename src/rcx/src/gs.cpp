@@ -30,6 +30,7 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 
@@ -206,6 +207,29 @@ void gs::configureSlice(int _slicenum,
   }
 }
 
+void gs::merge(const gs& other)
+{
+  if (!(init_ & ALLOCATED) || !(other.init_ & ALLOCATED)) {
+    return;
+  }
+
+  const int nslices = std::min(nslices_, other.nslices_);
+  for (int s = 0; s < nslices; s++) {
+    plconfig* dst = pldata_[s];
+    const plconfig* src = other.pldata_[s];
+    if (dst->plane == nullptr || src->plane == nullptr) {
+      continue;
+    }
+
+    const int blocks = dst->height * dst->pixstride + PIXADJUST;
+    for (int b = 0; b < blocks; b++) {
+      dst->plane[b].lword |= src->plane[b].lword;
+    }
+  }
+
+  maxslice_ = std::max(maxslice_, other.maxslice_);
+}
+
 static int clip(const int p, const int min, const int max)
 {
   return (p < min) ? min : (p >= max) ? (max - 1) : p;
@@ -2,7 +2,8 @@ record_tests {
   generate_pattern
   #generate_rules
   ext_pattern
-  gcd 
+  gcd
+  gcd_threads
   45_gcd
   names
   #rcx_man_tcl_check
@@ -44,6 +44,7 @@
 #include "sta/Path.hh"
 #include "sta/UnorderedSet.hh"
 #include "utl/Logger.h"
+#include "utl/NameAllocator.h"
 
 namespace grt {
 class GlobalRouter;
@@ -234,8 +235,10 @@ class Resizer : public dbStaState
   double wireClkCapacitance(const Corner* corner) const;
   double wireClkHCapacitance(const Corner* corner) const;
   double wireClkVCapacitance(const Corner* corner) const;
-  void estimateParasitics(ParasiticsSrc src);
-  void estimateWireParasitics();
+  void estimateParasitics(ParasiticsSrc src, int num_threads = 1);
+  // Steiner trees are built on num_threads threads; parasitics are
+  // annotated on the calling thread.
+  void estimateWireParasitics(int num_threads = 1);
   void estimateWireParasitic(const Net* net);
   void estimateWireParasitic(const Pin* drvr_pin, const Net* net);
   bool haveEstimatedParasitics() const;
@@ -281,7 +284,10 @@ class Resizer : public dbStaState
                    bool skip_pin_swap,
                    bool skip_gate_cloning,
                    bool skip_buffering,
-                   bool skip_buffer_removal);
+                   bool skip_buffer_removal,
+                   bool parallel_sizing,
+                   int num_threads = 1);
+  int parallelSizingResizeCount() const;
   // For testing.
   void repairSetup(const Pin* end_pin);
   // For testing.
@@ -487,7 +493,9 @@ class Resizer : public dbStaState
                   const DcalcAnalysisPt* dcalc_ap,
                   // Return values.
                   ArcDelay delays[RiseFall::index_count],
-                  Slew slews[RiseFall::index_count]);
+                  Slew slews[RiseFall::index_count],
+                  // Defaults to arc_delay_calc_.
+                  sta::ArcDelayCalc* arc_delay_calc = nullptr);
   void gateDelays(const LibertyPort* drvr_port,
                   float load_cap,
                   const Slew in_slews[RiseFall::index_count],
@@ -497,7 +505,8 @@ class Resizer : public dbStaState
                   Slew out_slews[RiseFall::index_count]);
   ArcDelay gateDelay(const LibertyPort* drvr_port,
                      float load_cap,
-                     const DcalcAnalysisPt* dcalc_ap);
+                     const DcalcAnalysisPt* dcalc_ap,
+                     sta::ArcDelayCalc* arc_delay_calc = nullptr);
   ArcDelay gateDelay(const LibertyPort* drvr_port,
                      const RiseFall* rf,
                      float load_cap,
@@ -527,6 +536,7 @@ class Resizer : public dbStaState
                          double wire_length,  // meters
                          const Corner* corner,
                          Parasitics* parasitics);
+  void indexNames();
   string makeUniqueNetName();
   Net* makeUniqueNet();
   string makeUniqueInstName(const char* base_name);
@@ -562,6 +572,8 @@ class Resizer : public dbStaState
   void ensureWireParasitic(const Pin* drvr_pin);
   void ensureWireParasitic(const Pin* drvr_pin, const Net* net);
   void estimateWireParasiticSteiner(const Pin* drvr_pin, const Net* net);
+  void estimateWireParasiticsParallel(int num_threads);
+  void makeSteinerParasitic(const Net* net, SteinerTree* tree);
   float totalLoad(SteinerTree* tree) const;
   float subtreeLoad(SteinerTree* tree,
                     float cap_per_micron,
@@ -700,6 +712,11 @@ class Resizer : public dbStaState
   InstanceSet resized_multi_output_insts_;
   int unique_net_index_ = 1;
   int unique_inst_index_ = 1;
+  // Existing numbered names of names_block_, so new ones are found without
+  // probing the network for every taken index.
+  dbBlock* names_block_ = nullptr;
+  utl::NameAllocator net_names_;
+  utl::NameAllocator inst_names_;
   int resize_count_ = 0;
   int inserted_buffer_count_ = 0;
   int cloned_gate_count_ = 0;
@@ -45,6 +45,7 @@
 #include "sta/Sdc.hh"
 #include "sta/Units.hh"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 namespace rsz {
 
@@ -271,11 +272,11 @@ void Resizer::ensureParasitics()
                          : ParasiticsSrc::placement);
 }
 
-void Resizer::estimateParasitics(ParasiticsSrc src)
+void Resizer::estimateParasitics(ParasiticsSrc src, int num_threads)
 {
   switch (src) {
     case ParasiticsSrc::placement:
-      estimateWireParasitics();
+      estimateWireParasitics(num_threads);
       break;
     case ParasiticsSrc::global_routing:
       global_router_->estimateRC();
@@ -386,7 +387,7 @@ void Resizer::ensureWireParasitic(const Pin* drvr_pin, const Net* net)
 
 ////////////////////////////////////////////////////////////////
 
-void Resizer::estimateWireParasitics()
+void Resizer::estimateWireParasitics(int num_threads)
 {
   initBlock();
   if (!wire_signal_cap_.empty()) {
@@ -394,18 +395,83 @@ void Resizer::estimateWireParasitics()
     // Make separate parasitics for each corner, same for min/max.
     sta_->setParasiticAnalysisPts(true);
 
-    NetIterator* net_iter = network_->netIterator(network_->topInstance());
-    while (net_iter->hasNext()) {
-      Net* net = net_iter->next();
-      estimateWireParasitic(net);
+    if (num_threads > 1) {
+      estimateWireParasiticsParallel(num_threads);
+    } else {
+      NetIterator* net_iter = network_->netIterator(network_->topInstance());
+      while (net_iter->hasNext()) {
+        Net* net = net_iter->next();
+        estimateWireParasitic(net);
+      }
+      delete net_iter;
     }
-    delete net_iter;
 
     parasitics_src_ = ParasiticsSrc::placement;
     parasitics_invalid_.clear();
   }
 }
 
+// The Steiner trees of a batch of nets are built in parallel. The STA
+// parasitics are not thread safe, so the parasitic networks are made and
+// reduced serially from the trees afterwards.
+void Resizer::estimateWireParasiticsParallel(int num_threads)
+{
+  // Bounds the number of trees held at once.
+  constexpr int batch_size = 10000;
+  vector<std::pair<const Pin*, const Net*>> drvr_nets;
+  vector<SteinerTree*> trees;
+
+  auto estimate_batch = [&]() {
+    const int net_count = drvr_nets.size();
+    trees.assign(net_count, nullptr);
+    utl::ThreadException exception;
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+    for (int i = 0; i < net_count; i++) {
+      try {
+        trees[i] = makeSteinerTree(drvr_nets[i].first);
+      } catch (...) {
+        exception.capture();
+      }
+    }
+    exception.rethrow();
+
+    for (int i = 0; i < net_count; i++) {
+      if (trees[i]) {
+        makeSteinerParasitic(drvr_nets[i].second, trees[i]);
+        delete trees[i];
+      }
+    }
+    drvr_nets.clear();
+  };
+
+  NetIterator* net_iter = network_->netIterator(network_->topInstance());
+  while (net_iter->hasNext()) {
+    const Net* net = net_iter->next();
+    // Driver lookup caches in the network so it stays on this thread.
+    PinSet* drivers = network_->drivers(net);
+    if (drivers == nullptr || drivers->empty()) {
+      continue;
+    }
+    PinSet::Iterator drvr_iter(drivers);
+    const Pin* drvr_pin = drvr_iter.next();
+    if (network_->isPower(net) || network_->isGround(net)
+        || sta_->isIdealClock(drvr_pin)
+        || db_network_->staToDb(net)->isSpecial()) {
+      continue;
+    }
+    if (isPadNet(net)) {
+      makePadParasitic(net);
+    } else {
+      drvr_nets.emplace_back(drvr_pin, net);
+      if (drvr_nets.size() == batch_size) {
+        estimate_batch();
+      }
+    }
+  }
+  delete net_iter;
+  estimate_batch();
+}
+
 void Resizer::estimateWireParasitic(const Net* net)
 {
   PinSet* drivers = network_->drivers(net);
@@ -467,86 +533,91 @@ void Resizer::estimateWireParasiticSteiner(const Pin* drvr_pin, const Net* net)
 {
   SteinerTree* tree = makeSteinerTree(drvr_pin);
   if (tree) {
-    debugPrint(logger_,
-               RSZ,
-               "resizer_parasitics",
-               1,
-               "estimate wire {}",
-               sdc_network_->pathName(net));
-    for (Corner* corner : *sta_->corners()) {
-      const ParasiticAnalysisPt* parasitics_ap
-          = corner->findParasiticAnalysisPt(max_);
-      Parasitic* parasitic
-          = sta_->makeParasiticNetwork(net, false, parasitics_ap);
-      bool is_clk = global_router_->isNonLeafClock(db_network_->staToDb(net));
-      double wire_cap = 0.0;
-      double wire_res = 0.0;
-      int branch_count = tree->branchCount();
-      size_t resistor_id = 1;
-      for (int i = 0; i < branch_count; i++) {
-        Point pt1, pt2;
-        SteinerPt steiner_pt1, steiner_pt2;
-        int wire_length_dbu;
-        tree->branch(i, pt1, steiner_pt1, pt2, steiner_pt2, wire_length_dbu);
-        if (wire_length_dbu) {
-          double dx = dbuToMeters(abs(pt1.x() - pt2.x()))
-                      / dbuToMeters(wire_length_dbu);
-          double dy = dbuToMeters(abs(pt1.y() - pt2.y()))
-                      / dbuToMeters(wire_length_dbu);
-
-          if (is_clk) {
-            wire_cap = dx * wireClkHCapacitance(corner)
-                       + dy * wireClkVCapacitance(corner);
-            wire_res = dx * wireClkHResistance(corner)
-                       + dy * wireClkVResistance(corner);
-          } else {
-            wire_cap = dx * wireSignalHCapacitance(corner)
-                       + dy * wireSignalVCapacitance(corner);
-            wire_res = dx * wireSignalHResistance(corner)
-                       + dy * wireSignalVResistance(corner);
-          }
-        } else {
-          wire_cap = is_clk ? wireClkCapacitance(corner)
-                            : wireSignalCapacitance(corner);
-          wire_res = is_clk ? wireClkResistance(corner)
-                            : wireSignalResistance(corner);
-        }
-        ParasiticNode* n1 = parasitics_->ensureParasiticNode(
-            parasitic, net, steiner_pt1, network_);
-        ParasiticNode* n2 = parasitics_->ensureParasiticNode(
-            parasitic, net, steiner_pt2, network_);
-        if (wire_length_dbu == 0) {
-          // Use a small resistor to keep the connectivity intact.
-          parasitics_->makeResistor(parasitic, resistor_id++, 1.0e-3, n1, n2);
+    makeSteinerParasitic(net, tree);
+    delete tree;
+  }
+}
+
+void Resizer::makeSteinerParasitic(const Net* net, SteinerTree* tree)
+{
+  debugPrint(logger_,
+             RSZ,
+             "resizer_parasitics",
+             1,
+             "estimate wire {}",
+             sdc_network_->pathName(net));
+  for (Corner* corner : *sta_->corners()) {
+    const ParasiticAnalysisPt* parasitics_ap
+        = corner->findParasiticAnalysisPt(max_);
+    Parasitic* parasitic
+        = sta_->makeParasiticNetwork(net, false, parasitics_ap);
+    bool is_clk = global_router_->isNonLeafClock(db_network_->staToDb(net));
+    double wire_cap = 0.0;
+    double wire_res = 0.0;
+    int branch_count = tree->branchCount();
+    size_t resistor_id = 1;
+    for (int i = 0; i < branch_count; i++) {
+      Point pt1, pt2;
+      SteinerPt steiner_pt1, steiner_pt2;
+      int wire_length_dbu;
+      tree->branch(i, pt1, steiner_pt1, pt2, steiner_pt2, wire_length_dbu);
+      if (wire_length_dbu) {
+        double dx = dbuToMeters(abs(pt1.x() - pt2.x()))
+                    / dbuToMeters(wire_length_dbu);
+        double dy = dbuToMeters(abs(pt1.y() - pt2.y()))
+                    / dbuToMeters(wire_length_dbu);
+
+        if (is_clk) {
+          wire_cap = dx * wireClkHCapacitance(corner)
+                     + dy * wireClkVCapacitance(corner);
+          wire_res = dx * wireClkHResistance(corner)
+                     + dy * wireClkVResistance(corner);
         } else {
-          double length = dbuToMeters(wire_length_dbu);
-          double cap = length * wire_cap;
-          double res = length * wire_res;
-          // Make pi model for the wire.
-          debugPrint(logger_,
-                     RSZ,
-                     "resizer_parasitics",
-                     2,
-                     " pi {} l={} c2={} rpi={} c1={} {}",
-                     parasitics_->name(n1),
-                     units_->distanceUnit()->asString(length),
-                     units_->capacitanceUnit()->asString(cap / 2.0),
-                     units_->resistanceUnit()->asString(res),
-                     units_->capacitanceUnit()->asString(cap / 2.0),
-                     parasitics_->name(n2));
-          parasitics_->incrCap(n1, cap / 2.0);
-          parasitics_->makeResistor(parasitic, resistor_id++, res, n1, n2);
-          parasitics_->incrCap(n2, cap / 2.0);
+          wire_cap = dx * wireSignalHCapacitance(corner)
+                     + dy * wireSignalVCapacitance(corner);
+          wire_res = dx * wireSignalHResistance(corner)
+                     + dy * wireSignalVResistance(corner);
         }
-        parasiticNodeConnectPins(parasitic, n1, tree, steiner_pt1, resistor_id);
-        parasiticNodeConnectPins(parasitic, n2, tree, steiner_pt2, resistor_id);
+      } else {
+        wire_cap = is_clk ? wireClkCapacitance(corner)
+                          : wireSignalCapacitance(corner);
+        wire_res = is_clk ? wireClkResistance(corner)
+                          : wireSignalResistance(corner);
       }
-      arc_delay_calc_->reduceParasitic(
-          parasitic, net, corner, sta::MinMaxAll::all());
+      ParasiticNode* n1 = parasitics_->ensureParasiticNode(
+          parasitic, net, steiner_pt1, network_);
+      ParasiticNode* n2 = parasitics_->ensureParasiticNode(
+          parasitic, net, steiner_pt2, network_);
+      if (wire_length_dbu == 0) {
+        // Use a small resistor to keep the connectivity intact.
+        parasitics_->makeResistor(parasitic, resistor_id++, 1.0e-3, n1, n2);
+      } else {
+        double length = dbuToMeters(wire_length_dbu);
+        double cap = length * wire_cap;
+        double res = length * wire_res;
+        // Make pi model for the wire.
+        debugPrint(logger_,
+                   RSZ,
+                   "resizer_parasitics",
+                   2,
+                   " pi {} l={} c2={} rpi={} c1={} {}",
+                   parasitics_->name(n1),
+                   units_->distanceUnit()->asString(length),
+                   units_->capacitanceUnit()->asString(cap / 2.0),
+                   units_->resistanceUnit()->asString(res),
+                   units_->capacitanceUnit()->asString(cap / 2.0),
+                   parasitics_->name(n2));
+        parasitics_->incrCap(n1, cap / 2.0);
+        parasitics_->makeResistor(parasitic, resistor_id++, res, n1, n2);
+        parasitics_->incrCap(n2, cap / 2.0);
+      }
+      parasiticNodeConnectPins(parasitic, n1, tree, steiner_pt1, resistor_id);
+      parasiticNodeConnectPins(parasitic, n2, tree, steiner_pt2, resistor_id);
     }
-    parasitics_->deleteParasiticNetworks(net);
-    delete tree;
+    arc_delay_calc_->reduceParasitic(
+        parasitic, net, corner, sta::MinMaxAll::all());
   }
+  parasitics_->deleteParasiticNetworks(net);
 }
 
 float Resizer::pinCapacitance(const Pin* pin,
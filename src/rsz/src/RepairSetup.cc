@@ -35,9 +35,13 @@
 
 #include "RepairSetup.hh"
 
+#include <omp.h>
+
 #include <sstream>
+#include <unordered_set>
 
 #include "rsz/Resizer.hh"
+#include "sta/ArcDelayCalc.hh"
 #include "sta/Corner.hh"
 #include "sta/DcalcAnalysisPt.hh"
 #include "sta/Fuzzy.hh"
@@ -93,13 +97,16 @@ void RepairSetup::repairSetup(const float setup_slack_margin,
                               const bool skip_pin_swap,
                               const bool skip_gate_cloning,
                               const bool skip_buffering,
-                              const bool skip_buffer_removal)
+                              const bool skip_buffer_removal,
+                              const bool parallel_sizing,
+                              const int num_threads)
 {
   init();
   constexpr int digits = 3;
   inserted_buffer_count_ = 0;
   split_load_buffer_count_ = 0;
   resize_count_ = 0;
+  parallel_resize_count_ = 0;
   cloned_gate_count_ = 0;
   removed_buffer_count_ = 0;
   resizer_->buffer_moved_into_core_ = false;
@@ -164,6 +171,10 @@ void RepairSetup::repairSetup(const float setup_slack_margin,
   sta_->checkFanoutLimitPreamble();
 
   resizer_->incrementalParasiticsBegin();
+  if (parallel_sizing) {
+    repairSetupParallel(
+        setup_slack_margin, repair_tns_end_percent, max_passes, num_threads);
+  }
   int opto_iteration = 0;
   bool prev_termination = false;
   bool two_cons_terminations = false;
@@ -1106,45 +1117,279 @@ LibertyCell* RepairSetup::upsizeCell(LibertyPort* in_port,
   LibertyCell* cell = drvr_port->libertyCell();
   LibertyCellSeq* equiv_cells = sta_->equivCells(cell);
   if (equiv_cells) {
-    const char* in_port_name = in_port->name();
-    const char* drvr_port_name = drvr_port->name();
-    sort(equiv_cells, [=](const LibertyCell* cell1, const LibertyCell* cell2) {
-      LibertyPort* port1
-          = cell1->findLibertyPort(drvr_port_name)->cornerPort(lib_ap);
-      LibertyPort* port2
-          = cell2->findLibertyPort(drvr_port_name)->cornerPort(lib_ap);
-      const float drive1 = port1->driveResistance();
-      const float drive2 = port2->driveResistance();
-      const ArcDelay intrinsic1 = port1->intrinsicDelay(this);
-      const ArcDelay intrinsic2 = port2->intrinsicDelay(this);
-      return drive1 > drive2
-             || ((drive1 == drive2 && intrinsic1 < intrinsic2)
-                 || (intrinsic1 == intrinsic2
-                     && port1->capacitance() < port2->capacitance()));
-    });
-    const float drive = drvr_port->cornerPort(lib_ap)->driveResistance();
-    const float delay
-        = resizer_->gateDelay(drvr_port, load_cap, resizer_->tgt_slew_dcalc_ap_)
-          + prev_drive * in_port->cornerPort(lib_ap)->capacitance();
-
-    for (LibertyCell* equiv : *equiv_cells) {
-      LibertyCell* equiv_corner = equiv->cornerCell(lib_ap);
-      LibertyPort* equiv_drvr = equiv_corner->findLibertyPort(drvr_port_name);
-      LibertyPort* equiv_input = equiv_corner->findLibertyPort(in_port_name);
-      const float equiv_drive = equiv_drvr->driveResistance();
-      // Include delay of previous driver into equiv gate.
-      const float equiv_delay
-          = resizer_->gateDelay(equiv_drvr, load_cap, dcalc_ap)
-            + prev_drive * equiv_input->capacitance();
-      if (!resizer_->dontUse(equiv) && equiv_drive < drive
-          && equiv_delay < delay) {
-        return equiv;
-      }
+    sortUpsizeCells(*equiv_cells, drvr_port->name(), lib_ap);
+    float delay_gain;
+    return selectUpsizeCell(*equiv_cells,
+                            in_port,
+                            drvr_port,
+                            load_cap,
+                            prev_drive,
+                            dcalc_ap,
+                            arc_delay_calc_,
+                            delay_gain);
+  }
+  return nullptr;
+}
+
+void RepairSetup::sortUpsizeCells(LibertyCellSeq& cells,
+                                  const char* drvr_port_name,
+                                  const int lib_ap) const
+{
+  sort(&cells, [=](const LibertyCell* cell1, const LibertyCell* cell2) {
+    LibertyPort* port1
+        = cell1->findLibertyPort(drvr_port_name)->cornerPort(lib_ap);
+    LibertyPort* port2
+        = cell2->findLibertyPort(drvr_port_name)->cornerPort(lib_ap);
+    const float drive1 = port1->driveResistance();
+    const float drive2 = port2->driveResistance();
+    const ArcDelay intrinsic1 = port1->intrinsicDelay(this);
+    const ArcDelay intrinsic2 = port2->intrinsicDelay(this);
+    return drive1 > drive2
+           || ((drive1 == drive2 && intrinsic1 < intrinsic2)
+               || (intrinsic1 == intrinsic2
+                   && port1->capacitance() < port2->capacitance()));
+  });
+}
+
+// Returns the first of the sorted cells that is stronger and faster than
+// the driver's current cell. Only reads timing, so it is safe to call from
+// several threads given one arc_delay_calc per thread.
+LibertyCell* RepairSetup::selectUpsizeCell(const LibertyCellSeq& cells,
+                                           LibertyPort* in_port,
+                                           LibertyPort* drvr_port,
+                                           const float load_cap,
+                                           const float prev_drive,
+                                           const DcalcAnalysisPt* dcalc_ap,
+                                           sta::ArcDelayCalc* arc_delay_calc,
+                                           float& delay_gain)
+{
+  const int lib_ap = dcalc_ap->libertyIndex();
+  const char* in_port_name = in_port->name();
+  const char* drvr_port_name = drvr_port->name();
+  const float drive = drvr_port->cornerPort(lib_ap)->driveResistance();
+  const float delay
+      = resizer_->gateDelay(
+            drvr_port, load_cap, resizer_->tgt_slew_dcalc_ap_, arc_delay_calc)
+        + prev_drive * in_port->cornerPort(lib_ap)->capacitance();
+
+  for (LibertyCell* equiv : cells) {
+    LibertyCell* equiv_corner = equiv->cornerCell(lib_ap);
+    LibertyPort* equiv_drvr = equiv_corner->findLibertyPort(drvr_port_name);
+    LibertyPort* equiv_input = equiv_corner->findLibertyPort(in_port_name);
+    const float equiv_drive = equiv_drvr->driveResistance();
+    // Include delay of previous driver into equiv gate.
+    const float equiv_delay
+        = resizer_->gateDelay(equiv_drvr, load_cap, dcalc_ap, arc_delay_calc)
+          + prev_drive * equiv_input->capacitance();
+    if (!resizer_->dontUse(equiv) && equiv_drive < drive
+        && equiv_delay < delay) {
+      delay_gain = delay - equiv_delay;
+      return equiv;
     }
   }
   return nullptr;
 }
 
+// Upsizes drivers on the worst paths of many violating endpoints per pass.
+// The candidates are scored on all threads against the current timing, each
+// thread with its own delay calculator. They are committed largest gain
+// first, skipping drivers next to one already resized in the pass since
+// their score assumed the old neighbor. A pass that makes WNS or TNS worse
+// is undone and ends the search; the serial repair continues from there.
+void RepairSetup::repairSetupParallel(const float setup_slack_margin,
+                                      const double repair_tns_end_percent,
+                                      const int max_passes,
+                                      const int num_threads)
+{
+  const int thread_count = max(1, num_threads);
+  vector<sta::ArcDelayCalc*> arc_delay_calcs;
+  for (int i = 0; i < thread_count; i++) {
+    arc_delay_calcs.push_back(arc_delay_calc_->copy());
+  }
+
+  Slack prev_worst_slack = sta_->worstSlack(max_);
+  float prev_tns = sta_->totalNegativeSlack(max_);
+  for (int pass = 1; pass <= max_passes; pass++) {
+    vector<pair<Vertex*, Slack>> violating_ends;
+    for (Vertex* end : *sta_->endpoints()) {
+      const Slack end_slack = sta_->vertexSlack(end, max_);
+      if (end_slack < setup_slack_margin) {
+        violating_ends.emplace_back(end, end_slack);
+      }
+    }
+    if (violating_ends.empty()) {
+      break;
+    }
+    std::stable_sort(violating_ends.begin(),
+                     violating_ends.end(),
+                     [](const auto& end_slack1, const auto& end_slack2) {
+                       return end_slack1.second < end_slack2.second;
+                     });
+    const int end_count
+        = max(1, int(violating_ends.size() * repair_tns_end_percent));
+
+    vector<UpsizeCandidate> candidates;
+    findUpsizeCandidates(violating_ends, end_count, candidates);
+
+    const int candidate_count = candidates.size();
+#pragma omp parallel for schedule(dynamic) num_threads(thread_count)
+    for (int i = 0; i < candidate_count; i++) {
+      UpsizeCandidate& cand = candidates[i];
+      LibertyCellSeq* equiv_cells
+          = sta_->equivCells(cand.drvr_port->libertyCell());
+      if (equiv_cells) {
+        // Sort a copy; the shared list is read by the other threads.
+        LibertyCellSeq cells = *equiv_cells;
+        sortUpsizeCells(
+            cells, cand.drvr_port->name(), cand.dcalc_ap->libertyIndex());
+        cand.upsize = selectUpsizeCell(cells,
+                                       cand.in_port,
+                                       cand.drvr_port,
+                                       cand.load_cap,
+                                       cand.prev_drive,
+                                       cand.dcalc_ap,
+                                       arc_delay_calcs[omp_get_thread_num()],
+                                       cand.delay_gain);
+      }
+    }
+
+    std::stable_sort(candidates.begin(),
+                     candidates.end(),
+                     [](const UpsizeCandidate& cand1,
+                        const UpsizeCandidate& cand2) {
+                       return cand1.delay_gain > cand2.delay_gain;
+                     });
+    resizer_->journalBegin();
+    // Drivers resized in this pass and their neighbors. A missing neighbor
+    // (top level port or path end) is null and never blocks a candidate.
+    std::unordered_set<const Instance*> resized;
+    auto is_resized = [&](const Instance* inst) {
+      return inst != nullptr && resized.count(inst) > 0;
+    };
+    auto mark_resized = [&](const Instance* inst) {
+      if (inst != nullptr) {
+        resized.insert(inst);
+      }
+    };
+    int resize_count = 0;
+    for (const UpsizeCandidate& cand : candidates) {
+      if (cand.upsize == nullptr || is_resized(cand.drvr)
+          || is_resized(cand.prev_drvr) || is_resized(cand.next_drvr)) {
+        continue;
+      }
+      if (resizer_->replaceCell(cand.drvr, cand.upsize, true)) {
+        resize_count_++;
+        parallel_resize_count_++;
+        resize_count++;
+        mark_resized(cand.drvr);
+        mark_resized(cand.prev_drvr);
+        mark_resized(cand.next_drvr);
+      }
+    }
+    if (resize_count == 0) {
+      break;
+    }
+
+    resizer_->updateParasitics();
+    sta_->findRequireds();
+    const Slack worst_slack = sta_->worstSlack(max_);
+    const float tns = sta_->totalNegativeSlack(max_);
+    debugPrint(logger_,
+               RSZ,
+               "repair_setup",
+               1,
+               "parallel sizing pass {} endpoints {} resized {}/{} wns {} "
+               "tns {}",
+               pass,
+               end_count,
+               resize_count,
+               candidate_count,
+               delayAsString(worst_slack, sta_, 3),
+               delayAsString(tns, sta_, 3));
+    if (fuzzyLess(worst_slack, prev_worst_slack) || fuzzyLess(tns, prev_tns)) {
+      parallel_resize_count_ -= resize_count;
+      resizer_->journalRestore(resize_count_,
+                               inserted_buffer_count_,
+                               cloned_gate_count_,
+                               removed_buffer_count_);
+      resizer_->updateParasitics();
+      sta_->findRequireds();
+      break;
+    }
+    if (!fuzzyGreater(tns, prev_tns) || resizer_->overMaxArea()) {
+      break;
+    }
+    prev_worst_slack = worst_slack;
+    prev_tns = tns;
+  }
+
+  for (sta::ArcDelayCalc* arc_delay_calc : arc_delay_calcs) {
+    delete arc_delay_calc;
+  }
+}
+
+// Collects one upsize candidate per driver instance on the worst paths of
+// the first end_count violating endpoints.
+void RepairSetup::findUpsizeCandidates(
+    const vector<pair<Vertex*, Slack>>& violating_ends,
+    const int end_count,
+    vector<UpsizeCandidate>& candidates)
+{
+  std::unordered_set<const Instance*> drvrs;
+  const int max_end_count = std::min(end_count, int(violating_ends.size()));
+  for (int end_index = 0; end_index < max_end_count; end_index++) {
+    PathRef path = sta_->vertexWorstSlackPath(violating_ends[end_index].first,
+                                              max_);
+    PathExpanded expanded(&path, sta_);
+    const int path_length = expanded.size();
+    if (path_length <= 1) {
+      continue;
+    }
+    const DcalcAnalysisPt* dcalc_ap = path.dcalcAnalysisPt(sta_);
+    auto stage_drvr = [&](const int index) -> Instance* {
+      if (index < 0 || index >= path_length) {
+        return nullptr;
+      }
+      const Pin* pin = expanded.path(index)->pin(sta_);
+      return network_->isTopLevelPort(pin) ? nullptr : network_->instance(pin);
+    };
+    for (int i = max(1, expanded.startIndex()); i < path_length; i++) {
+      const Pin* drvr_pin = expanded.path(i)->pin(sta_);
+      if (!network_->isDriver(drvr_pin) || network_->isTopLevelPort(drvr_pin)) {
+        continue;
+      }
+      Instance* drvr = network_->instance(drvr_pin);
+      if (resizer_->dontTouch(drvr) || !drvrs.insert(drvr).second) {
+        continue;
+      }
+      LibertyPort* drvr_port = network_->libertyPort(drvr_pin);
+      LibertyPort* in_port
+          = network_->libertyPort(expanded.path(i - 1)->pin(sta_));
+      if (drvr_port == nullptr || in_port == nullptr) {
+        continue;
+      }
+      float prev_drive = 0.0;
+      if (i >= 2) {
+        LibertyPort* prev_drvr_port
+            = network_->libertyPort(expanded.path(i - 2)->pin(sta_));
+        if (prev_drvr_port) {
+          prev_drive = prev_drvr_port->driveResistance();
+        }
+      }
+      UpsizeCandidate cand;
+      cand.drvr = drvr;
+      cand.prev_drvr = stage_drvr(i - 2);
+      cand.next_drvr = stage_drvr(i + 2);
+      cand.in_port = in_port;
+      cand.drvr_port = drvr_port;
+      cand.load_cap = graph_delay_calc_->loadCap(drvr_pin, dcalc_ap);
+      cand.prev_drive = prev_drive;
+      cand.dcalc_ap = dcalc_ap;
+      candidates.push_back(cand);
+    }
+  }
+}
+
 Point RepairSetup::computeCloneGateLocation(
     const Pin* drvr_pin,
     const vector<pair<Vertex*, Slack>>& fanout_slacks)
@@ -120,6 +120,22 @@ struct OptoParams
   }
 };
 
+// Driver upsize on a violating path, scored against a timing snapshot.
+struct UpsizeCandidate
+{
+  Instance* drvr;
+  // Neighbor stages whose delays the resize also changes.
+  Instance* prev_drvr;
+  Instance* next_drvr;
+  LibertyPort* in_port;
+  LibertyPort* drvr_port;
+  float load_cap;
+  float prev_drive;
+  const DcalcAnalysisPt* dcalc_ap;
+  LibertyCell* upsize = nullptr;
+  float delay_gain = 0.0;
+};
+
 class RepairSetup : public sta::dbStaState
 {
  public:
@@ -133,7 +149,9 @@ class RepairSetup : public sta::dbStaState
                    bool skip_pin_swap,
                    bool skip_gate_cloning,
                    bool skip_buffering,
-                   bool skip_buffer_removal);
+                   bool skip_buffer_removal,
+                   bool parallel_sizing,
+                   int num_threads);
   // For testing.
   void repairSetup(const Pin* end_pin);
   // For testing.
@@ -141,6 +159,8 @@ class RepairSetup : public sta::dbStaState
   // Rebuffer one net (for testing).
   // resizerPreamble() required.
   void rebufferNet(const Pin* drvr_pin);
+  // Instances resized by the parallel sizing pass of the last repair.
+  int parallelSizingResizeCount() const { return parallel_resize_count_; }
 
  private:
   void init();
@@ -198,6 +218,25 @@ class RepairSetup : public sta::dbStaState
                           float load_cap,
                           float prev_drive,
                           const DcalcAnalysisPt* dcalc_ap);
+  void sortUpsizeCells(sta::LibertyCellSeq& cells,
+                       const char* drvr_port_name,
+                       int lib_ap) const;
+  LibertyCell* selectUpsizeCell(const sta::LibertyCellSeq& cells,
+                                LibertyPort* in_port,
+                                LibertyPort* drvr_port,
+                                float load_cap,
+                                float prev_drive,
+                                const DcalcAnalysisPt* dcalc_ap,
+                                sta::ArcDelayCalc* arc_delay_calc,
+                                // Return value.
+                                float& delay_gain);
+  void repairSetupParallel(float setup_slack_margin,
+                           double repair_tns_end_percent,
+                           int max_passes,
+                           int num_threads);
+  void findUpsizeCandidates(const vector<pair<Vertex*, Slack>>& violating_ends,
+                            int end_count,
+                            vector<UpsizeCandidate>& candidates);
   int fanout(Vertex* vertex);
   bool hasTopLevelOutputPort(Net* net);
 
@@ -232,6 +271,7 @@ class RepairSetup : public sta::dbStaState
   LibertyPort* drvr_port_ = nullptr;
 
   int resize_count_ = 0;
+  int parallel_resize_count_ = 0;
   int inserted_buffer_count_ = 0;
   int split_load_buffer_count_ = 0;
   int rebuffer_net_count_ = 0;
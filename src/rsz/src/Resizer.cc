@@ -2087,14 +2087,31 @@ PinSet* Resizer::findFloatingPins()
 
 ////////////////////////////////////////////////////////////////
 
+void Resizer::indexNames()
+{
+  dbBlock* block = db_->getChip()->getBlock();
+  if (block == names_block_) {
+    return;
+  }
+  names_block_ = block;
+  net_names_.clear();
+  inst_names_.clear();
+  for (dbNet* net : block->getNets()) {
+    net_names_.addName(net->getName());
+  }
+  for (dbInst* inst : block->getInsts()) {
+    inst_names_.addName(inst->getName());
+  }
+}
+
 string Resizer::makeUniqueNetName()
 {
-  string node_name;
+  indexNames();
   Instance* top_inst = network_->topInstance();
-  do {
-    stringPrint(node_name, "net%d", unique_net_index_++);
-  } while (network_->findNet(top_inst, node_name.c_str()));
-  return node_name;
+  return net_names_.makeName(
+      "net", unique_net_index_, [&](const string& name) {
+        return network_->findNet(top_inst, name.c_str()) != nullptr;
+      });
 }
 
 Net* Resizer::makeUniqueNet()
@@ -2111,14 +2128,12 @@ string Resizer::makeUniqueInstName(const char* base_name)
 
 string Resizer::makeUniqueInstName(const char* base_name, bool underscore)
 {
-  string inst_name;
-  do {
-    stringPrint(inst_name,
-                underscore ? "%s_%d" : "%s%d",
-                base_name,
-                unique_inst_index_++);
-  } while (network_->findInstance(inst_name.c_str()));
-  return inst_name;
+  indexNames();
+  const string prefix = underscore ? string(base_name) + "_" : base_name;
+  return inst_names_.makeName(
+      prefix, unique_inst_index_, [this](const string& name) {
+        return network_->findInstance(name.c_str()) != nullptr;
+      });
 }
 
 float Resizer::portFanoutLoad(LibertyPort* port) const
@@ -2251,8 +2266,12 @@ void Resizer::gateDelays(const LibertyPort* drvr_port,
                          const DcalcAnalysisPt* dcalc_ap,
                          // Return values.
                          ArcDelay delays[RiseFall::index_count],
-                         Slew slews[RiseFall::index_count])
+                         Slew slews[RiseFall::index_count],
+                         ArcDelayCalc* arc_delay_calc)
 {
+  if (arc_delay_calc == nullptr) {
+    arc_delay_calc = arc_delay_calc_;
+  }
   for (int rf_index : RiseFall::rangeIndex()) {
     delays[rf_index] = -INF;
     slews[rf_index] = -INF;
@@ -2275,13 +2294,13 @@ void Resizer::gateDelays(const LibertyPort* drvr_port,
         }
         LoadPinIndexMap load_pin_index_map(network_);
         ArcDcalcResult dcalc_result
-            = arc_delay_calc_->gateDelay(nullptr,
-                                         arc,
-                                         in_slew,
-                                         load_cap,
-                                         nullptr,
-                                         load_pin_index_map,
-                                         dcalc_ap);
+            = arc_delay_calc->gateDelay(nullptr,
+                                        arc,
+                                        in_slew,
+                                        load_cap,
+                                        nullptr,
+                                        load_pin_index_map,
+                                        dcalc_ap);
 
         const ArcDelay& gate_delay = dcalc_result.gateDelay();
         const Slew& drvr_slew = dcalc_result.drvrSlew();
@@ -2344,11 +2363,12 @@ ArcDelay Resizer::gateDelay(const LibertyPort* drvr_port,
 
 ArcDelay Resizer::gateDelay(const LibertyPort* drvr_port,
                             const float load_cap,
-                            const DcalcAnalysisPt* dcalc_ap)
+                            const DcalcAnalysisPt* dcalc_ap,
+                            ArcDelayCalc* arc_delay_calc)
 {
   ArcDelay delays[RiseFall::index_count];
   Slew slews[RiseFall::index_count];
-  gateDelays(drvr_port, load_cap, dcalc_ap, delays, slews);
+  gateDelays(drvr_port, load_cap, dcalc_ap, delays, slews, arc_delay_calc);
   return max(delays[RiseFall::riseIndex()], delays[RiseFall::fallIndex()]);
 }
 
@@ -2752,7 +2772,9 @@ void Resizer::repairSetup(double setup_margin,
                           bool skip_pin_swap,
                           bool skip_gate_cloning,
                           bool skip_buffering,
-                          bool skip_buffer_removal)
+                          bool skip_buffer_removal,
+                          bool parallel_sizing,
+                          int num_threads)
 {
   resizePreamble();
   if (parasitics_src_ == ParasiticsSrc::global_routing) {
@@ -2765,7 +2787,14 @@ void Resizer::repairSetup(double setup_margin,
                              skip_pin_swap,
                              skip_gate_cloning,
                              skip_buffering,
-                             skip_buffer_removal);
+                             skip_buffer_removal,
+                             parallel_sizing,
+                             num_threads);
+}
+
+int Resizer::parallelSizingResizeCount() const
+{
+  return repair_setup_->parallelSizingResizeCount();
 }
 
 void Resizer::reportSwappablePins()
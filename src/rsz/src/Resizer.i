@@ -43,6 +43,7 @@
 #include "sta/Delay.hh"
 #include "sta/Liberty.hh"
 #include "db_sta/dbNetwork.hh"
+#include "ord/OpenRoad.hh"
 
 namespace ord {
 // Defined in OpenRoad.i
@@ -336,7 +337,8 @@ estimate_parasitics_cmd(ParasiticsSrc src)
 {
   ensureLinked();
   Resizer *resizer = getResizer();
-  resizer->estimateParasitics(src);
+  resizer->estimateParasitics(src,
+                              ord::OpenRoad::openRoad()->getThreadCount());
 }
 
 // For debugging. Does not protect against annotating power/gnd.
@@ -550,14 +552,24 @@ repair_setup(double setup_margin,
              int max_passes,
              bool verbose,
              bool skip_pin_swap, bool skip_gate_cloning,
-             bool skip_buffering, bool skip_buffer_removal)
+             bool skip_buffering, bool skip_buffer_removal,
+             bool parallel_sizing)
 {
   ensureLinked();
   Resizer *resizer = getResizer();
   resizer->repairSetup(setup_margin, repair_tns_end_percent,
                        max_passes, verbose,
                        skip_pin_swap, skip_gate_cloning,
-                       skip_buffering, skip_buffer_removal);
+                       skip_buffering, skip_buffer_removal,
+                       parallel_sizing,
+                       ord::OpenRoad::openRoad()->getThreadCount());
+}
+
+int
+parallel_sizing_resize_count()
+{
+  Resizer *resizer = getResizer();
+  return resizer->parallelSizingResizeCount();
 }
 
 void
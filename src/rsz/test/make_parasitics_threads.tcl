@@ -0,0 +1,34 @@
+# estimate_parasitics -placement with 4 threads matches 1 thread
+source "helpers.tcl"
+read_liberty Nangate45/Nangate45_typ.lib
+read_lef Nangate45/Nangate45.lef
+read_def gcd_nangate45_placed.def
+read_sdc gcd_nangate45.sdc
+
+source Nangate45/Nangate45.rc
+set_wire_rc -layer metal3
+
+proc pin_slacks { } {
+  set slacks {}
+  foreach pin [get_pins */*] {
+    dict set slacks [get_full_name $pin] [get_property $pin slack_max]
+  }
+  return $slacks
+}
+
+set_thread_count 1
+estimate_parasitics -placement
+set wns1 [sta::worst_slack -max]
+set tns1 [sta::total_negative_slack -max]
+set slacks1 [pin_slacks]
+
+set_thread_count 4
+estimate_parasitics -placement
+set wns4 [sta::worst_slack -max]
+set tns4 [sta::total_negative_slack -max]
+set slacks4 [pin_slacks]
+
+check "same worst slack" {expr $wns4 == $wns1} 1
+check "same total negative slack" {expr $tns4 == $tns1} 1
+check "same pin slacks" {expr {$slacks4 eq $slacks1}} 1
+exit_summary
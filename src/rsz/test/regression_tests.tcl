@@ -16,6 +16,7 @@ record_tests {
   make_parasitics4
   make_parasitics5
   make_parasitics6
+  make_parasitics_threads
   pin_swap1
   resize1
   resize4
@@ -65,6 +66,7 @@ record_tests {
   repair_setup4
   repair_setup5
   repair_setup6
+  repair_setup_parallel
   repair_setup7
   repair_slew1
   repair_slew2
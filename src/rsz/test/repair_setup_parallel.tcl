@@ -0,0 +1,37 @@
+# repair_timing -setup -parallel_sizing with 2 threads on repair_setup1
+source "helpers.tcl"
+define_corners fast slow
+read_liberty -corner slow Nangate45/Nangate45_slow.lib
+read_liberty -corner fast Nangate45/Nangate45_fast.lib
+read_lef Nangate45/Nangate45.lef
+read_def repair_setup1.def
+create_clock -period 0.3 clk
+
+source Nangate45/Nangate45.rc
+set_wire_rc -layer metal3
+estimate_parasitics -placement
+
+report_worst_slack -max
+report_tns -digits 3
+
+set wns_before [sta::worst_slack -max]
+set tns_before [sta::total_negative_slack -max]
+
+# the counts depend on how much the parallel pass repairs
+suppress_message RSZ 40
+suppress_message RSZ 41
+suppress_message RSZ 43
+suppress_message RSZ 45
+suppress_message RSZ 49
+suppress_message RSZ 59
+suppress_message RSZ 62
+
+set_thread_count 2
+repair_timing -setup -parallel_sizing
+
+check "wns improved" {expr [sta::worst_slack -max] > $wns_before} 1
+check "tns improved" {expr [sta::total_negative_slack -max] > $tns_before} 1
+# The serial repair runs after the parallel pass, so only the count of the
+# parallel pass shows that it did any of the work.
+check "parallel pass resized" {expr [rsz::parallel_sizing_resize_count] > 0} 1
+exit_summary
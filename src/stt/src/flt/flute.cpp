@@ -33,12 +33,14 @@
 #include "stt/flute.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <climits>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <mutex>
 #include <string>
 
 // Use flute LUT file reader.
@@ -203,7 +205,10 @@ static void readLUTfiles(LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
 static void readLUT();
 static void makeLUT(LUT_TYPE& LUT, NUMSOLN_TYPE& numsoln);
 static void deleteLUT(LUT_TYPE& LUT, NUMSOLN_TYPE& numsoln);
-static void initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln);
+static void initLUT(int from_d,
+                    int to_d,
+                    LUT_TYPE LUT,
+                    NUMSOLN_TYPE numsoln);
 static void ensureLUT(int d);
 static std::string base64_decode(std::string const& encoded_string);
 #if LUT_SOURCE == LUT_VAR_CHECK
@@ -215,7 +220,10 @@ static void checkLUT(LUT_TYPE LUT1,
 
 // LUTs are initialized to this order at startup.
 static constexpr int lut_initial_d = 8;
-static int lut_valid_d = 0;
+// Set once the tables are ready up to this degree.
+static std::atomic<int> lut_valid_d = 0;
+// Trees may be built from several threads, so the lazy LUT setup is guarded.
+static std::mutex lut_mutex;
 
 extern std::string post9;
 extern std::string powv9;
@@ -230,7 +238,7 @@ static void readLUT()
 
 #elif LUT_SOURCE == LUT_VAR
   // Only init to d=8 on startup because d=9 is big and slow.
-  initLUT(lut_initial_d, LUT, numsoln);
+  initLUT(0, lut_initial_d, LUT, numsoln);
 
 #elif LUT_SOURCE == LUT_VAR_CHECK
   readLUTfiles(LUT, numsoln);
@@ -238,7 +246,7 @@ static void readLUT()
   LUT_TYPE LUT_;
   NUMSOLN_TYPE numsoln_;
   makeLUT(LUT_, numsoln_);
-  initLUT(FLUTE_D, LUT_, numsoln_);
+  initLUT(0, FLUTE_D, LUT_, numsoln_);
   checkLUT(LUT, numsoln, LUT_, numsoln_);
 #endif
 }
@@ -299,8 +307,13 @@ inline const char* readDecimalInt(const char* s, int& value)
   return s;
 }
 
-// Init LUTs from base64 encoded string variables.
-static void initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
+// Init LUTs from base64 encoded string variables for degrees above from_d.
+// Tables at or below from_d may be in use by other threads, so they are
+// only parsed past and never rewritten.
+static void initLUT(int from_d,
+                    int to_d,
+                    LUT_TYPE LUT,
+                    NUMSOLN_TYPE numsoln)
 {
   std::string pwv_string = base64_decode(powv9);
   const char* pwv = pwv_string.c_str();
@@ -321,18 +334,25 @@ static void initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
     }
     ++prt;
 #endif
+    const bool store = d > from_d;
     for (int k = 0; k < numgrp[d]; k++) {
       int ns = charNum(*pwv++);
       if (ns == 0) {  // same as some previous group
         int kk;
         pwv = readDecimalInt(pwv, kk) + 1;
-        numsoln[d][k] = numsoln[d][kk];
-        LUT[d][k] = LUT[d][kk];
+        if (store) {
+          numsoln[d][k] = numsoln[d][kk];
+          LUT[d][k] = LUT[d][kk];
+        }
       } else {
         pwv++;  // '\n'
-        numsoln[d][k] = ns;
-        struct csoln* p = new struct csoln[ns];
-        LUT[d][k] = p;
+        struct csoln skipped;
+        struct csoln* p = &skipped;
+        if (store) {
+          numsoln[d][k] = ns;
+          p = new struct csoln[ns];
+          LUT[d][k] = p;
+        }
         for (int i = 1; i <= ns; i++) {
           p->parent = charNum(*pwv++);
 
@@ -368,7 +388,9 @@ static void initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
           }
           prt++;  // \n
 #endif
-          p++;
+          if (store) {
+            p++;
+          }
         }
       }
     }
@@ -378,11 +400,16 @@ static void initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
 
 static void ensureLUT(int d)
 {
+  const int valid_d = lut_valid_d;
+  if (valid_d > 0 && (d <= valid_d || d > FLUTE_D)) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(lut_mutex);
   if (LUT == nullptr) {
     readLUT();
   }
   if (d > lut_valid_d && d <= FLUTE_D) {
-    initLUT(FLUTE_D, LUT, numsoln);
+    initLUT(lut_valid_d, FLUTE_D, LUT, numsoln);
   }
 }
 
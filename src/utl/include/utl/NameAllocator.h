@@ -0,0 +1,74 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// BSD 3-Clause License
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace utl {
+
+// Hands out unique names of the form <prefix><index>. Existing names are
+// indexed once by prefix and trailing decimal number, so finding the lowest
+// free index does not probe the database once per taken candidate.
+class NameAllocator
+{
+ public:
+  using NameExists = std::function<bool(const std::string& name)>;
+
+  // Records a name in use. Names without a numeric suffix are ignored.
+  void addName(std::string_view name);
+
+  // Returns prefix + index for the lowest free index >= next_index and moves
+  // next_index past it. When given, exists is asked about the candidate so
+  // names made behind the allocator's back since indexing are still skipped.
+  std::string makeName(std::string_view prefix,
+                       int& next_index,
+                       const NameExists& exists = nullptr);
+
+  void clear() { used_.clear(); }
+
+ private:
+  using UsedIndices = std::unordered_map<int, int>;
+
+  static int findFree(UsedIndices& used, int index);
+
+  // prefix -> used index -> hint at or below the next free index after it.
+  std::unordered_map<std::string, UsedIndices> used_;
+};
+
+}  // namespace utl
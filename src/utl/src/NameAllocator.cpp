@@ -0,0 +1,96 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// BSD 3-Clause License
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "utl/NameAllocator.h"
+
+#include <cctype>
+
+namespace utl {
+
+void NameAllocator::addName(std::string_view name)
+{
+  size_t digits = 0;
+  while (digits < name.size()
+         && std::isdigit(name[name.size() - digits - 1])) {
+    digits++;
+  }
+  // Only suffixes makeName could produce: no leading zeros, fits an int.
+  const size_t start = name.size() - digits;
+  if (digits == 0 || digits > 9 || (digits > 1 && name[start] == '0')) {
+    return;
+  }
+
+  int index = 0;
+  for (size_t i = start; i < name.size(); i++) {
+    index = index * 10 + (name[i] - '0');
+  }
+  used_[std::string(name.substr(0, start))][index] = index + 1;
+}
+
+std::string NameAllocator::makeName(std::string_view prefix,
+                                    int& next_index,
+                                    const NameExists& exists)
+{
+  UsedIndices& used = used_[std::string(prefix)];
+  while (true) {
+    const int index = findFree(used, next_index);
+    used[index] = index + 1;
+    next_index = index + 1;
+    std::string name = std::string(prefix) + std::to_string(index);
+    if (!exists || !exists(name)) {
+      return name;
+    }
+  }
+}
+
+// Follows the hints from index to the first free one and points every
+// visited entry at it, so runs of used indices are skipped in amortized
+// constant time.
+int NameAllocator::findFree(UsedIndices& used, int index)
+{
+  int free_index = index;
+  for (auto it = used.find(free_index); it != used.end();
+       it = used.find(free_index)) {
+    free_index = it->second;
+  }
+  while (index != free_index) {
+    auto it = used.find(index);
+    index = it->second;
+    it->second = free_index;
+  }
+  return free_index;
+}
+
+}  // namespace utl
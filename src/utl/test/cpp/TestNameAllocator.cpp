@@ -0,0 +1,138 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// BSD 3-Clause License
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <set>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "utl/NameAllocator.h"
+
+namespace utl {
+
+TEST(NameAllocator, skips_indexed_suffixes)
+{
+  NameAllocator allocator;
+  allocator.addName("net1");
+  allocator.addName("net2");
+  allocator.addName("net4");
+
+  int next_index = 1;
+  EXPECT_EQ(allocator.makeName("net", next_index), "net3");
+  EXPECT_EQ(next_index, 4);
+  EXPECT_EQ(allocator.makeName("net", next_index), "net5");
+  EXPECT_EQ(next_index, 6);
+}
+
+// Only the trailing digits are the index, the rest is the prefix.
+TEST(NameAllocator, parses_trailing_suffix)
+{
+  NameAllocator allocator;
+  allocator.addName("a1b2");
+  allocator.addName("net");
+  allocator.addName("net_");
+  allocator.addName("net_0");
+
+  int next_index = 2;
+  EXPECT_EQ(allocator.makeName("a1b", next_index), "a1b3");
+  next_index = 1;
+  EXPECT_EQ(allocator.makeName("a", next_index), "a1");
+  next_index = 0;
+  EXPECT_EQ(allocator.makeName("net", next_index), "net0");
+  next_index = 0;
+  EXPECT_EQ(allocator.makeName("net_", next_index), "net_1");
+}
+
+// makeName never produces leading zeros, so such names don't reserve an
+// index.
+TEST(NameAllocator, ignores_leading_zeros)
+{
+  NameAllocator allocator;
+  allocator.addName("net007");
+  allocator.addName("net00");
+
+  int next_index = 0;
+  EXPECT_EQ(allocator.makeName("net", next_index), "net0");
+  next_index = 7;
+  EXPECT_EQ(allocator.makeName("net", next_index), "net7");
+}
+
+TEST(NameAllocator, skips_names_reported_by_exists)
+{
+  NameAllocator allocator;
+  const std::set<std::string> existing = {"buf3", "buf4", "buf7"};
+  auto exists = [&existing](const std::string& name) {
+    return existing.find(name) != existing.end();
+  };
+
+  int next_index = 3;
+  EXPECT_EQ(allocator.makeName("buf", next_index, exists), "buf5");
+  EXPECT_EQ(next_index, 6);
+  EXPECT_EQ(allocator.makeName("buf", next_index, exists), "buf6");
+  EXPECT_EQ(allocator.makeName("buf", next_index, exists), "buf8");
+
+  // The colliding names stay reserved without asking again.
+  next_index = 3;
+  EXPECT_EQ(allocator.makeName("buf", next_index), "buf9");
+}
+
+TEST(NameAllocator, clear_forgets_names)
+{
+  NameAllocator allocator;
+  allocator.addName("net1");
+  allocator.clear();
+
+  int next_index = 1;
+  EXPECT_EQ(allocator.makeName("net", next_index), "net1");
+}
+
+// Restarting every search at the same index walks the whole run of used
+// indices. With the hints compressed this stays linear overall instead of
+// quadratic.
+TEST(NameAllocator, compresses_runs_of_used_indices)
+{
+  NameAllocator allocator;
+  const int num_names = 200000;
+  for (int i = 1; i <= num_names; i++) {
+    allocator.addName("net" + std::to_string(i));
+  }
+
+  for (int i = 1; i <= num_names; i++) {
+    int next_index = 1;
+    ASSERT_EQ(allocator.makeName("net", next_index),
+              "net" + std::to_string(num_names + i));
+    ASSERT_EQ(next_index, num_names + i + 1);
+  }
+}
+
+}  // namespace utl